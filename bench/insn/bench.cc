@@ -0,0 +1,31 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/bench_registration.h"
+#include "bench.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res)
+{
+    bench_bitwise(res);
+    bench_compare(res);
+    bench_convert(res);
+    bench_math_fp(res);
+    bench_math_int(res);
+    bench_math_transcendental(res);
+    bench_memory(res);
+    bench_shuffle(res);
+    bench_transpose(res);
+}
+
+static BenchRegistration registration(main_bench_function,
+                                      SIMDPP_ARCH_NAME,
+                                      simdpp::this_compile_arch());
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,30 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_INSN_BENCH_H
+#define LIBSIMDPP_BENCH_INSN_BENCH_H
+
+#include "../utils/bench_helpers.h"
+#include "../utils/bench_results.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res);
+void bench_bitwise(BenchResults& res);
+void bench_compare(BenchResults& res);
+void bench_convert(BenchResults& res);
+void bench_math_fp(BenchResults& res);
+void bench_math_int(BenchResults& res);
+void bench_math_transcendental(BenchResults& res);
+void bench_memory(BenchResults& res);
+void bench_shuffle(BenchResults& res);
+void bench_transpose(BenchResults& res);
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+#endif
@@ -0,0 +1,49 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_bitwise_type(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    BENCH_OP2(res, V, bit_and, a, a);
+    BENCH_OP2(res, V, bit_andnot, a, a);
+    BENCH_OP2(res, V, bit_or, a, a);
+    BENCH_OP2(res, V, bit_xor, a, a);
+    BENCH_OP1(res, V, bit_not, a);
+
+    V b = a;
+    V m = make_uint(0, -1);
+    bench_op(res, "blend", a, [=](const V& x)
+             { return blend(x, b, m).eval(); });
+}
+
+template<unsigned B>
+void bench_bitwise_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_bitwise_type(res, (uint8<B>) make_uint(0x5a));
+    bench_bitwise_type(res, (uint16<B/2>) make_uint(0x5a));
+    bench_bitwise_type(res, (uint32<B/4>) make_uint(0x5a));
+    bench_bitwise_type(res, (uint64<B/8>) make_uint(0x5a));
+    bench_bitwise_type(res, (float32<B/4>) make_float(1.0f));
+    bench_bitwise_type(res, (float64<B/8>) make_float(1.0));
+}
+
+void bench_bitwise(BenchResults& res)
+{
+    bench_bitwise_n<16>(res);
+    bench_bitwise_n<32>(res);
+    bench_bitwise_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,64 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_compare_eq(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    BENCH_OP2(res, V, cmp_eq, a, a);
+    BENCH_OP2(res, V, cmp_neq, a, a);
+}
+
+template<class V>
+void bench_compare_ord(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_compare_eq(res, a);
+    BENCH_OP2(res, V, cmp_lt, a, a);
+    BENCH_OP2(res, V, cmp_gt, a, a);
+}
+
+template<class V>
+void bench_compare_fp(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_compare_ord(res, a);
+    BENCH_OP2(res, V, cmp_le, a, a);
+    BENCH_OP2(res, V, cmp_ge, a, a);
+}
+
+template<unsigned B>
+void bench_compare_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_compare_ord(res, (int8<B>) make_int(3));
+    bench_compare_ord(res, (uint8<B>) make_uint(3));
+    bench_compare_ord(res, (int16<B/2>) make_int(3));
+    bench_compare_ord(res, (uint16<B/2>) make_uint(3));
+    bench_compare_ord(res, (int32<B/4>) make_int(3));
+    bench_compare_ord(res, (uint32<B/4>) make_uint(3));
+    bench_compare_eq(res, (uint64<B/8>) make_uint(3));
+    bench_compare_fp(res, (float32<B/4>) make_float(1.0f));
+    bench_compare_fp(res, (float64<B/8>) make_float(1.0));
+}
+
+void bench_compare(BenchResults& res)
+{
+    bench_compare_n<16>(res);
+    bench_compare_n<32>(res);
+    bench_compare_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
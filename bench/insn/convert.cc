@@ -0,0 +1,57 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<unsigned B>
+void bench_convert_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    using uint8_n = uint8<B>;
+    using  int8_n = int8<B>;
+    using uint16_n = uint16<B/2>;
+    using  int16_n = int16<B/2>;
+    using uint32_n = uint32<B/4>;
+    using  int32_n = int32<B/4>;
+    using float16_n = float16<B/2>;
+    using bfloat16_n = bfloat16<B/2>;
+    using float32_n = float32<B/4>;
+    using float32_2n = float32<B/2>;
+    using float64_2n = float64<B/4>;
+
+    BENCH_OP1(res, int8_n, to_int16, make_int(3));
+    BENCH_OP1(res, uint8_n, to_int16, make_uint(3));
+    BENCH_OP1(res, int16_n, to_int32, make_int(3));
+    BENCH_OP1(res, uint16_n, to_int32, make_uint(3));
+    BENCH_OP1(res, int32_n, to_int64, make_int(3));
+    BENCH_OP1(res, uint32_n, to_int64, make_uint(3));
+    BENCH_OP1(res, int32_n, to_float32, make_int(3));
+    BENCH_OP1(res, int32_n, to_float64, make_int(3));
+    BENCH_OP1(res, float32_n, to_int32, make_float(3.0f));
+    BENCH_OP1(res, float32_n, to_int32_round, make_float(3.0f));
+    BENCH_OP1(res, float32_n, to_float64, make_float(3.0f));
+    BENCH_OP1(res, float64_2n, to_int32, make_float(3.0));
+    BENCH_OP1(res, float64_2n, to_int32_round, make_float(3.0));
+    BENCH_OP1(res, float64_2n, to_float32, make_float(3.0));
+    BENCH_OP1(res, float16_n, to_float32, uint16_n(make_uint(0x4200)));
+    BENCH_OP1(res, float32_2n, to_float16, make_float(3.0f));
+    BENCH_OP1(res, bfloat16_n, to_float32, uint16_n(make_uint(0x4040)));
+    BENCH_OP1(res, float32_2n, to_bfloat16, make_float(3.0f));
+    BENCH_OP1(res, float32_2n, to_bfloat16_trunc, make_float(3.0f));
+}
+
+void bench_convert(BenchResults& res)
+{
+    bench_convert_n<16>(res);
+    bench_convert_n<32>(res);
+    bench_convert_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
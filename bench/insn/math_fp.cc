@@ -0,0 +1,100 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<unsigned B>
+void bench_math_fp_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    using float32_n = float32<B/4>;
+    using float64_n = float64<B/8>;
+
+    // The inputs are chosen so that the latency chains don't converge to
+    // denormals which are slow on many processors
+    {
+        float32_n a = make_float(1.0f);
+        float32_n b = make_float(1.0f);
+
+        BENCH_OP2(res, float32_n, add, a, b);
+        BENCH_OP2(res, float32_n, sub, a, b);
+        BENCH_OP2(res, float32_n, mul, a, b);
+        BENCH_OP2(res, float32_n, div, a, b);
+        BENCH_OP2(res, float32_n, min, a, b);
+        BENCH_OP2(res, float32_n, max, a, b);
+        BENCH_OP1(res, float32_n, sqrt, a);
+        BENCH_OP1(res, float32_n, rcp_e, a);
+        BENCH_OP2(res, float32_n, rcp_rh, a, b);
+        BENCH_OP1(res, float32_n, rsqrt_e, a);
+        BENCH_OP2(res, float32_n, rsqrt_rh, a, b);
+        BENCH_OP1(res, float32_n, abs, a);
+        BENCH_OP1(res, float32_n, neg, a);
+        BENCH_OP1(res, float32_n, sign, a);
+        BENCH_OP1(res, float32_n, floor, a);
+        BENCH_OP1(res, float32_n, ceil, a);
+        BENCH_OP1(res, float32_n, trunc, a);
+        BENCH_OP1(res, float32_n, round, a);
+        BENCH_OP1(res, float32_n, nearbyint, a);
+        BENCH_OP1(res, float32_n, isnan, a);
+        BENCH_OP2(res, float32_n, isnan2, a, b);
+        BENCH_OP1(res, float32_n, reduce_add, a);
+        BENCH_OP1(res, float32_n, reduce_mul, a);
+        BENCH_OP1(res, float32_n, reduce_min, a);
+#if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512
+        bench_op(res, "fmadd", a, [=](const float32_n& x)
+                 { return fmadd(x, b, b).eval(); });
+        bench_op(res, "fmsub", a, [=](const float32_n& x)
+                 { return fmsub(x, b, b).eval(); });
+#endif
+        // 0x3f80 is 1.0, the accumulator thus grows linearly
+        bfloat16<B/2> h = (bfloat16<B/2>) uint16<B/2>(make_uint(0x3f80));
+        bench_op(res, "dot_bf16", a, [=](const float32_n& x)
+                 { return dot_bf16(h, h, x); });
+    }
+
+    {
+        float64_n a = make_float(1.0);
+        float64_n b = make_float(1.0);
+
+        BENCH_OP2(res, float64_n, add, a, b);
+        BENCH_OP2(res, float64_n, sub, a, b);
+        BENCH_OP2(res, float64_n, mul, a, b);
+        BENCH_OP2(res, float64_n, div, a, b);
+        BENCH_OP2(res, float64_n, min, a, b);
+        BENCH_OP2(res, float64_n, max, a, b);
+        BENCH_OP1(res, float64_n, sqrt, a);
+        BENCH_OP1(res, float64_n, abs, a);
+        BENCH_OP1(res, float64_n, neg, a);
+        BENCH_OP1(res, float64_n, sign, a);
+        BENCH_OP1(res, float64_n, trunc, a);
+        BENCH_OP1(res, float64_n, round, a);
+        BENCH_OP1(res, float64_n, nearbyint, a);
+        BENCH_OP1(res, float64_n, isnan, a);
+        BENCH_OP2(res, float64_n, isnan2, a, b);
+        BENCH_OP1(res, float64_n, reduce_add, a);
+        BENCH_OP1(res, float64_n, reduce_mul, a);
+        BENCH_OP1(res, float64_n, reduce_min, a);
+#if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512
+        bench_op(res, "fmadd", a, [=](const float64_n& x)
+                 { return fmadd(x, b, b).eval(); });
+        bench_op(res, "fmsub", a, [=](const float64_n& x)
+                 { return fmsub(x, b, b).eval(); });
+#endif
+    }
+}
+
+void bench_math_fp(BenchResults& res)
+{
+    bench_math_fp_n<16>(res);
+    bench_math_fp_n<32>(res);
+    bench_math_fp_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
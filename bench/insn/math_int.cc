@@ -0,0 +1,146 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<unsigned B>
+void bench_math_int_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    using int8_n = int8<B>;
+    using uint8_n = uint8<B>;
+    using int16_n = int16<B/2>;
+    using uint16_n = uint16<B/2>;
+    using int32_n = int32<B/4>;
+    using uint32_n = uint32<B/4>;
+    using int64_n = int64<B/8>;
+    using uint64_n = uint64<B/8>;
+
+    {
+        int8_n a = make_int(3);
+        uint8_n ua = make_uint(3);
+
+        BENCH_OP2(res, int8_n, add, a, a);
+        BENCH_OP2(res, int8_n, sub, a, a);
+        BENCH_OP2(res, int8_n, add_sat, a, a);
+        BENCH_OP2(res, int8_n, sub_sat, a, a);
+        BENCH_OP2(res, uint8_n, add_sat, ua, ua);
+        BENCH_OP2(res, uint8_n, sub_sat, ua, ua);
+        BENCH_OP2(res, int8_n, min, a, a);
+        BENCH_OP2(res, int8_n, max, a, a);
+        BENCH_OP2(res, uint8_n, min, ua, ua);
+        BENCH_OP2(res, uint8_n, max, ua, ua);
+        BENCH_OP2(res, int8_n, avg, a, a);
+        BENCH_OP2(res, uint8_n, avg, ua, ua);
+        BENCH_OP2(res, uint8_n, avg_trunc, ua, ua);
+        BENCH_OP1(res, int8_n, abs, a);
+        BENCH_OP1(res, int8_n, neg, a);
+        BENCH_OP1(res, int8_n, shift_l<3>, a);
+        BENCH_OP1(res, int8_n, shift_r<3>, a);
+        BENCH_OP1(res, uint8_n, shift_r<3>, ua);
+        BENCH_OP1(res, uint8_n, reduce_add, ua);
+        BENCH_OP1(res, uint8_n, reduce_min, ua);
+        BENCH_OP1(res, int8_n, reduce_max, a);
+    }
+
+    {
+        int16_n a = make_int(3);
+        uint16_n ua = make_uint(3);
+
+        BENCH_OP2(res, int16_n, add, a, a);
+        BENCH_OP2(res, int16_n, sub, a, a);
+        BENCH_OP2(res, int16_n, add_sat, a, a);
+        BENCH_OP2(res, int16_n, sub_sat, a, a);
+        BENCH_OP2(res, uint16_n, add_sat, ua, ua);
+        BENCH_OP2(res, uint16_n, sub_sat, ua, ua);
+        BENCH_OP2(res, int16_n, mul_lo, a, a);
+        BENCH_OP2(res, int16_n, mul_hi, a, a);
+        BENCH_OP2(res, uint16_n, mul_hi, ua, ua);
+        BENCH_OP2(res, int16_n, mull, a, a);
+        BENCH_OP2(res, int16_n, min, a, a);
+        BENCH_OP2(res, int16_n, max, a, a);
+        BENCH_OP2(res, uint16_n, min, ua, ua);
+        BENCH_OP2(res, uint16_n, max, ua, ua);
+        BENCH_OP2(res, uint16_n, avg, ua, ua);
+        BENCH_OP1(res, int16_n, abs, a);
+        BENCH_OP1(res, int16_n, neg, a);
+        BENCH_OP1(res, int16_n, shift_l<3>, a);
+        BENCH_OP1(res, int16_n, shift_r<3>, a);
+        BENCH_OP1(res, uint16_n, shift_r<3>, ua);
+        BENCH_OP2(res, uint16_n, shift_l, ua, ua);
+        BENCH_OP2(res, uint16_n, shift_r, ua, ua);
+        BENCH_OP1(res, int16_n, reduce_add, a);
+        BENCH_OP1(res, uint16_n, reduce_min, ua);
+    }
+
+    {
+        int32_n a = make_int(3);
+        uint32_n ua = make_uint(3);
+
+        BENCH_OP2(res, int32_n, add, a, a);
+        BENCH_OP2(res, int32_n, sub, a, a);
+#if !(SIMDPP_USE_ALTIVEC)
+        BENCH_OP2(res, int32_n, mul_lo, a, a);
+        BENCH_OP2(res, uint32_n, mull, ua, ua);
+#endif
+        BENCH_OP2(res, int32_n, min, a, a);
+        BENCH_OP2(res, int32_n, max, a, a);
+        BENCH_OP2(res, uint32_n, min, ua, ua);
+        BENCH_OP2(res, uint32_n, max, ua, ua);
+        BENCH_OP2(res, uint32_n, avg, ua, ua);
+        BENCH_OP1(res, int32_n, abs, a);
+        BENCH_OP1(res, int32_n, neg, a);
+        BENCH_OP1(res, int32_n, shift_l<3>, a);
+        BENCH_OP1(res, int32_n, shift_r<3>, a);
+        BENCH_OP1(res, uint32_n, shift_r<3>, ua);
+        BENCH_OP2(res, uint32_n, shift_l, ua, ua);
+        BENCH_OP2(res, uint32_n, shift_r, ua, ua);
+        BENCH_OP1(res, uint32_n, reduce_add, ua);
+        BENCH_OP1(res, int32_n, reduce_min, a);
+        BENCH_OP1(res, uint32_n, reduce_mul, ua);
+        BENCH_OP1(res, uint32_n, reduce_or, ua);
+    }
+
+#if !(SIMDPP_USE_ALTIVEC)
+    {
+        int64_n a = make_int(3);
+        uint64_n ua = make_uint(3);
+
+        BENCH_OP2(res, int64_n, add, a, a);
+        BENCH_OP2(res, int64_n, sub, a, a);
+        BENCH_OP1(res, int64_n, abs, a);
+        BENCH_OP1(res, int64_n, neg, a);
+        BENCH_OP1(res, int64_n, shift_l<3>, a);
+        BENCH_OP1(res, int64_n, shift_r<3>, a);
+        BENCH_OP1(res, uint64_n, shift_r<3>, ua);
+        BENCH_OP2(res, uint64_n, shift_l, ua, ua);
+        BENCH_OP2(res, uint64_n, shift_r, ua, ua);
+        BENCH_OP1(res, uint64_n, reduce_add, ua);
+    }
+#endif
+}
+
+void bench_math_int(BenchResults& res)
+{
+    bench_math_int_n<16>(res);
+    bench_math_int_n<32>(res);
+    bench_math_int_n<64>(res);
+
+    // div_p is currently available only for 128-bit vectors
+    using namespace simdpp;
+    uint8<16> n8 = make_uint(200), d8 = make_uint(7);
+    bench_op(res, "div_p<8>", n8, [=](const uint8<16>& x)
+             { return div_p<8>(x, d8); });
+    uint16<8> n16 = make_uint(20000), d16 = make_uint(7);
+    bench_op(res, "div_p<16>", n16, [=](const uint16<8>& x)
+             { return div_p<16>(x, d16); });
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
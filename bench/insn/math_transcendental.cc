@@ -0,0 +1,81 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<unsigned D, class V>
+void bench_math_approx_degree(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+    std::string d = "<" + std::to_string(D) + ">";
+
+    bench_op(res, ("approx::exp2" + d).c_str(), a, [](const V& x)
+             { return approx::exp2<D>(x); });
+    bench_op(res, ("approx::exp" + d).c_str(), a, [](const V& x)
+             { return approx::exp<D>(x); });
+    bench_op(res, ("approx::log2" + d).c_str(), a, [](const V& x)
+             { return approx::log2<D>(x); });
+    bench_op(res, ("approx::sigmoid" + d).c_str(), a, [](const V& x)
+             { return approx::sigmoid<D>(x); });
+    bench_op(res, ("approx::tanh" + d).c_str(), a, [](const V& x)
+             { return approx::tanh<D>(x); });
+}
+
+template<unsigned B>
+void bench_math_transcendental_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    using float32_n = float32<B/4>;
+    using float64_n = float64<B/8>;
+
+    // The latency chains leave the domain of some of the functions after a
+    // few iterations. This doesn't affect the timings as the implementations
+    // contain no data-dependent branches.
+    {
+        float32_n a = make_float(0.5f);
+        float32_n b = make_float(1.0f);
+
+        BENCH_OP1(res, float32_n, exp, a);
+        BENCH_OP1(res, float32_n, exp2, a);
+        BENCH_OP1(res, float32_n, log, a);
+        BENCH_OP1(res, float32_n, log2, a);
+        BENCH_OP1(res, float32_n, sin, a);
+        BENCH_OP1(res, float32_n, cos, a);
+        BENCH_OP1(res, float32_n, tanh, a);
+        BENCH_OP2(res, float32_n, pow, a, b);
+
+        bench_math_approx_degree<2>(res, a);
+        bench_math_approx_degree<3>(res, a);
+        bench_math_approx_degree<4>(res, a);
+    }
+
+    {
+        float64_n a = make_float(0.5);
+        float64_n b = make_float(1.0);
+
+        BENCH_OP1(res, float64_n, exp, a);
+        BENCH_OP1(res, float64_n, exp2, a);
+        BENCH_OP1(res, float64_n, log, a);
+        BENCH_OP1(res, float64_n, log2, a);
+        BENCH_OP1(res, float64_n, sin, a);
+        BENCH_OP1(res, float64_n, cos, a);
+        BENCH_OP1(res, float64_n, tanh, a);
+        BENCH_OP2(res, float64_n, pow, a, b);
+    }
+}
+
+void bench_math_transcendental(BenchResults& res)
+{
+    bench_math_transcendental_n<16>(res);
+    bench_math_transcendental_n<32>(res);
+    bench_math_transcendental_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
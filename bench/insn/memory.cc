@@ -0,0 +1,383 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+#include <memory>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// Prevents the compiler from eliminating stores that are overwritten in the
+// next iteration of the benchmark loop
+SIMDPP_INL void bench_memory_barrier()
+{
+#if defined(__GNUC__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+/*  The buffers are small enough to stay in L1 cache, so that the results
+    reflect the cost of the instructions rather than the memory subsystem.
+*/
+using BenchBuffer = std::vector<char, simdpp::aligned_allocator<char, 64>>;
+
+template<class V>
+void bench_memory_type(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    const unsigned vb = V::length_bytes;
+    // 4 vectors per unrolled operation for the packed variants plus slack
+    // for the unaligned accesses
+    auto buf = std::make_shared<BenchBuffer>(vb * 4 * bench_unroll + 64, 1);
+
+    bench_kernel<V>(res, "load", [=](unsigned reps)
+    {
+        const char* p = buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r = load(p + j * vb);
+                bench_barrier(r);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "load_u", [=](unsigned reps)
+    {
+        const char* p = buf->data() + 1;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r = load_u(p + j * vb);
+                bench_barrier(r);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "load_splat", [=](unsigned reps)
+    {
+        const char* p = buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r = load_splat(p + j * vb);
+                bench_barrier(r);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "load_packed2", [=](unsigned reps)
+    {
+        const char* p = buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r0, r1;
+                load_packed2(r0, r1, p + j * vb * 2);
+                bench_barrier(r0); bench_barrier(r1);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "load_packed3", [=](unsigned reps)
+    {
+        const char* p = buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r0, r1, r2;
+                load_packed3(r0, r1, r2, p + j * vb * 3);
+                bench_barrier(r0); bench_barrier(r1); bench_barrier(r2);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "load_packed4", [=](unsigned reps)
+    {
+        const char* p = buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V r0, r1, r2, r3;
+                load_packed4(r0, r1, r2, r3, p + j * vb * 4);
+                bench_barrier(r0); bench_barrier(r1);
+                bench_barrier(r2); bench_barrier(r3);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store(p + j * vb, x);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "stream", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                stream(p + j * vb, x);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store_first", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store_first(p + j * vb, x, V::length / 2);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store_last", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store_last(p + j * vb, x, V::length / 2);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store_packed2", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store_packed2(p + j * vb * 2, x, x);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store_packed3", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store_packed3(p + j * vb * 3, x, x, x);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "store_packed4", [=](unsigned reps)
+    {
+        char* p = buf->data();
+        V x = a;
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                store_packed4(p + j * vb * 4, x, x, x, x);
+            }
+        }
+    });
+}
+
+/*  The indices are a fixed pseudo-random permutation of a table that is four
+    vectors long. The scalar variant performs the same loads one element at a
+    time and assembles the result in memory.
+*/
+template<class V, class I>
+void bench_gather_type(BenchResults& res)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    const unsigned size = V::length * 4;
+    auto table = std::make_shared<std::vector<E, aligned_allocator<E, 64>>>(size, 1);
+    auto idx_buf = std::make_shared<std::vector<IE, aligned_allocator<IE, 64>>>(
+                V::length * bench_unroll);
+    for (unsigned i = 0; i < idx_buf->size(); ++i) {
+        (*idx_buf)[i] = (i * 7 + i / V::length * 5) % size;
+    }
+
+    bench_kernel<V>(res, "gather", [=](unsigned reps)
+    {
+        const E* base = table->data();
+        const IE* pi = idx_buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                I idx = load(pi + j * V::length);
+                V r = gather(base, idx);
+                bench_barrier(r);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "gather_scalar", [=](unsigned reps)
+    {
+        const E* base = table->data();
+        const IE* pi = idx_buf->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                SIMDPP_ALIGN(64) E r[V::length];
+                for (unsigned k = 0; k < V::length; ++k) {
+                    r[k] = base[pi[j * V::length + k]];
+                }
+                V v = load(r);
+                bench_barrier(v);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "scatter", [=](unsigned reps)
+    {
+        E* base = table->data();
+        const IE* pi = idx_buf->data();
+        V x = load(table->data());
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                I idx = load(pi + j * V::length);
+                scatter(base, idx, x);
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "scatter_scalar", [=](unsigned reps)
+    {
+        E* base = table->data();
+        const IE* pi = idx_buf->data();
+        V x = load(table->data());
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                bench_barrier(x);
+                SIMDPP_ALIGN(64) E mx[V::length];
+                store(mx, x);
+                for (unsigned k = 0; k < V::length; ++k) {
+                    base[pi[j * V::length + k]] = mx[k];
+                }
+            }
+        }
+    });
+}
+
+/*  Every third element is selected, which roughly corresponds to a filter
+    with low selectivity.
+*/
+template<class V>
+void bench_compress_type(BenchResults& res)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    const unsigned size = V::length * bench_unroll;
+    auto src = std::make_shared<std::vector<E, aligned_allocator<E, 64>>>(size);
+    auto dst = std::make_shared<std::vector<E, aligned_allocator<E, 64>>>(size);
+    for (unsigned i = 0; i < size; ++i) {
+        (*src)[i] = E(i % 3);
+    }
+
+    bench_kernel<V>(res, "compress_store", [=](unsigned reps)
+    {
+        const E* ps = src->data();
+        E* pd = dst->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            E* p = pd;
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V x = load(ps + j * V::length);
+                p += compress_store(p, x, cmp_eq(x, V::zero()));
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "compress_store_scalar", [=](unsigned reps)
+    {
+        const E* ps = src->data();
+        E* pd = dst->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            E* p = pd;
+            for (unsigned j = 0; j < size; ++j) {
+                if (ps[j] == 0) {
+                    *p++ = ps[j];
+                }
+            }
+        }
+    });
+
+    bench_kernel<V>(res, "expand_load", [=](unsigned reps)
+    {
+        const E* ps = src->data();
+        const E* pd = dst->data();
+        for (unsigned i = 0; i < reps; ++i) {
+            bench_memory_barrier();
+            const E* p = pd;
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V m = load(ps + j * V::length);
+                auto mask = cmp_eq(m, V::zero());
+                V r = expand_load(p, mask);
+                p += V::length / 3;
+                bench_barrier(r);
+            }
+        }
+    });
+}
+
+template<unsigned B>
+void bench_memory_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_memory_type(res, (uint8<B>) make_uint(1));
+    bench_memory_type(res, (uint16<B/2>) make_uint(1));
+    bench_memory_type(res, (uint32<B/4>) make_uint(1));
+    bench_memory_type(res, (uint64<B/8>) make_uint(1));
+    bench_memory_type(res, (float32<B/4>) make_float(1.0f));
+    bench_memory_type(res, (float64<B/8>) make_float(1.0));
+
+    bench_gather_type<uint32<B/4>, uint32<B/4>>(res);
+    bench_gather_type<float32<B/4>, uint32<B/4>>(res);
+    bench_gather_type<uint64<B/8>, uint64<B/8>>(res);
+    bench_gather_type<float64<B/8>, uint64<B/8>>(res);
+    bench_compress_type<uint8<B>>(res);
+    bench_compress_type<uint16<B/2>>(res);
+    bench_compress_type<uint32<B/4>>(res);
+    bench_compress_type<uint64<B/8>>(res);
+    bench_compress_type<float32<B/4>>(res);
+}
+
+void bench_memory(BenchResults& res)
+{
+    bench_memory_n<16>(res);
+    bench_memory_n<32>(res);
+    bench_memory_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,131 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_shuffle_common(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    BENCH_OP1(res, V, splat<0>, a);
+    BENCH_OP1(res, V, splat<1>, a);
+}
+
+template<class V>
+void bench_shuffle8(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_shuffle_common(res, a);
+    BENCH_OP2(res, V, zip16_lo, a, a);
+    BENCH_OP2(res, V, zip16_hi, a, a);
+    BENCH_OP2(res, V, unzip16_lo, a, a);
+    BENCH_OP2(res, V, unzip16_hi, a, a);
+    BENCH_OP2(res, V, align16<5>, a, a);
+    BENCH_OP1(res, V, move16_l<5>, a);
+    BENCH_OP1(res, V, move16_r<5>, a);
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON
+    V mask;
+    mask = make_shuffle_bytes16_mask<3,2,1,0>(mask);
+    bench_op(res, "permute_bytes16", a, [=](const V& x)
+             { return permute_bytes16(x, mask); });
+    bench_op(res, "permute_zbytes16", a, [=](const V& x)
+             { return permute_zbytes16(x, mask); });
+    V b = a;
+    bench_op(res, "shuffle_bytes16", a, [=](const V& x)
+             { return shuffle_bytes16(x, b, mask); });
+    bench_op(res, "shuffle_zbytes16", a, [=](const V& x)
+             { return shuffle_zbytes16(x, b, mask); });
+#endif
+}
+
+template<class V>
+void bench_shuffle16(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_shuffle_common(res, a);
+    BENCH_OP2(res, V, zip8_lo, a, a);
+    BENCH_OP2(res, V, zip8_hi, a, a);
+    BENCH_OP2(res, V, unzip8_lo, a, a);
+    BENCH_OP2(res, V, unzip8_hi, a, a);
+    BENCH_OP2(res, V, align8<3>, a, a);
+    BENCH_OP1(res, V, move8_l<3>, a);
+    BENCH_OP1(res, V, move8_r<3>, a);
+    bench_op(res, "permute2", a, [](const V& x)
+             { return permute2<1,0>(x).eval(); });
+    bench_op(res, "permute4", a, [](const V& x)
+             { return permute4<3,2,1,0>(x).eval(); });
+}
+
+template<class V>
+void bench_shuffle32(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_shuffle_common(res, a);
+    BENCH_OP2(res, V, zip4_lo, a, a);
+    BENCH_OP2(res, V, zip4_hi, a, a);
+    BENCH_OP2(res, V, unzip4_lo, a, a);
+    BENCH_OP2(res, V, unzip4_hi, a, a);
+    BENCH_OP2(res, V, align4<1>, a, a);
+    BENCH_OP1(res, V, move4_l<1>, a);
+    BENCH_OP1(res, V, move4_r<1>, a);
+    bench_op(res, "permute2", a, [](const V& x)
+             { return permute2<1,0>(x).eval(); });
+    bench_op(res, "permute4", a, [](const V& x)
+             { return permute4<3,2,1,0>(x).eval(); });
+    V b = a;
+    bench_op(res, "shuffle2", a, [=](const V& x)
+             { return shuffle2<0,1,2,3>(x, b).eval(); });
+}
+
+template<class V>
+void bench_shuffle64(BenchResults& res, const V& a)
+{
+    using namespace simdpp;
+
+    bench_shuffle_common(res, a);
+    BENCH_OP2(res, V, zip2_lo, a, a);
+    BENCH_OP2(res, V, zip2_hi, a, a);
+    BENCH_OP2(res, V, unzip2_lo, a, a);
+    BENCH_OP2(res, V, unzip2_hi, a, a);
+    BENCH_OP2(res, V, align2<1>, a, a);
+    BENCH_OP1(res, V, move2_l<1>, a);
+    BENCH_OP1(res, V, move2_r<1>, a);
+    bench_op(res, "permute2", a, [](const V& x)
+             { return permute2<1,0>(x).eval(); });
+    V b = a;
+    bench_op(res, "shuffle1", a, [=](const V& x)
+             { return shuffle1<0,1>(x, b).eval(); });
+}
+
+template<unsigned B>
+void bench_shuffle_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_shuffle8(res, (uint8<B>) make_uint(1, 2, 3, 4));
+    bench_shuffle16(res, (uint16<B/2>) make_uint(1, 2, 3, 4));
+    bench_shuffle32(res, (uint32<B/4>) make_uint(1, 2, 3, 4));
+    bench_shuffle32(res, (float32<B/4>) make_float(1, 2, 3, 4));
+    bench_shuffle64(res, (uint64<B/8>) make_uint(1, 2));
+    bench_shuffle64(res, (float64<B/8>) make_float(1, 2));
+}
+
+void bench_shuffle(BenchResults& res)
+{
+    bench_shuffle_n<16>(res);
+    bench_shuffle_n<32>(res);
+    bench_shuffle_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
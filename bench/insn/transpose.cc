@@ -0,0 +1,49 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.h"
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void bench_transpose2(BenchResults& res, const V& a)
+{
+    bench_inplace<2>(res, "transpose2", a, [](V* x)
+                     { simdpp::transpose2(x[0], x[1]); });
+}
+
+template<class V>
+void bench_transpose4(BenchResults& res, const V& a)
+{
+    bench_inplace<4>(res, "transpose4", a, [](V* x)
+                     { simdpp::transpose4(x[0], x[1], x[2], x[3]); });
+}
+
+template<unsigned B>
+void bench_transpose_n(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_transpose4(res, (uint8<B>) make_uint(1, 2, 3, 4));
+    bench_transpose2(res, (uint16<B/2>) make_uint(1, 2, 3, 4));
+    bench_transpose4(res, (uint16<B/2>) make_uint(1, 2, 3, 4));
+    bench_transpose2(res, (uint32<B/4>) make_uint(1, 2, 3, 4));
+    bench_transpose4(res, (uint32<B/4>) make_uint(1, 2, 3, 4));
+    bench_transpose2(res, (uint64<B/8>) make_uint(1, 2));
+    bench_transpose2(res, (float32<B/4>) make_float(1, 2, 3, 4));
+    bench_transpose4(res, (float32<B/4>) make_float(1, 2, 3, 4));
+    bench_transpose2(res, (float64<B/8>) make_float(1, 2));
+}
+
+void bench_transpose(BenchResults& res)
+{
+    bench_transpose_n<16>(res);
+    bench_transpose_n<32>(res);
+    bench_transpose_n<64>(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
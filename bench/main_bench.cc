@@ -0,0 +1,69 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "utils/bench_registration.h"
+#include "utils/bench_results.h"
+#include <simdpp/setup_arch.h>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#if __linux__
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+
+inline simdpp::Arch get_arch() { return simdpp::get_arch_linux_cpuinfo(); }
+
+#elif SIMDPP_X86
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+inline simdpp::Arch get_arch() { return simdpp::get_arch_raw_cpuid(); }
+#else
+#error "Can't detect the instruction sets on this platform"
+#endif
+
+/*  Runs the benchmarks for each instruction set that the benchmark has been
+    compiled for and that is supported by the current processor. The results
+    are written to the standard output as a JSON array containing one object
+    per instruction set.
+
+    Usage: bench [filter]
+
+    If filter is given, only the operations whose names contain it are
+    benchmarked.
+*/
+int main(int argc, char* argv[])
+{
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [filter]\n";
+        return EXIT_FAILURE;
+    }
+    std::string filter = argc == 2 ? argv[1] : "";
+
+    simdpp::Arch current_arch = get_arch();
+    const auto& arch_list = BenchRegistration::arch_list();
+
+    std::ostream& out = std::cout;
+    bool first = true;
+
+    out << "[\n";
+    for (auto it = arch_list.begin(); it != arch_list.end(); it++) {
+        if (!simdpp::test_arch_subset(current_arch, it->required_arch)) {
+            std::cerr << "Not running: " << it->arch << std::endl;
+            continue;
+        }
+        std::cerr << "Running: " << it->arch << std::endl;
+
+        BenchResults results(it->arch, filter);
+        it->run(results);
+
+        if (!first)
+            out << ",\n";
+        first = false;
+        results.write_json(out);
+    }
+    out << "\n]\n";
+}
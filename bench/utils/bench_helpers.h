@@ -0,0 +1,289 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_HELPERS_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_HELPERS_H
+
+#include <simdpp/simd.h>
+#include "bench_results.h"
+#include <string>
+#include <type_traits>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The optimization barriers below make the compiler believe that the value
+    has been read and modified, so that the benchmarked operation can neither
+    be hoisted out of the loop nor eliminated. The barriers themselves don't
+    emit any instructions, except in the generic case where the value is
+    forced to memory.
+*/
+template<class T> SIMDPP_INL
+void bench_clobber(T& v)
+{
+#if defined(__GNUC__)
+    asm volatile("" : "+m"(v));
+#else
+    volatile T t = v;
+    v = t;
+#endif
+}
+
+#if defined(__GNUC__)
+#define LIBSIMDPP_BENCH_CLOBBER_REG(T, C)                               \
+    SIMDPP_INL void bench_clobber(T& v) { asm volatile("" : "+" C(v)); }
+
+#if SIMDPP_USE_SSE2
+LIBSIMDPP_BENCH_CLOBBER_REG(__m128, "x")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m128d, "x")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m128i, "x")
+#endif
+#if SIMDPP_USE_AVX
+LIBSIMDPP_BENCH_CLOBBER_REG(__m256, "x")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m256d, "x")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m256i, "x")
+#endif
+#if SIMDPP_USE_AVX512
+LIBSIMDPP_BENCH_CLOBBER_REG(__m512, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m512d, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__m512i, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__mmask16, "r")
+#endif
+#if SIMDPP_USE_NEON
+LIBSIMDPP_BENCH_CLOBBER_REG(uint8x16_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(int8x16_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(uint16x8_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(int16x8_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(uint32x4_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(int32x4_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(uint64x2_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(int64x2_t, "w")
+LIBSIMDPP_BENCH_CLOBBER_REG(float32x4_t, "w")
+#endif
+#if SIMDPP_USE_ALTIVEC
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector uint8_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector int8_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector uint16_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector int16_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector uint32_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector int32_t, "v")
+LIBSIMDPP_BENCH_CLOBBER_REG(__vector float, "v")
+#endif
+#undef LIBSIMDPP_BENCH_CLOBBER_REG
+#endif
+
+// Clobbers each native vector of a (possibly multi-register) vector
+template<class V> SIMDPP_INL
+void bench_barrier(V& v, std::true_type /* is_vector */)
+{
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        typename V::base_vector_type::native_type n = v.vec(i);
+        bench_clobber(n);
+        v.vec(i) = n;
+    }
+}
+
+template<class T> SIMDPP_INL
+void bench_barrier(T& v, std::false_type /* is_vector */)
+{
+    bench_clobber(v);
+}
+
+template<class T> SIMDPP_INL
+void bench_barrier(T& v)
+{
+    bench_barrier(v, std::integral_constant<bool, simdpp::is_vector<T>::value>());
+}
+
+// Evaluates a possibly unevaluated expression
+template<class T> SIMDPP_INL
+auto bench_eval(const T& v) -> decltype(v.eval()) { return v.eval(); }
+
+template<class T> SIMDPP_INL
+typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+    bench_eval(const T& v) { return v; }
+
+// Returns the name of the vector type, e.g. "uint32x4"
+template<class V>
+std::string bench_type_name()
+{
+    std::string r;
+    switch (V::type_tag) {
+    case SIMDPP_TAG_MASK_INT:   r = "mask_int"; break;
+    case SIMDPP_TAG_MASK_FLOAT: r = "mask_float"; break;
+    case SIMDPP_TAG_INT:        r = "int"; break;
+    case SIMDPP_TAG_UINT:       r = "uint"; break;
+    case SIMDPP_TAG_FLOAT:      r = "float"; break;
+    }
+    return r + std::to_string(V::num_bits) + "x" + std::to_string(V::length);
+}
+
+// The number of independent operations executed per repetition when
+// measuring throughput. Enough to saturate all execution ports.
+static const unsigned bench_unroll = 8;
+
+// The minimum duration of a single timed run. Shorter runs are dominated by
+// the timer resolution and the call overhead.
+static const std::int64_t bench_min_run_ns = 100000;
+static const unsigned bench_num_runs = 5;
+
+/*  Measures a benchmark kernel. When called with an argument @a reps, the
+    kernel must execute the measured operation reps * ops_per_rep times.
+
+    The kernel is a template parameter rather than std::function, because
+    the latter may store the closure in memory that is not sufficiently
+    aligned for the captured vectors.
+*/
+template<class K>
+BenchMeasurement bench_measure(const K& kernel, unsigned ops_per_rep,
+                               unsigned length)
+{
+    // warm up and calibrate the number of repetitions
+    unsigned reps = 64;
+    while (reps < (1u << 30)) {
+        BenchSample start = bench_sample();
+        kernel(reps);
+        BenchSample end = bench_sample();
+        if (end.ns - start.ns >= bench_min_run_ns)
+            break;
+        reps *= 2;
+    }
+
+    // take the fastest of several runs to reduce the influence of preemption
+    std::int64_t best_ns = 0;
+    std::uint64_t best_cycles = 0;
+    for (unsigned i = 0; i < bench_num_runs; ++i) {
+        BenchSample start = bench_sample();
+        kernel(reps);
+        BenchSample end = bench_sample();
+        if (i == 0 || end.ns - start.ns < best_ns) {
+            best_ns = end.ns - start.ns;
+            best_cycles = end.cycles - start.cycles;
+        }
+    }
+
+    double ops = double(reps) * ops_per_rep;
+    BenchMeasurement m;
+    m.valid = true;
+    m.ns_per_op = best_ns / ops;
+    m.cycles_per_op = best_cycles / ops;
+    m.cycles_per_element = m.cycles_per_op / length;
+    return m;
+}
+
+template<class V, class F>
+BenchMeasurement bench_latency(const V& a, F f, std::true_type /* R == V */)
+{
+    auto kernel = [=](unsigned reps)
+    {
+        V x = a;
+        bench_barrier(x);
+        for (unsigned i = 0; i < reps; ++i) {
+            x = bench_eval(f(x));
+        }
+        bench_barrier(x);
+    };
+    return bench_measure(kernel, 1, V::length);
+}
+
+template<class V, class F>
+BenchMeasurement bench_latency(const V&, F, std::false_type /* R == V */)
+{
+    return BenchMeasurement();
+}
+
+/*  Benchmarks an operation @a f taking a single argument of type V. The
+    throughput is measured by executing bench_unroll independent operations
+    per iteration. If the result type of the operation is the same as its
+    argument type, the latency is measured by executing a chain of dependent
+    operations.
+*/
+template<class V, class F>
+void bench_op(BenchResults& res, const char* op, const V& a, F f)
+{
+    if (!res.enabled(op))
+        return;
+
+    using R = typename std::decay<decltype(bench_eval(f(a)))>::type;
+
+    auto kernel = [=](unsigned reps)
+    {
+        for (unsigned i = 0; i < reps; ++i) {
+            for (unsigned j = 0; j < bench_unroll; ++j) {
+                V x = a;
+                bench_barrier(x);
+                R r = bench_eval(f(x));
+                bench_barrier(r);
+            }
+        }
+    };
+
+    using is_chainable = std::integral_constant<bool, std::is_same<R, V>::value>;
+
+    res.add(op, bench_type_name<V>(), V::length, V::length_bytes,
+            bench_measure(kernel, bench_unroll, V::length),
+            bench_latency(a, f, is_chainable()));
+}
+
+/*  Benchmarks an operation @a f that modifies an array of K vectors in place,
+    e.g. transpose. Only the latency is measured, as the consecutive
+    invocations depend on each other.
+*/
+template<unsigned K, class V, class F>
+void bench_inplace(BenchResults& res, const char* op, const V& a, F f)
+{
+    if (!res.enabled(op))
+        return;
+
+    auto kernel = [=](unsigned reps)
+    {
+        V x[K];
+        for (unsigned j = 0; j < K; ++j) {
+            x[j] = a;
+            bench_barrier(x[j]);
+        }
+        for (unsigned i = 0; i < reps; ++i) {
+            f(x);
+        }
+        for (unsigned j = 0; j < K; ++j) {
+            bench_barrier(x[j]);
+        }
+    };
+
+    res.add(op, bench_type_name<V>(), V::length, V::length_bytes,
+            BenchMeasurement(), bench_measure(kernel, 1, V::length));
+}
+
+/*  Benchmarks a raw throughput kernel, used for memory operations. The kernel
+    must execute the operation reps * bench_unroll times.
+*/
+template<class V, class K>
+void bench_kernel(BenchResults& res, const char* op, const K& kernel)
+{
+    if (!res.enabled(op))
+        return;
+
+    res.add(op, bench_type_name<V>(), V::length, V::length_bytes,
+            bench_measure(kernel, bench_unroll, V::length), BenchMeasurement());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+/*  Helper macros to benchmark unary and binary operations of type T. The
+    second operand of binary operations is fixed, so that the latency chain
+    goes only through the first operand.
+*/
+#define BENCH_OP1(R, T, OP, A)                                          \
+    bench_op(R, #OP, T(A), [](const T& x) { return bench_eval(OP(x)); })
+
+#define BENCH_OP2(R, T, OP, A, B)                                       \
+do {                                                                    \
+    T b_ = B;                                                           \
+    bench_op(R, #OP, T(A),                                              \
+             [=](const T& x) { return bench_eval(OP(x, b_)); });        \
+} while (0)
+
+#endif
@@ -0,0 +1,37 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_REGISTRATION_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_REGISTRATION_H
+
+#include "bench_results.h"
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+
+/*  Tracks the benchmark entry points of each instruction set the benchmark is
+    compiled for. Each multiarch copy of bench/insn/bench.cc registers itself
+    through a static object of this type.
+*/
+class BenchRegistration {
+public:
+
+    using BenchFunction = void(*)(BenchResults&);
+
+    struct Arch {
+        BenchFunction run;
+        const char* arch;
+        simdpp::Arch required_arch;
+    };
+    using ArchList = std::vector<Arch>;
+
+    BenchRegistration(BenchFunction fn, const char* arch,
+                      simdpp::Arch required_arch);
+
+    static ArchList& arch_list();
+};
+
+#endif
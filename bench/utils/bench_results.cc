@@ -0,0 +1,123 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench_results.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define LIBSIMDPP_BENCH_HAS_CYCLE_COUNTER 1
+#else
+#define LIBSIMDPP_BENCH_HAS_CYCLE_COUNTER 0
+#endif
+
+BenchSample bench_sample()
+{
+    using clock = std::chrono::steady_clock;
+    BenchSample s;
+    s.ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                clock::now().time_since_epoch()).count();
+#if LIBSIMDPP_BENCH_HAS_CYCLE_COUNTER
+    s.cycles = __rdtsc();
+#else
+    s.cycles = 0;
+#endif
+    return s;
+}
+
+namespace {
+
+void write_number(std::ostream& out, double v, bool valid)
+{
+    if (valid) {
+        out << v;
+    } else {
+        out << "null";
+    }
+}
+
+void write_measurement(std::ostream& out, const BenchMeasurement& m)
+{
+    if (!m.valid) {
+        out << "null";
+        return;
+    }
+    out << "{ \"ns_per_op\": ";
+    write_number(out, m.ns_per_op, true);
+    out << ", \"cycles_per_op\": ";
+    write_number(out, m.cycles_per_op, LIBSIMDPP_BENCH_HAS_CYCLE_COUNTER);
+    out << ", \"cycles_per_element\": ";
+    write_number(out, m.cycles_per_element, LIBSIMDPP_BENCH_HAS_CYCLE_COUNTER);
+    out << " }";
+}
+
+void write_string(std::ostream& out, const std::string& s)
+{
+    out << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+bool BenchResults::enabled(const char* op) const
+{
+    if (filter_.empty())
+        return true;
+    return std::string(op).find(filter_) != std::string::npos;
+}
+
+void BenchResults::add(const char* op, const std::string& type,
+                       unsigned length, unsigned bytes,
+                       const BenchMeasurement& throughput,
+                       const BenchMeasurement& latency)
+{
+    Result r;
+    r.op = op;
+    r.type = type;
+    r.length = length;
+    r.bytes = bytes;
+    r.throughput = throughput;
+    r.latency = latency;
+    results_.push_back(r);
+}
+
+void BenchResults::write_json(std::ostream& out) const
+{
+    out << "{\n";
+    out << "  \"arch\": ";
+    write_string(out, arch_);
+    out << ",\n";
+    out << "  \"results\": [";
+    for (std::size_t i = 0; i < results_.size(); ++i) {
+        const Result& r = results_[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    { \"op\": ";
+        write_string(out, r.op);
+        out << ", \"type\": ";
+        write_string(out, r.type);
+        out << ", \"length\": " << r.length;
+        out << ", \"bytes\": " << r.bytes;
+        out << ",\n      \"throughput\": ";
+        write_measurement(out, r.throughput);
+        out << ",\n      \"latency\": ";
+        write_measurement(out, r.latency);
+        out << " }";
+    }
+    out << "\n  ]\n";
+    out << "}";
+}
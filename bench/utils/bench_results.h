@@ -0,0 +1,80 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// A point in time as measured by the wall clock and the cycle counter
+struct BenchSample {
+    std::int64_t ns;
+    std::uint64_t cycles;
+};
+
+/// Returns the current time. The cycle counter is zero if not available.
+BenchSample bench_sample();
+
+struct BenchMeasurement {
+    bool valid = false;
+    double ns_per_op = 0;
+    // Zero if the cycle counter is not available on the current platform.
+    // On x86 these are TSC reference cycles which differ from the core cycles
+    // whenever the core frequency differs from the nominal one.
+    double cycles_per_op = 0;
+    double cycles_per_element = 0;
+};
+
+/*  Holds the benchmark results for a single instruction set. The measurements
+    themselves are done in the instruction set specific code (see
+    bench_helpers.h), as the benchmark kernels can't be passed through
+    type-erased wrappers without losing the alignment of the captured vectors.
+*/
+class BenchResults {
+public:
+
+    struct Result {
+        std::string op;
+        std::string type;
+        unsigned length;
+        unsigned bytes;
+        BenchMeasurement throughput;
+        BenchMeasurement latency;
+    };
+
+    BenchResults(const char* arch, const std::string& filter) :
+        arch_{arch}, filter_{filter}
+    {
+    }
+
+    /// Returns true if the operation @a op should be benchmarked
+    bool enabled(const char* op) const;
+
+    /** Records the measurements of an operation. Invalid measurements are
+        written as null.
+    */
+    void add(const char* op, const std::string& type,
+             unsigned length, unsigned bytes,
+             const BenchMeasurement& throughput,
+             const BenchMeasurement& latency);
+
+    const char* arch() const { return arch_; }
+    const std::vector<Result>& results() const { return results_; }
+
+    /// Writes the results as a JSON object
+    void write_json(std::ostream& out) const;
+
+private:
+    const char* arch_;
+    std::string filter_;
+    std::vector<Result> results_;
+};
+
+#endif
@@ -111,6 +111,27 @@ set(SIMDPP_X86_SSE4_1_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_SSE4_2")
+if(NOT MSVC)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "-msse4.2 -DSIMDPP_ARCH_X86_SSE4_2")
+else()
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "/arch:SSE2 -DSIMDPP_ARCH_X86_SSE4_2")
+endif()
+set(SIMDPP_X86_SSE4_2_SUFFIX "-x86_sse4_2")
+set(SIMDPP_X86_SSE4_2_TEST_CODE
+    "#include <nmmintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[16];
+            __m128i align;
+        };
+        __m128i one = _mm_load_si128((__m128i*)(a));
+        one = _mm_cmpgt_epi64(one, one);
+        _mm_store_si128((__m128i*)(a), one);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_AVX")
 if(NOT MSVC)
     set(SIMDPP_X86_AVX_CXX_FLAGS "-mavx -DSIMDPP_ARCH_X86_AVX")
@@ -153,6 +174,27 @@ set(SIMDPP_X86_AVX2_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+if(NOT MSVC)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-mf16c -DSIMDPP_ARCH_X86_F16C")
+else()
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:AVX -DSIMDPP_ARCH_X86_F16C")
+endif()
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile float a[4];
+            __m128 align;
+        };
+        __m128 one = _mm_load_ps((float*)(a));
+        one = _mm_cvtph_ps(_mm_cvtps_ph(one, 0));
+        _mm_store_ps((float*)(a), one);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_FMA3")
 if(NOT MSVC)
     set(SIMDPP_X86_FMA3_CXX_FLAGS "-mfma -DSIMDPP_ARCH_X86_FMA3")
@@ -215,7 +257,7 @@ set(SIMDPP_X86_XOP_TEST_CODE
 
 list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512F")
 if(NOT MSVC)
-    set(SIMDPP_X86_AVX512F_CXX_FLAGS "-mavx512f -DSIMDPP_ARCH_X86_AVX512F")
+    set(SIMDPP_X86_AVX512F_CXX_FLAGS "-mavx512f -mfma -DSIMDPP_ARCH_X86_AVX512F")
 else()
     set(SIMDPP_X86_AVX512F_CXX_FLAGS "/arch:AVX -DSIMDPP_ARCH_X86_AVX512F") #unsupported
 endif()
@@ -234,6 +276,71 @@ set(SIMDPP_X86_AVX512F_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BW")
+if(NOT MSVC)
+    set(SIMDPP_X86_AVX512BW_CXX_FLAGS "-mavx512f -mavx512bw -mfma -DSIMDPP_ARCH_X86_AVX512BW")
+else()
+    set(SIMDPP_X86_AVX512BW_CXX_FLAGS "/arch:AVX -DSIMDPP_ARCH_X86_AVX512BW") #unsupported
+endif()
+set(SIMDPP_X86_AVX512BW_SUFFIX "-x86_avx512bw")
+set(SIMDPP_X86_AVX512BW_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[64];
+            __m512i align;
+        };
+        __m512i one = _mm512_load_si512((__m512i*)a);
+        one = _mm512_add_epi16(one, one);
+        _mm512_store_si512((__m512i*)a, one);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512DQ")
+if(NOT MSVC)
+    set(SIMDPP_X86_AVX512DQ_CXX_FLAGS "-mavx512f -mavx512dq -mfma -DSIMDPP_ARCH_X86_AVX512DQ")
+else()
+    set(SIMDPP_X86_AVX512DQ_CXX_FLAGS "/arch:AVX -DSIMDPP_ARCH_X86_AVX512DQ") #unsupported
+endif()
+set(SIMDPP_X86_AVX512DQ_SUFFIX "-x86_avx512dq")
+set(SIMDPP_X86_AVX512DQ_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[64];
+            __m512i align;
+        };
+        __m512i one = _mm512_load_si512((__m512i*)a);
+        __m512d d = _mm512_cvtepi64_pd(one);
+        _mm512_store_si512((__m512i*)a, _mm512_cvttpd_epi64(d));
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BF16")
+if(NOT MSVC)
+    set(SIMDPP_X86_AVX512BF16_CXX_FLAGS "-mavx512f -mavx512bf16 -mfma -DSIMDPP_ARCH_X86_AVX512BF16")
+else()
+    set(SIMDPP_X86_AVX512BF16_CXX_FLAGS "/arch:AVX -DSIMDPP_ARCH_X86_AVX512BF16") #unsupported
+endif()
+set(SIMDPP_X86_AVX512BF16_SUFFIX "-x86_avx512bf16")
+set(SIMDPP_X86_AVX512BF16_TEST_CODE
+    "#include <immintrin.h>
+    int main()
+    {
+        union {
+            volatile char a[64];
+            __m512 align;
+        };
+        __m512 one = _mm512_load_ps((float*)a);
+        __m256bh h = _mm512_cvtneps_pbh(one);
+        __m512bh hh = (__m512bh) _mm512_broadcast_i64x4((__m256i) h);
+        one = _mm512_dpbf16_ps(one, hh, hh);
+        _mm512_store_ps((float*)a, one);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon -DSIMDPP_ARCH_ARM_NEON")
 set(SIMDPP_ARM_NEON_SUFFIX "-arm_neon")
@@ -343,8 +450,9 @@ endfunction()
 #   identifiers is supplied.
 #
 #   The following identifiers are currently supported:
-#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1, X86_AVX, X86_AVX2, X86_FMA3,
-#   X86_FMA4, X86_XOP, ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON
+#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1, X86_SSE4_2, X86_AVX, X86_AVX2,
+#   X86_F16C, X86_FMA3, X86_FMA4, X86_AVX512F, X86_AVX512BW, X86_AVX512DQ,
+#   X86_AVX512BF16, X86_XOP, ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON
 #
 function(simdpp_multiarch FILE_LIST_VAR SRC_FILE)
     if(NOT EXISTS "${CMAKE_CURRENT_SOURCE_DIR}/${SRC_FILE}")
@@ -404,12 +512,21 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
     if(DEFINED ARCH_SUPPORTED_X86_SSE4_1)
         list(APPEND ALL_ARCHS "X86_SSE4_1")
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_SSE4_2)
+        list(APPEND ALL_ARCHS "X86_SSE4_2")
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX)
         list(APPEND ALL_ARCHS "X86_AVX")
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX2)
         list(APPEND ALL_ARCHS "X86_AVX2")
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_F16C)
+        list(APPEND ALL_ARCHS "X86_F16C")
+        if(DEFINED ARCH_SUPPORTED_X86_AVX)
+            list(APPEND ALL_ARCHS "X86_AVX,X86_F16C")
+        endif()
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_FMA3)
         list(APPEND ALL_ARCHS "X86_FMA3")
         if(DEFINED ARCH_SUPPORTED_X86_AVX)
@@ -425,6 +542,15 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
     if(DEFINED ARCH_SUPPORTED_X86_AVX512F)
         list(APPEND ALL_ARCHS "X86_AVX512F")
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_AVX512BW)
+        list(APPEND ALL_ARCHS "X86_AVX512BW")
+    endif()
+    if(DEFINED ARCH_SUPPORTED_X86_AVX512DQ)
+        list(APPEND ALL_ARCHS "X86_AVX512DQ")
+    endif()
+    if(DEFINED ARCH_SUPPORTED_X86_AVX512BF16)
+        list(APPEND ALL_ARCHS "X86_AVX512BF16")
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_XOP)
         list(APPEND ALL_ARCHS "X86_XOP")
         if(DEFINED ARCH_SUPPORTED_X86_AVX)
@@ -21,6 +21,60 @@ namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
 #endif
 
+/** Compares the values of two signed int64x2 vectors for less-than or equal
+
+    @code
+    r0 = (a0 <= b0) ? 0xffffffffffffffff : 0x0
+    ...
+    rN = (aN <= bN) ? 0xffffffffffffffff : 0x0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 7}
+    @icost{SSE4.2-AVX2, 2}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 14}
+    @icost{SSE4.2-AVX, 4}
+    @icost{AVX2, 2}
+    @icost{XOP, NEON64, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+mask_int64<N, mask_int64<N>> cmp_le(const int64<N,E1>& a,
+                                    const int64<N,E2>& b)
+{
+    return detail::insn::i_cmp_le(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_le, mask_int64, int64)
+
+/** Compares the values of two unsigned int64x2 vectors for less-than or equal
+
+    @code
+    r0 = (a0 <= b0) ? 0xffffffffffffffff : 0x0
+    ...
+    rN = (aN <= bN) ? 0xffffffffffffffff : 0x0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 7}
+    @icost{SSE4.2-AVX2, 4-5}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 14}
+    @icost{SSE4.2-AVX, 8-9}
+    @icost{AVX2, 4-5}
+    @icost{XOP, NEON64, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+mask_int64<N, mask_int64<N>> cmp_le(const uint64<N,E1>& a,
+                                    const uint64<N,E2>& b)
+{
+    return detail::insn::i_cmp_le(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_le, mask_int64, uint64)
+
 /** Compares the values of two float32x4 vectors for less-than or equal
 
     @code
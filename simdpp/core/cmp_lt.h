@@ -159,6 +159,57 @@ mask_int32<N, mask_int32<N>> cmp_lt(const uint32<N,E1>& a,
 
 SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_lt, mask_int32, uint32)
 
+/** Compares the values of two signed int64x2 vectors for less-than
+
+    @code
+    r0 = (a0 < b0) ? 0xffffffffffffffff : 0x0
+    ...
+    rN = (aN < bN) ? 0xffffffffffffffff : 0x0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 6}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 12}
+    @icost{SSE4.2-AVX, XOP, NEON64, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+mask_int64<N, mask_int64<N>> cmp_lt(const int64<N,E1>& a,
+                                    const int64<N,E2>& b)
+{
+    return detail::insn::i_cmp_lt(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_lt, mask_int64, int64)
+
+/** Compares the values of two unsigned int64x2 vectors for less-than
+
+    @code
+    r0 = (a0 < b0) ? 0xffffffffffffffff : 0x0
+    ...
+    rN = (aN < bN) ? 0xffffffffffffffff : 0x0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 6}
+    @icost{SSE4.2-AVX2, 3-4}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 12}
+    @icost{SSE4.2-AVX, 6-7}
+    @icost{AVX2, 3-4}
+    @icost{XOP, NEON64, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+mask_int64<N, mask_int64<N>> cmp_lt(const uint64<N,E1>& a,
+                                    const uint64<N,E2>& b)
+{
+    return detail::insn::i_cmp_lt(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(cmp_lt, mask_int64, uint64)
+
 /** Compares the values of two float32x4 vectors for less-than
 
     @code
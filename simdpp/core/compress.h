@@ -0,0 +1,205 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Moves the elements that are selected by @a mask to the beginning of the
+    vector, preserving their order. The remaining elements are set to zero.
+
+    @code
+    j = 0
+    for i in [0..N) :
+        if (mask[i]) r[j++] = a[i]
+    r[j..N) = 0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE3, 2*N}
+    @icost{SSSE3-AVX2, NEON, ALTIVEC, 4-8}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE3, 4*N}
+    @icost{SSSE3-AVX, NEON, ALTIVEC, 2*N}
+    @icost{AVX2, 4-20}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N> compress(const uint8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    return detail::insn::i_compress(a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int8<N> compress(const int8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    return (int8<N>) detail::insn::i_compress(uint8<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N> compress(const uint16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    return detail::insn::i_compress(a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N> compress(const int16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    return (int16<N>) detail::insn::i_compress(uint16<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N> compress(const uint32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    return detail::insn::i_compress(a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N> compress(const int32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    return (int32<N>) detail::insn::i_compress(uint32<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> compress(const uint64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    return detail::insn::i_compress(a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N> compress(const int64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    return (int64<N>) detail::insn::i_compress(uint64<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N> compress(const float32<N,E1>& a, const mask_float32<N,E2>& mask)
+{
+    uint32<N> r = detail::insn::i_compress(bit_cast<uint32<N>>(a.eval()),
+                                           mask_int32<N>(mask.eval()));
+    return bit_cast<float32<N>>(r);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N> compress(const float64<N,E1>& a, const mask_float64<N,E2>& mask)
+{
+    uint64<N> r = detail::insn::i_compress(bit_cast<uint64<N>>(a.eval()),
+                                           mask_int64<N>(mask.eval()));
+    return bit_cast<float64<N>>(r);
+}
+/// @}
+
+/// @{
+/** Stores the elements that are selected by @a mask to consecutive locations
+    starting at @a p, preserving their order. Returns the number of stored
+    elements. The memory past the last stored element is not accessed. The
+    pointer does not need to be aligned.
+
+    @code
+    j = 0
+    for i in [0..N) :
+        if (mask[i]) p[j++] = a[i]
+    return j
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE3, 2*N}
+    @icost{SSSE3-AVX2, NEON, ALTIVEC, 5-9}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE3, 4*N}
+    @icost{SSSE3-AVX, NEON, ALTIVEC, 10-18}
+    @icost{AVX2, 5-20}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(uint8_t* p, const uint8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(p, a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(int8_t* p, const int8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint8_t*>(p),
+                                          uint8<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(uint16_t* p, const uint16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(p, a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(int16_t* p, const int16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint16_t*>(p),
+                                          uint16<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(uint32_t* p, const uint32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(p, a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(int32_t* p, const int32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint32_t*>(p),
+                                          uint32<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(uint64_t* p, const uint64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(p, a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(int64_t* p, const int64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint64_t*>(p),
+                                          uint64<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(float* p, const float32<N,E1>& a, const mask_float32<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint32_t*>(p),
+                                          bit_cast<uint32<N>>(a.eval()),
+                                          mask_int32<N>(mask.eval()));
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+unsigned compress_store(double* p, const float64<N,E1>& a, const mask_float64<N,E2>& mask)
+{
+    return detail::insn::i_compress_store(reinterpret_cast<uint64_t*>(p),
+                                          bit_cast<uint64<N>>(a.eval()),
+                                          mask_int64<N>(mask.eval()));
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -59,6 +59,10 @@ template<unsigned M, unsigned N> SIMDPP_INL
 float32<M> vec_extract(const float32<N>& a, unsigned n) { return vec_extract_impl<float32<M>>(a, n); }
 template<unsigned M, unsigned N> SIMDPP_INL
 float64<M> vec_extract(const float64<N>& a, unsigned n) { return vec_extract_impl<float64<M>>(a, n); }
+template<unsigned M, unsigned N> SIMDPP_INL
+float16<M> vec_extract(const float16<N>& a, unsigned n) { return vec_extract_impl<float16<M>>(a, n); }
+template<unsigned M, unsigned N> SIMDPP_INL
+bfloat16<M> vec_extract(const bfloat16<N>& a, unsigned n) { return vec_extract_impl<bfloat16<M>>(a, n); }
 
 
 } // namespace detail
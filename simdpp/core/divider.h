@@ -0,0 +1,233 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+#define LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+
+/*  The magic numbers are computed as described in "Division by Invariant
+    Integers using Multiplication" by T. Granlund and P. L. Montgomery. The
+    formulation follows libdivide: the quotient is computed as
+
+    unsigned:   q = mulhi(n, m) [+ ((n - q) >> 1)] >> s
+    signed:     q = mulhi(n, m) [+ n] >> s, then rounded towards zero
+
+    where the bracketed term is used only if divider_add is set in the flags.
+    Powers of two are handled separately with the magic number being zero.
+*/
+static const uint8_t divider_shift_mask = 0x3f;
+static const uint8_t divider_add = 0x40;
+static const uint8_t divider_negative = 0x80;
+
+constexpr unsigned divider_floor_log2(uint32_t x)
+{
+    return x <= 1 ? 0 : 1 + divider_floor_log2(x >> 1);
+}
+
+constexpr bool divider_is_pow2(uint32_t d)
+{
+    return (d & (d - 1)) == 0;
+}
+
+// Whether the magic number for an unsigned divisor fits in W bits without the
+// additional correction step. m = 2^(W+log) / d and r = 2^(W+log) % d
+constexpr bool divider_u_fits(uint32_t d, unsigned log, uint64_t r)
+{
+    return d - r < (uint64_t(1) << log);
+}
+
+constexpr uint32_t divider_u_magic_impl(uint32_t d, unsigned log, uint64_t m,
+                                        uint64_t r)
+{
+    return divider_u_fits(d, log, r) ?
+                uint32_t(m + 1) :
+                uint32_t(2 * m + (2 * r >= d ? 1 : 0) + 1);
+}
+
+constexpr uint32_t divider_u_magic(uint32_t d, unsigned width)
+{
+    return divider_is_pow2(d) ? 0 :
+        divider_u_magic_impl(d, divider_floor_log2(d),
+                             (uint64_t(1) << (width + divider_floor_log2(d))) / d,
+                             (uint64_t(1) << (width + divider_floor_log2(d))) % d);
+}
+
+constexpr uint8_t divider_u_flags(uint32_t d, unsigned width)
+{
+    return uint8_t(divider_floor_log2(d) |
+        ((divider_is_pow2(d) ||
+          divider_u_fits(d, divider_floor_log2(d),
+                         (uint64_t(1) << (width + divider_floor_log2(d))) % d)) ?
+                0 : divider_add));
+}
+
+constexpr uint32_t divider_abs(int32_t d)
+{
+    return d < 0 ? uint32_t(0) - uint32_t(d) : uint32_t(d);
+}
+
+// m = 2^(31+log) / |d| and r = 2^(31+log) % |d|
+constexpr int32_t divider_s_magic_impl(bool negative, uint32_t magic)
+{
+    return int32_t(negative ? uint32_t(0) - magic : magic);
+}
+
+constexpr int32_t divider_s_magic_impl(int32_t d, uint32_t ad, unsigned log,
+                                       uint64_t m, uint64_t r)
+{
+    return divider_s_magic_impl(d < 0,
+        divider_u_fits(ad, log, r) ?
+            uint32_t(m + 1) :
+            uint32_t(2 * m + (2 * r >= ad ? 1 : 0) + 1));
+}
+
+constexpr int32_t divider_s_magic(int32_t d)
+{
+    return divider_is_pow2(divider_abs(d)) ? 0 :
+        divider_s_magic_impl(d, divider_abs(d),
+            divider_floor_log2(divider_abs(d)),
+            (uint64_t(1) << (31 + divider_floor_log2(divider_abs(d)))) / divider_abs(d),
+            (uint64_t(1) << (31 + divider_floor_log2(divider_abs(d)))) % divider_abs(d));
+}
+
+constexpr uint8_t divider_s_flags_impl(uint32_t ad, unsigned log, bool negative)
+{
+    return uint8_t((negative ? divider_negative : 0) |
+        (divider_is_pow2(ad) ? log :
+         divider_u_fits(ad, log, (uint64_t(1) << (31 + log)) % ad) ?
+            log - 1 : (log | divider_add)));
+}
+
+constexpr uint8_t divider_s_flags(int32_t d)
+{
+    return divider_s_flags_impl(divider_abs(d), divider_floor_log2(divider_abs(d)),
+                                d < 0);
+}
+
+} // namespace detail
+
+/** Precomputed representation of an integer divisor. Dividing a vector by a
+    divider requires only a multiplication, a few additions and shifts
+    instead of a full division. The construction of the divider is relatively
+    expensive, thus it should be reused for many divisions by the same value.
+
+    Only divider<uint16_t>, divider<uint32_t> and divider<int32_t> are
+    supported. The divisor must not be zero.
+
+    See also div, mod and divmod.
+*/
+template<class T> class divider;
+
+template<>
+class divider<uint16_t> {
+public:
+    using element_type = uint16_t;
+
+    constexpr divider(uint16_t d) :
+        d_(d),
+        magic_(uint16_t(detail::divider_u_magic(d, 16))),
+        flags_(detail::divider_u_flags(d, 16))
+    {}
+
+    /// Returns the divisor
+    constexpr uint16_t divisor() const { return d_; }
+
+    /// Returns the magic number. Zero if the divisor is a power of two.
+    constexpr uint16_t magic() const { return magic_; }
+
+    /// Returns the final shift amount
+    constexpr unsigned shift() const { return flags_ & detail::divider_shift_mask; }
+
+    /// Returns true if the additional correction step is needed
+    constexpr bool is_add() const { return (flags_ & detail::divider_add) != 0; }
+
+private:
+    uint16_t d_;
+    uint16_t magic_;
+    uint8_t flags_;
+};
+
+template<>
+class divider<uint32_t> {
+public:
+    using element_type = uint32_t;
+
+    constexpr divider(uint32_t d) :
+        d_(d),
+        magic_(detail::divider_u_magic(d, 32)),
+        flags_(detail::divider_u_flags(d, 32))
+    {}
+
+    /// Returns the divisor
+    constexpr uint32_t divisor() const { return d_; }
+
+    /// Returns the magic number. Zero if the divisor is a power of two.
+    constexpr uint32_t magic() const { return magic_; }
+
+    /// Returns the final shift amount
+    constexpr unsigned shift() const { return flags_ & detail::divider_shift_mask; }
+
+    /// Returns true if the additional correction step is needed
+    constexpr bool is_add() const { return (flags_ & detail::divider_add) != 0; }
+
+private:
+    uint32_t d_;
+    uint32_t magic_;
+    uint8_t flags_;
+};
+
+template<>
+class divider<int32_t> {
+public:
+    using element_type = int32_t;
+
+    constexpr divider(int32_t d) :
+        d_(d),
+        magic_(detail::divider_s_magic(d)),
+        flags_(detail::divider_s_flags(d))
+    {}
+
+    /// Returns the divisor
+    constexpr int32_t divisor() const { return d_; }
+
+    /// Returns the magic number. Zero if the absolute value of the divisor is
+    /// a power of two.
+    constexpr int32_t magic() const { return magic_; }
+
+    /// Returns the final shift amount
+    constexpr unsigned shift() const { return flags_ & detail::divider_shift_mask; }
+
+    /// Returns true if the additional correction step is needed
+    constexpr bool is_add() const { return (flags_ & detail::divider_add) != 0; }
+
+    /// Returns true if the divisor is negative
+    constexpr bool is_negative() const { return (flags_ & detail::divider_negative) != 0; }
+
+private:
+    int32_t d_;
+    int32_t magic_;
+    uint8_t flags_;
+};
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
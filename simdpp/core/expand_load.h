@@ -0,0 +1,120 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_EXPAND_LOAD_H
+#define LIBSIMDPP_SIMDPP_CORE_EXPAND_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Loads consecutive elements starting at @a p into the positions selected by
+    @a mask, preserving their order. The remaining elements are set to zero.
+    Only as many elements as there are selected positions are read. The
+    pointer does not need to be aligned. This is the inverse of
+    compress_store.
+
+    @code
+    j = 0
+    for i in [0..N) :
+        r[i] = mask[i] ? p[j++] : 0
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE3, 2*N}
+    @icost{SSSE3-AVX2, NEON, ALTIVEC, 5-9}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE3, 4*N}
+    @icost{SSSE3-AVX, NEON, ALTIVEC, 10-18}
+    @icost{AVX2, 5-20}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N> expand_load(const uint8_t* p, const mask_int8<N,E>& mask)
+{
+    return detail::insn::i_expand_load<uint8<N>>(p, mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int8<N> expand_load(const int8_t* p, const mask_int8<N,E>& mask)
+{
+    return (int8<N>) detail::insn::i_expand_load<uint8<N>>(
+                reinterpret_cast<const uint8_t*>(p), mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N> expand_load(const uint16_t* p, const mask_int16<N,E>& mask)
+{
+    return detail::insn::i_expand_load<uint16<N>>(p, mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N> expand_load(const int16_t* p, const mask_int16<N,E>& mask)
+{
+    return (int16<N>) detail::insn::i_expand_load<uint16<N>>(
+                reinterpret_cast<const uint16_t*>(p), mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> expand_load(const uint32_t* p, const mask_int32<N,E>& mask)
+{
+    return detail::insn::i_expand_load<uint32<N>>(p, mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> expand_load(const int32_t* p, const mask_int32<N,E>& mask)
+{
+    return (int32<N>) detail::insn::i_expand_load<uint32<N>>(
+                reinterpret_cast<const uint32_t*>(p), mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> expand_load(const uint64_t* p, const mask_int64<N,E>& mask)
+{
+    return detail::insn::i_expand_load<uint64<N>>(p, mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N> expand_load(const int64_t* p, const mask_int64<N,E>& mask)
+{
+    return (int64<N>) detail::insn::i_expand_load<uint64<N>>(
+                reinterpret_cast<const uint64_t*>(p), mask.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N> expand_load(const float* p, const mask_float32<N,E>& mask)
+{
+    uint32<N> r = detail::insn::i_expand_load<uint32<N>>(
+                reinterpret_cast<const uint32_t*>(p), mask_int32<N>(mask.eval()));
+    return bit_cast<float32<N>>(r);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> expand_load(const double* p, const mask_float64<N,E>& mask)
+{
+    uint64<N> r = detail::insn::i_expand_load<uint64<N>>(
+                reinterpret_cast<const uint64_t*>(p), mask_int64<N>(mask.eval()));
+    return bit_cast<float64<N>>(r);
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
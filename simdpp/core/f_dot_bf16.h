@@ -0,0 +1,57 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_DOT_BF16_H
+#define LIBSIMDPP_SIMDPP_CORE_F_DOT_BF16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_dot_bf16.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Computes the dot products of adjacent pairs of bfloat16 values and
+    accumulates them into 32-bit float values.
+
+    @code
+    r0 = c0 + a1 * b1 + a0 * b0
+    ...
+    rN = cN + a(2*N+1) * b(2*N+1) + a(2*N) * b(2*N)
+    @endcode
+
+    The products are exact. Each addition is rounded according to the current
+    rounding mode.
+
+    AVX512BF16 specific:
+
+    The additions are rounded to nearest even. Denormal inputs and results are
+    flushed to zero.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 10}
+    @icost{FMA3, FMA4, AVX512F, 8}
+    @icost{AVX512BF16, 1}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> dot_bf16(const bfloat16<N*2>& a, const bfloat16<N*2>& b,
+                    const float32<N,E>& c)
+{
+    return detail::insn::i_dot_bf16(a, b, c.eval());
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
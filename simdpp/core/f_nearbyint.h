@@ -0,0 +1,81 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_NEARBYINT_H
+#define LIBSIMDPP_SIMDPP_CORE_F_NEARBYINT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_nearbyint.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+
+/** Rounds the values of a vector to integers using the current rounding mode.
+    In the default rounding mode halfway cases are rounded to the nearest even
+    integer.
+
+    @code
+    r0 = nearbyint(a0)
+    ...
+    rN = nearbyint(aN)
+    @endcode
+
+    NEON specific:
+    32-bit NEON always rounds to nearest, ties to even.
+
+    @par 128-bit version:
+    @icost{SSE2, SSE3, SSSE3, NEON, 8}
+
+    @par 256-bit version:
+    @icost{SSE2, SSE3, SSSE3, NEON, 16}
+    @icost{SSE4.1, ALTIVEC, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N, float32<N>> nearbyint(const float32<N,E>& a)
+{
+    return detail::insn::i_nearbyint(a.eval());
+}
+
+/** Rounds the values of a vector to integers using the current rounding mode.
+    In the default rounding mode halfway cases are rounded to the nearest even
+    integer.
+
+    @code
+    r0 = nearbyint(a0)
+    ...
+    rN = nearbyint(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, SSE3, SSSE3, 8}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2, SSE3, SSSE3, 16}
+    @icost{SSE4.1, NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N, float64<N>> nearbyint(const float64<N,E>& a)
+{
+    return detail::insn::i_nearbyint(a.eval());
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
+
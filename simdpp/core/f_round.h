@@ -0,0 +1,86 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_ROUND_H
+#define LIBSIMDPP_SIMDPP_CORE_F_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_round.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+
+/** Rounds the values of a vector to the nearest integer. Halfway cases are
+    rounded away from zero. The result does not depend on the current
+    rounding mode.
+
+    @code
+    r0 = round(a0)
+    ...
+    rN = round(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, SSE3, SSSE3, NEON, 15-17}
+    @icost{SSE4.1-AVX512F, ALTIVEC, 9}
+    @icost{NEON64, 1}
+
+    @par 256-bit version:
+    @icost{SSE2, SSE3, SSSE3, NEON, 30-34}
+    @icost{SSE4.1, ALTIVEC, 18}
+    @icost{AVX-AVX512F, 9}
+    @icost{NEON64, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N, float32<N>> round(const float32<N,E>& a)
+{
+    return detail::insn::i_round(a.eval());
+}
+
+/** Rounds the values of a vector to the nearest integer. Halfway cases are
+    rounded away from zero. The result does not depend on the current
+    rounding mode.
+
+    @code
+    r0 = round(a0)
+    ...
+    rN = round(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, SSE3, SSSE3, 34}
+    @icost{SSE4.1-AVX512F, 9}
+    @icost{NEON64, 1}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2, SSE3, SSSE3, 68}
+    @icost{SSE4.1, 18}
+    @icost{AVX-AVX512F, 9}
+    @icost{NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N, float64<N>> round(const float64<N,E>& a)
+{
+    return detail::insn::i_round(a.eval());
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
+
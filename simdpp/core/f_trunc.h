@@ -43,6 +43,28 @@ float32<N, float32<N>> trunc(const float32<N,E>& a)
     return detail::insn::i_trunc(a.eval());
 }
 
+/** Rounds the values of a vector towards zero
+    @code
+    r0 = trunc(a0)
+    ...
+    rN = trunc(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2, SSE3, SSSE3, 26}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2, SSE3, SSSE3, 52}
+    @icost{SSE4.1, NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N, float64<N>> trunc(const float64<N,E>& a)
+{
+    return detail::insn::i_trunc(a.eval());
+}
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
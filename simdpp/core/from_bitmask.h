@@ -0,0 +1,57 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_FROM_BITMASK_H
+#define LIBSIMDPP_SIMDPP_CORE_FROM_BITMASK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/from_bitmask.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Creates a mask of type @a M from an integer that contains one bit per
+    element. The element @c i of the mask is set if the bit @c i of @a bits is
+    set. The bits above the number of elements are ignored. The mask may
+    contain at most 64 elements. This is the inverse of to_bitmask.
+
+    @code
+    mask0 = bits & 1
+    mask1 = bits & 2
+    ...
+    maskN = bits & (1 << N)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512, NEON, ALTIVEC, 3-4}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, 6-8}
+    @icost{AVX2-AVX512, 3-4}
+*/
+template<class M> SIMDPP_INL
+M from_bitmask(uint64_t bits)
+{
+    static_assert(is_mask<M>::value, "M must be a mask type");
+    static_assert(M::length <= 64, "The mask must contain at most 64 elements");
+    M r;
+    detail::insn::i_from_bitmask(r, bits);
+    return r;
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
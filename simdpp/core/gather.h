@@ -0,0 +1,198 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/gather.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Loads the elements at the given indices of an array.
+
+    @code
+    r0 = base[idx0]
+    ...
+    rN = base[idxN]
+    @endcode
+
+    The indices are counted in elements, not bytes, and must be less than
+    2^31. The 64-bit elements may be indexed either by a 32-bit or a 64-bit
+    index vector.
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, 2*N}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, 2*N}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> gather(const uint32_t* base, const uint32<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> gather(const int32_t* base, const uint32<N,E>& idx)
+{
+    return (int32<N>) detail::insn::i_gather(reinterpret_cast<const uint32_t*>(base),
+                                             idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N> gather(const float* base, const uint32<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> gather(const uint64_t* base, const uint64<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N> gather(const int64_t* base, const uint64<N,E>& idx)
+{
+    return (int64<N>) detail::insn::i_gather(reinterpret_cast<const uint64_t*>(base),
+                                             idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> gather(const double* base, const uint64<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> gather(const uint64_t* base, const uint32<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N> gather(const int64_t* base, const uint32<N,E>& idx)
+{
+    return (int64<N>) detail::insn::i_gather(reinterpret_cast<const uint64_t*>(base),
+                                             idx.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> gather(const double* base, const uint32<N,E>& idx)
+{
+    return detail::insn::i_gather(base, idx.eval());
+}
+/// @}
+
+/// @{
+/** Loads the elements at the given indices of an array. Only the elements
+    that are selected by @a mask are loaded, the rest are copied from @a src.
+    The memory locations referred by the indices of the unselected elements
+    are not accessed.
+
+    @code
+    r0 = mask0 ? base[idx0] : src0
+    ...
+    rN = maskN ? base[idxN] : srcN
+    @endcode
+
+    The indices are counted in elements, not bytes, and must be less than
+    2^31.
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, 3*N}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, 3*N}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint32<N> gather_masked(const uint32_t* base, const uint32<N,E1>& idx,
+                        const mask_int32<N,E2>& mask, const uint32<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(), src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N> gather_masked(const int32_t* base, const uint32<N,E1>& idx,
+                       const mask_int32<N,E2>& mask, const int32<N,E3>& src)
+{
+    return (int32<N>) detail::insn::i_gather_masked(
+                reinterpret_cast<const uint32_t*>(base), idx.eval(), mask.eval(),
+                uint32<N>(src.eval()));
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float32<N> gather_masked(const float* base, const uint32<N,E1>& idx,
+                         const mask_float32<N,E2>& mask, const float32<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(), src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint64<N> gather_masked(const uint64_t* base, const uint64<N,E1>& idx,
+                        const mask_int64<N,E2>& mask, const uint64<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(), src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int64<N> gather_masked(const int64_t* base, const uint64<N,E1>& idx,
+                       const mask_int64<N,E2>& mask, const int64<N,E3>& src)
+{
+    return (int64<N>) detail::insn::i_gather_masked(
+                reinterpret_cast<const uint64_t*>(base), idx.eval(), mask.eval(),
+                uint64<N>(src.eval()));
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float64<N> gather_masked(const double* base, const uint64<N,E1>& idx,
+                         const mask_float64<N,E2>& mask, const float64<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(), src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint64<N> gather_masked(const uint64_t* base, const uint32<N,E1>& idx,
+                        const mask_int64<N,E2>& mask, const uint64<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(),
+                                         src.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int64<N> gather_masked(const int64_t* base, const uint32<N,E1>& idx,
+                       const mask_int64<N,E2>& mask, const int64<N,E3>& src)
+{
+    return (int64<N>) detail::insn::i_gather_masked(
+                reinterpret_cast<const uint64_t*>(base), idx.eval(),
+                mask.eval(), uint64<N>(src.eval()));
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+float64<N> gather_masked(const double* base, const uint32<N,E1>& idx,
+                         const mask_float64<N,E2>& mask, const float64<N,E3>& src)
+{
+    return detail::insn::i_gather_masked(base, idx.eval(), mask.eval(),
+                                         src.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
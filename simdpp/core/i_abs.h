@@ -96,13 +96,17 @@ uint32<N, expr_abs<int32<N,E>>> abs(const int32<N,E>& a)
     rN = abs(aN)
     @endcode
     @par 128-bit version:
-    @icost{SSE2-AVX, 5}
-    @icost{NEON, 6}
+    @icost{SSE2-SSE4.1, 5}
+    @icost{SSE4.2-AVX, 4}
+    @icost{NEON32, 6}
+    @icost{NEON64, 1}
     @novec{ALTIVEC}
 
     @par 256-bit version:
-    @icost{SSE2-AVX, 10}
-    @icost{NEON, 12}
+    @icost{SSE2-SSE4.1, 10}
+    @icost{SSE4.2-AVX, 8}
+    @icost{NEON32, 12}
+    @icost{NEON64, 2}
     @icost{AVX2, 4}
     @novec{ALTIVEC}
 */
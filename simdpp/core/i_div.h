@@ -0,0 +1,196 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/i_div.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Divides integer elements by a runtime-invariant divisor. The quotient is
+    rounded towards zero.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, NEON, 4-6}
+    @icost{ALTIVEC, 12-14}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, 8-12}
+    @icost{AVX2, 4-6}
+    @icost{ALTIVEC, 24-28}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N> div(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> div(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> div(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+/// @}
+
+/// @{
+/** Divides integer elements by a compile-time constant divisor. The quotient
+    is rounded towards zero. The divisor must not be zero.
+
+    @code
+    r0 = a0 / D
+    ...
+    rN = aN / D
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, NEON, 1-6}
+    @icost{ALTIVEC, 1-14}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, NEON, 2-12}
+    @icost{AVX2, 1-6}
+    @icost{ALTIVEC, 2-28}
+*/
+template<uint16_t D, unsigned N, class E> SIMDPP_INL
+uint16<N> div(const uint16<N,E>& a)
+{
+    static_assert(D != 0, "Division by zero");
+    constexpr divider<uint16_t> d(D);
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<uint32_t D, unsigned N, class E> SIMDPP_INL
+uint32<N> div(const uint32<N,E>& a)
+{
+    static_assert(D != 0, "Division by zero");
+    constexpr divider<uint32_t> d(D);
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<int32_t D, unsigned N, class E> SIMDPP_INL
+int32<N> div(const int32<N,E>& a)
+{
+    static_assert(D != 0, "Division by zero");
+    constexpr divider<int32_t> d(D);
+    return detail::insn::i_div(a.eval(), d);
+}
+/// @}
+
+/// @{
+/** Computes the remainder of the division of integer elements by a
+    runtime-invariant divisor. The remainder has the same sign as the
+    dividend.
+
+    @code
+    r0 = a0 % d
+    ...
+    rN = aN % d
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 12-14}
+    @icost{SSE4.1-AVX2, NEON, 6-8}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 24-28}
+    @icost{SSE4.1-AVX, NEON, 12-16}
+    @icost{AVX2, 6-8}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N> mod(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    uint16<N> q = detail::insn::i_div(a.eval(), d);
+    return sub(a, mul_lo(q, (uint16<N>) splat(d.divisor())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> mod(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    uint32<N> q = detail::insn::i_div(a.eval(), d);
+    return sub(a, mul_lo(q, (uint32<N>) splat(d.divisor())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N> mod(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    int32<N> q = detail::insn::i_div(a.eval(), d);
+    return (int32<N>) sub(a, mul_lo(q, (int32<N>) splat(d.divisor())));
+}
+/// @}
+
+/// @{
+/** Computes both the quotient and the remainder of the division of integer
+    elements by a runtime-invariant divisor.
+
+    @code
+    q0 = a0 / d         r0 = a0 % d
+    ...
+    qN = aN / d         rN = aN % d
+    @endcode
+
+    The cost is the same as that of mod.
+*/
+template<unsigned N, class E> SIMDPP_INL
+void divmod(const uint16<N,E>& a, const divider<uint16_t>& d,
+            uint16<N>& q, uint16<N>& r)
+{
+    uint16<N> ea = a.eval();
+    q = detail::insn::i_div(ea, d);
+    r = sub(ea, mul_lo(q, (uint16<N>) splat(d.divisor())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+void divmod(const uint32<N,E>& a, const divider<uint32_t>& d,
+            uint32<N>& q, uint32<N>& r)
+{
+    uint32<N> ea = a.eval();
+    q = detail::insn::i_div(ea, d);
+    r = sub(ea, mul_lo(q, (uint32<N>) splat(d.divisor())));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+void divmod(const int32<N,E>& a, const divider<int32_t>& d,
+            int32<N>& q, int32<N>& r)
+{
+    int32<N> ea = a.eval();
+    q = detail::insn::i_div(ea, d);
+    r = (int32<N>) sub(ea, mul_lo(q, (int32<N>) splat(d.divisor())));
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
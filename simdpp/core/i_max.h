@@ -153,6 +153,62 @@ uint32<N, uint32<N>> max(const uint32<N,E1>& a, const uint32<N,E2>& b)
 SIMDPP_SCALAR_ARG_IMPL_VEC(max, uint32, uint32)
 
 
+/** Computes maximum of the signed 64-bit values.
+
+    @code
+    r0 = max(a0, b0)
+    ...
+    rN = max(aN, bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 7}
+    @icost{SSE4.2-AVX2, 2}
+    @icost{NEON64, 2}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 14}
+    @icost{SSE4.2-AVX, 4}
+    @icost{AVX2, 2}
+    @icost{NEON64, 4}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N, int64<N>> max(const int64<N,E1>& a, const int64<N,E2>& b)
+{
+    return detail::insn::i_max(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(max, int64, int64)
+
+
+/** Computes maximum of the unsigned 64-bit values.
+
+    @code
+    r0 = max(a0, b0)
+    ...
+    rN = max(aN, bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 7-8}
+    @icost{SSE4.2-AVX2, 4-5}
+    @icost{NEON64, 2}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, NEON32, ALTIVEC, 14-16}
+    @icost{SSE4.2-AVX, 8-10}
+    @icost{AVX2, 4-5}
+    @icost{NEON64, 4}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N, uint64<N>> max(const uint64<N,E1>& a, const uint64<N,E2>& b)
+{
+    return detail::insn::i_max(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(max, uint64, uint64)
+
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
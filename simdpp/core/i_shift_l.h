@@ -300,6 +300,115 @@ uint64<N, uint64<N>> shift_l(const uint64<N,E>& a)
 }
 /// @}
 
+/// @{
+/** Shifts 16-bit values left by the number of bits in the corresponding
+    elements of @a count while shifting in zeros. The counts must be less
+    than 16, otherwise the results are unspecified.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 20-24}
+    @icost{SSE4.1-AVX, 16}
+    @icost{AVX2, 7}
+    @icost{NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 40-48}
+    @icost{SSE4.1-AVX, 32}
+    @icost{AVX2, 7}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N, int16<N>> shift_l(const int16<N,E1>& a, const uint16<N,E2>& count)
+{
+    uint16<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N, uint16<N>> shift_l(const uint16<N,E1>& a, const uint16<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+/// @}
+
+/// @{
+/** Shifts 32-bit values left by the number of bits in the corresponding
+    elements of @a count while shifting in zeros. The counts must be less
+    than 32, otherwise the results are unspecified.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 9}
+    @icost{SSE4.1-AVX, 4}
+    @icost{AVX2, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 18}
+    @icost{SSE4.1-AVX, 8}
+    @icost{AVX2, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N, int32<N>> shift_l(const int32<N,E1>& a, const uint32<N,E2>& count)
+{
+    uint32<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N, uint32<N>> shift_l(const uint32<N,E1>& a, const uint32<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+/// @}
+
+/// @{
+/** Shifts 64-bit values left by the number of bits in the corresponding
+    elements of @a count while shifting in zeros. The counts must be less
+    than 64, otherwise the results are unspecified.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 4}
+    @icost{AVX2, NEON, 1}
+    @unimp{ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 8}
+    @icost{AVX2, 1}
+    @icost{NEON, 2}
+    @unimp{ALTIVEC}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N, int64<N>> shift_l(const int64<N,E1>& a, const uint64<N,E2>& count)
+{
+    uint64<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N, uint64<N>> shift_l(const uint64<N,E1>& a, const uint64<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+/// @}
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
@@ -0,0 +1,105 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_REDUCE_ADD_H
+#define LIBSIMDPP_SIMDPP_CORE_REDUCE_ADD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/reduce_add.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the sum of the elements in the vector.
+
+    @code
+    r = a0 + a1 + a2 + ...
+    @endcode
+
+    The integer elements are summed into a result that is twice as wide as the
+    element for 8 and 16-bit elements. The result wraps around on overflow.
+    The order in which the floating-point elements are summed is unspecified,
+    thus the result may differ from that of the sequential sum due to
+    rounding.
+
+    On SSE2 the sum of 8-bit elements is computed with the psadbw instruction.
+    On NEON64 the across-vector instructions are used.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int16_t reduce_add(const int8<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16_t reduce_add(const uint8<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32_t reduce_add(const int16<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32_t reduce_add(const uint16<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32_t reduce_add(const int32<N,E>& a)
+{
+    return (int32_t) detail::insn::i_reduce_add(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32_t reduce_add(const uint32<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64_t reduce_add(const int64<N,E>& a)
+{
+    return (int64_t) detail::insn::i_reduce_add(uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t reduce_add(const uint64<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float reduce_add(const float32<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+double reduce_add(const float64<N,E>& a)
+{
+    return detail::insn::i_reduce_add(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
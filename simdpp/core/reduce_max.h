@@ -0,0 +1,89 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_REDUCE_MAX_H
+#define LIBSIMDPP_SIMDPP_CORE_REDUCE_MAX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/reduce_max.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the maximum of the elements in the vector.
+
+    @code
+    r = max(a0, a1, a2, ...)
+    @endcode
+
+    The result is unspecified if any of the floating-point elements is NaN.
+
+    On SSE4.1 the reduction of 8 and 16-bit elements uses the phminposuw
+    instruction on the inverted elements.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8_t reduce_max(const int8<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint8_t reduce_max(const uint8<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16_t reduce_max(const int16<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16_t reduce_max(const uint16<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32_t reduce_max(const int32<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32_t reduce_max(const uint32<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float reduce_max(const float32<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+double reduce_max(const float64<N,E>& a)
+{
+    return detail::insn::i_reduce_max(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
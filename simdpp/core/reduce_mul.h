@@ -0,0 +1,76 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_REDUCE_MUL_H
+#define LIBSIMDPP_SIMDPP_CORE_REDUCE_MUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/reduce_mul.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the product of the elements in the vector.
+
+    @code
+    r = a0 * a1 * a2 * ...
+    @endcode
+
+    The 16-bit integer elements are multiplied into a 32-bit result. The
+    integer result wraps around on overflow. The order in which the
+    floating-point elements are multiplied is unspecified.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32_t reduce_mul(const int16<N,E>& a)
+{
+    return detail::insn::i_reduce_mul(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32_t reduce_mul(const uint16<N,E>& a)
+{
+    return detail::insn::i_reduce_mul(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32_t reduce_mul(const int32<N,E>& a)
+{
+    return (int32_t) detail::insn::i_reduce_mul(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32_t reduce_mul(const uint32<N,E>& a)
+{
+    return detail::insn::i_reduce_mul(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float reduce_mul(const float32<N,E>& a)
+{
+    return detail::insn::i_reduce_mul(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+double reduce_mul(const float64<N,E>& a)
+{
+    return detail::insn::i_reduce_mul(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,188 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/to_int64.h>
+#include <simdpp/detail/insn/scatter.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Stores the elements of a vector to the given indices of an array.
+
+    @code
+    base[idx0] = a0
+    ...
+    base[idxN] = aN
+    @endcode
+
+    The indices are counted in elements, not bytes, and must be less than
+    2^31. If several indices are equal, the element at the highest position
+    is stored. The 64-bit elements may be indexed either by a 32-bit or a
+    64-bit index vector.
+
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 2*N}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint32_t* base, const uint32<N,E1>& idx, const uint32<N,E2>& a)
+{
+    detail::insn::i_scatter(base, idx.eval(), a.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int32_t* base, const uint32<N,E1>& idx, const int32<N,E2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<uint32_t*>(base), idx.eval(),
+                            uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(float* base, const uint32<N,E1>& idx, const float32<N,E2>& a)
+{
+    detail::insn::i_scatter(base, idx.eval(), a.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint64_t* base, const uint64<N,E1>& idx, const uint64<N,E2>& a)
+{
+    detail::insn::i_scatter(base, idx.eval(), a.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int64_t* base, const uint64<N,E1>& idx, const int64<N,E2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<uint64_t*>(base), idx.eval(),
+                            uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(double* base, const uint64<N,E1>& idx, const float64<N,E2>& a)
+{
+    detail::insn::i_scatter(base, idx.eval(), a.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint64_t* base, const uint32<N,E1>& idx, const uint64<N,E2>& a)
+{
+    detail::insn::i_scatter(base, to_int64(idx).eval(), a.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int64_t* base, const uint32<N,E1>& idx, const int64<N,E2>& a)
+{
+    detail::insn::i_scatter(reinterpret_cast<uint64_t*>(base),
+                            to_int64(idx).eval(), uint64<N>(a.eval()));
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(double* base, const uint32<N,E1>& idx, const float64<N,E2>& a)
+{
+    detail::insn::i_scatter(base, to_int64(idx).eval(), a.eval());
+}
+/// @}
+
+/// @{
+/** Stores the elements of a vector that are selected by @a mask to the given
+    indices of an array. The memory locations referred by the indices of the
+    unselected elements are not accessed.
+
+    @code
+    if (mask0) base[idx0] = a0
+    ...
+    if (maskN) base[idxN] = aN
+    @endcode
+
+    The indices are counted in elements, not bytes, and must be less than
+    2^31. If several selected indices are equal, the element at the highest
+    position is stored.
+
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 3*N}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(uint32_t* base, const uint32<N,E1>& idx,
+                    const uint32<N,E2>& a, const mask_int32<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, idx.eval(), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(int32_t* base, const uint32<N,E1>& idx,
+                    const int32<N,E2>& a, const mask_int32<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<uint32_t*>(base), idx.eval(),
+                                   uint32<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(float* base, const uint32<N,E1>& idx,
+                    const float32<N,E2>& a, const mask_float32<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, idx.eval(), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(uint64_t* base, const uint64<N,E1>& idx,
+                    const uint64<N,E2>& a, const mask_int64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, idx.eval(), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(int64_t* base, const uint64<N,E1>& idx,
+                    const int64<N,E2>& a, const mask_int64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<uint64_t*>(base), idx.eval(),
+                                   uint64<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(double* base, const uint64<N,E1>& idx,
+                    const float64<N,E2>& a, const mask_float64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, idx.eval(), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(uint64_t* base, const uint32<N,E1>& idx,
+                    const uint64<N,E2>& a, const mask_int64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, to_int64(idx).eval(), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(int64_t* base, const uint32<N,E1>& idx,
+                    const int64<N,E2>& a, const mask_int64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(reinterpret_cast<uint64_t*>(base),
+                                   to_int64(idx).eval(), uint64<N>(a.eval()),
+                                   mask.eval());
+}
+
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+void scatter_masked(double* base, const uint32<N,E1>& idx,
+                    const float64<N,E2>& a, const mask_float64<N,E3>& mask)
+{
+    detail::insn::i_scatter_masked(base, to_int64(idx).eval(), a.eval(), mask.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,113 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_MASKED_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/store_masked.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Stores the elements of @a a that are selected by @a mask to memory. The
+    elements that are not selected are left unchanged.
+
+    @code
+    for i in [0..N) :
+        if (mask[i]) *(p+i) = a[i]
+    @endcode
+
+    On AVX512F (32 and 64-bit elements) and AVX512BW (8 and 16-bit elements)
+    the mask is used directly as the write mask of the store. On AVX and AVX2
+    the 32 and 64-bit stores use the masked move instructions. Elsewhere the
+    function reads the destination, merges the selected elements and writes
+    the entire vector back, thus it must not race with writes to the
+    unselected elements.
+
+    @par 128-bit version:
+    @a p must be aligned to 16 bytes.
+    @par 256-bit version:
+    @a p must be aligned to 32 bytes.
+    @par 512-bit version:
+    @a p must be aligned to 64 bytes.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const uint8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const int8<N,E1>& a, const mask_int8<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), uint8<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const uint16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const int16<N,E1>& a, const mask_int16<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), uint16<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const uint32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const int32<N,E1>& a, const mask_int32<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), uint32<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const uint64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const int64<N,E1>& a, const mask_int64<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), uint64<N>(a.eval()), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const float32<N,E1>& a, const mask_float32<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void store_masked(void* p, const float64<N,E1>& a, const mask_float64<N,E2>& mask)
+{
+    detail::insn::i_store_masked(reinterpret_cast<char*>(p), a.eval(), mask.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,75 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_BFLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_BFLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/to_bfloat16.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Converts 32-bit float values to bfloat16 values.
+
+    If only inexact conversion can be performed, the value is rounded to the
+    nearest representable value, ties to even. Values too large for the
+    bfloat16 format are converted to infinity. NaNs are converted to quiet
+    NaNs.
+
+    @code
+    r0 = (bfloat16) a0
+    ...
+    rN = (bfloat16) aN
+    @endcode
+
+    AVX512BF16 specific:
+
+    Denormal inputs and results are flushed to zero.
+
+    @par 8-element version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, 12-14}
+    @icost{AVX2, AVX512F, 11}
+    @icost{AVX512BF16, 1}
+*/
+template<unsigned N, class E> SIMDPP_INL
+bfloat16<N> to_bfloat16(const float32<N,E>& a)
+{
+    return detail::insn::i_to_bfloat16(a.eval());
+}
+
+/** Converts 32-bit float values to bfloat16 values by truncating the
+    mantissa, i.e. rounding towards zero. NaNs are converted to quiet NaNs.
+
+    @code
+    r0 = (bfloat16) trunc(a0)
+    ...
+    rN = (bfloat16) trunc(aN)
+    @endcode
+
+    @par 8-element version:
+    @icost{SSE2-AVX, NEON, ALTIVEC, 8-10}
+    @icost{AVX2, AVX512F, 7}
+*/
+template<unsigned N, class E> SIMDPP_INL
+bfloat16<N> to_bfloat16_trunc(const float32<N,E>& a)
+{
+    return detail::insn::i_to_bfloat16_trunc(a.eval());
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,91 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_BITMASK_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_BITMASK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/to_bitmask.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Converts a mask to an integer that contains one bit per element. The bit
+    @c i of the result is set if the element @c i of the mask is set. The
+    vector may contain at most 64 elements.
+
+    @code
+    r = (mask0 ? 1 : 0) | (mask1 ? 2 : 0) | ... | (maskN ? 1 << N : 0)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512, 1-2}
+    @icost{NEON, 6-7}
+    @icost{ALTIVEC, 8-9}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, 3-5}
+    @icost{AVX2-AVX512, 1-3}
+    @icost{NEON, 13-15}
+    @icost{ALTIVEC, 17-19}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_int8<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_int16<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_int32<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_int64<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_float32<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64_t to_bitmask(const mask_float64<N,E>& a)
+{
+    static_assert(N <= 64, "The mask must contain at most 64 elements");
+    return detail::insn::i_to_bitmask(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,53 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/to_float16.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/** Converts 32-bit float values to 16-bit (half-precision) float values.
+
+    If only inexact conversion can be performed, the value is rounded to the
+    nearest representable value, ties to even. Values too large for the
+    half-precision format are converted to infinity. NaNs are converted to
+    quiet NaNs.
+
+    @code
+    r0 = (float16) a0
+    ...
+    rN = (float16) aN
+    @endcode
+
+    @par 8-element version:
+    @icost{F16C, 3}
+    @icost{F16C with AVX, AVX512F, 1}
+    @icost{NEON64, 2}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 20-30}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float16<N> to_float16(const float32<N,E>& a)
+{
+    return detail::insn::i_to_float16(a.eval());
+}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
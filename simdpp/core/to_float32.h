@@ -48,6 +48,74 @@ float32<N> to_float32(const int32<N,E>& a)
     return detail::insn::i_to_float32(a.eval());
 }
 
+/** Converts unsigned 32-bit integer values to 32-bit float values.
+
+    If only inexact conversion can be performed, the value is rounded to the
+    nearest representable value.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 6}
+    @icost{AVX512F, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 12}
+    @icost{AVX2, 6}
+    @icost{AVX512F, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> to_float32(const uint32<N,E>& a)
+{
+    return detail::insn::i_to_float32(a.eval());
+}
+
+/** Converts 16-bit (half-precision) float values to 32-bit float values.
+
+    The conversion is exact. Signaling NaNs are converted to quiet NaNs.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+
+    @par 8-element version:
+    @icost{F16C, 3}
+    @icost{F16C with AVX, AVX512F, 1}
+    @icost{NEON64, 2}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 15-20}
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> to_float32(const float16<N>& a)
+{
+    return detail::insn::i_to_float32(a);
+}
+
+/** Converts bfloat16 values to 32-bit float values. The conversion is exact.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+
+    @par 8-element version:
+    @icost{SSE2-AVX, NEON, 2}
+    @icost{AVX2, AVX512F, 2}
+    @icost{ALTIVEC, 3-4}
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> to_float32(const bfloat16<N>& a)
+{
+    return detail::insn::i_to_float32(a);
+}
+
 /** Converts 64-bit float values to 32-bit float values.
 
     SSE specific:
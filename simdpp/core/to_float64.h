@@ -78,6 +78,64 @@ float64<N> to_float64(const float32<N,E>& a)
     return detail::insn::i_to_float64(a.eval());
 }
 
+/** Converts the signed 64-bit integer values to 64-bit float values.
+
+    If only inexact conversion can be performed, the value is rounded to the
+    nearest representable value.
+
+    @code
+    r0 = (double) a0
+    ...
+    rN = (double) aN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 7}
+    @icost{AVX512DQ, NEON64, 1}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2-AVX512F, 7}
+    @icost{AVX512DQ, 1}
+    @icost{NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N> to_float64(const int64<N,E>& a)
+{
+    return detail::insn::i_to_float64(a.eval());
+}
+
+/** Converts the unsigned 64-bit integer values to 64-bit float values.
+
+    If only inexact conversion can be performed, the value is rounded to the
+    nearest representable value.
+
+    @code
+    r0 = (double) a0
+    ...
+    rN = (double) aN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 7}
+    @icost{AVX512DQ, NEON64, 1}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2-AVX512F, 7}
+    @icost{AVX512DQ, 1}
+    @icost{NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float64<N> to_float64(const uint64<N,E>& a)
+{
+    return detail::insn::i_to_float64(a.eval());
+}
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
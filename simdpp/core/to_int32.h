@@ -73,6 +73,32 @@ int32<N> to_int32(const float32<N,E>& a)
     return detail::insn::i_to_int32(a.eval());
 }
 
+/** Converts the values of a float32 vector into unsigned int32_t
+    representation using truncation. The behavior is undefined if the value
+    can not be represented in the result type.
+
+    @code
+    r0 = (uint32_t) a0
+    ...
+    rN = (uint32_t) aN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 6}
+    @icost{AVX512F, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 12}
+    @icost{AVX2, 6}
+    @icost{AVX512F, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> to_uint32(const float32<N,E>& a)
+{
+    return detail::insn::i_to_uint32(a.eval());
+}
+
 /** Converts the values of a doublex2 vector into int32_t representation using
     truncation. The behavior is undefined if the value can not be represented
     in the result type.
@@ -104,6 +130,61 @@ int32<N> to_int32(const float64<N,E>& a)
     return detail::insn::i_to_int32(a.eval());
 }
 
+/** Converts the values of a float32 vector into signed int32_t
+    representation using the current rounding mode. In the default rounding
+    mode halfway cases are rounded to the nearest even integer. The behavior is
+    undefined if the value can not be represented in the result type.
+
+    Halfway cases can be rounded away from zero by using
+    <tt>to_int32(round(a))</tt> instead.
+
+    NEON specific:
+    Rounds to nearest, ties to even, regardless of the current rounding mode.
+
+    @code
+    r0 = (int32_t) nearbyint(a0)
+    ...
+    rN = (int32_t) nearbyint(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{NEON, 9}
+
+    @par 256-bit version:
+    @icost{SSE2-SSE4.1, ALTIVEC, 2}
+    @icost{NEON, 18}
+    @icost{NEON64, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N> to_int32_round(const float32<N,E>& a)
+{
+    return detail::insn::i_to_int32_round(a.eval());
+}
+
+/** Converts the values of a float64 vector into signed int32_t
+    representation using the current rounding mode. In the default rounding
+    mode halfway cases are rounded to the nearest even integer. The behavior is
+    undefined if the value can not be represented in the result type.
+
+    NEON specific:
+    Rounds to nearest, ties to even, regardless of the current rounding mode.
+
+    @code
+    r0 = (int32_t) nearbyint(a0)
+    ...
+    rN = (int32_t) nearbyint(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSE4.1, 3}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N> to_int32_round(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int32_round(a.eval());
+}
+
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
 #endif
@@ -57,6 +57,35 @@ uint64<N> to_int64(const uint32<N,E>& a)
     return detail::insn::i_to_uint64(a.eval());
 }
 
+/** Converts the values of a float64 vector into signed 64-bit integer
+    representation using truncation. The behavior is undefined if the value
+    can not be represented in the result type.
+
+    @code
+    r0 = (int64_t) a0
+    ...
+    rN = (int64_t) aN
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 16}
+    @icost{AVX2-AVX512F, 9}
+    @icost{AVX512DQ, NEON64, 1}
+    @novec{NEON, ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 32}
+    @icost{AVX2-AVX512F, 9}
+    @icost{AVX512DQ, 1}
+    @icost{NEON64, 2}
+    @novec{NEON, ALTIVEC}
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N> to_int64(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int64(a.eval());
+}
+
 
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
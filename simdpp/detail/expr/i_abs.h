@@ -58,6 +58,15 @@ uint8<32> expr_eval(const expr_abs<int8<32,E>>& q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E> SIMDPP_INL
+uint8<64> expr_eval(const expr_abs<int8<64,E>>& q)
+{
+    int8<64> a = q.a.eval();
+    return _mm512_abs_epi8(a);
+}
+#endif
+
 template<class R, unsigned N, class E> SIMDPP_INL
 uint8<N> expr_eval(const expr_abs<int8<N,E>>& q)
 {
@@ -98,6 +107,15 @@ uint16<16> expr_eval(const expr_abs<int16<16,E>>& q)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E> SIMDPP_INL
+uint16<32> expr_eval(const expr_abs<int16<32,E>>& q)
+{
+    int16<32> a = q.a.eval();
+    return _mm512_abs_epi16(a);
+}
+#endif
+
 template<class R, unsigned N, class E> SIMDPP_INL
 uint16<N> expr_eval(const expr_abs<int16<N,E>>& q)
 {
@@ -162,6 +180,12 @@ uint64<2> expr_eval(const expr_abs<int64<2,E>>& q)
     int64<2> a = q.a.eval();
 #if SIMDPP_USE_NULL
     return detail::null::abs(a);
+#elif SIMDPP_USE_SSE4_2
+    int64x2 t;
+    t = _mm_cmpgt_epi64(int64x2::zero(), a);
+    a = bit_xor(a, t);
+    a = sub(a, t);
+    return a;
 #elif SIMDPP_USE_SSE2
     uint32x4 ta;
     int64x2 t;
@@ -171,6 +195,8 @@ uint64<2> expr_eval(const expr_abs<int64<2,E>>& q)
     a = bit_xor(a, t);
     a = sub(a, t);
     return a;
+#elif SIMDPP_USE_NEON64
+    return int64x2(vabsq_s64(a));
 #elif SIMDPP_USE_NEON
     int32x4 z;
     z = shift_r<63>(uint64x2(a));
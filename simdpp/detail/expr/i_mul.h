@@ -57,6 +57,17 @@ uint16<16> expr_eval(const expr_mul_lo<uint16<16,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E1, class E2> SIMDPP_INL
+uint16<32> expr_eval(const expr_mul_lo<uint16<32,E1>,
+                                       uint16<32,E2>>& q)
+{
+    uint16<32> a = q.a.eval();
+    uint16<32> b = q.b.eval();
+    return _mm512_mullo_epi16(a, b);
+}
+#endif
+
 template<class R, unsigned N, class E1, class E2> SIMDPP_INL
 uint16<N> expr_eval(const expr_mul_lo<uint16<N,E1>,
                                       uint16<N,E2>>& q)
@@ -100,6 +111,17 @@ int16<16> expr_eval(const expr_mul_hi<int16<16,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E1, class E2> SIMDPP_INL
+int16<32> expr_eval(const expr_mul_hi<int16<32,E1>,
+                                      int16<32,E2>>& q)
+{
+    int16<32> a = q.a.eval();
+    int16<32> b = q.b.eval();
+    return _mm512_mulhi_epi16(a, b);
+}
+#endif
+
 template<class R, unsigned N, class E1, class E2> SIMDPP_INL
 int16<N> expr_eval(const expr_mul_hi<int16<N,E1>,
                                      int16<N,E2>>& q)
@@ -143,6 +165,17 @@ uint16<16> expr_eval(const expr_mul_hi<uint16<16,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E1, class E2> SIMDPP_INL
+uint16<32> expr_eval(const expr_mul_hi<uint16<32,E1>,
+                                       uint16<32,E2>>& q)
+{
+    uint16<32> a = q.a.eval();
+    uint16<32> b = q.b.eval();
+    return _mm512_mulhi_epu16(a, b);
+}
+#endif
+
 template<class R, unsigned N, class E1, class E2> SIMDPP_INL
 uint16<N> expr_eval(const expr_mul_hi<uint16<N,E1>,
                                       uint16<N,E2>>& q)
@@ -20,6 +20,7 @@
 #include <simdpp/core/combine.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
+#include <simdpp/detail/insn/shuffle128.h>
 
 namespace simdpp {
 #ifndef SIMDPP_DOXYGEN
@@ -96,6 +97,23 @@ int32<16> expr_eval(const expr_mull<int16<16,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E1, class E2> SIMDPP_INL
+int32<32> expr_eval(const expr_mull<int16<32,E1>,
+                                    int16<32,E2>>& q)
+{
+    int16<32> a = q.a.eval();
+    int16<32> b = q.b.eval();
+    int16<32> lo = _mm512_mullo_epi16(a, b);
+    int16<32> hi = _mm512_mulhi_epi16(a, b);
+    // keep the element order of the 256-bit version for each 256-bit half
+    int32<16> rl, rh;
+    rl = zip8_lo(lo, hi);
+    rh = zip8_hi(lo, hi);
+    return combine(shuffle2_128<0,1,0,1>(rl, rh), shuffle2_128<2,3,2,3>(rl, rh));
+}
+#endif
+
 template<class R, unsigned N, class E1, class E2> SIMDPP_INL
 int32<N> expr_eval(const expr_mull<int16<N,E1>,
                                    int16<N,E2>>& q)
@@ -151,6 +169,23 @@ uint32<16> expr_eval(const expr_mull<uint16<16,E1>,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class R, class E1, class E2> SIMDPP_INL
+uint32<32> expr_eval(const expr_mull<uint16<32,E1>,
+                                     uint16<32,E2>>& q)
+{
+    uint16<32> a = q.a.eval();
+    uint16<32> b = q.b.eval();
+    int16<32> lo = _mm512_mullo_epi16(a, b);
+    int16<32> hi = _mm512_mulhi_epu16(a, b);
+    // keep the element order of the 256-bit version for each 256-bit half
+    uint32<16> rl, rh;
+    rl = zip8_lo(lo, hi);
+    rh = zip8_hi(lo, hi);
+    return combine(shuffle2_128<0,1,0,1>(rl, rh), shuffle2_128<2,3,2,3>(rl, rh));
+}
+#endif
+
 template<class R, unsigned N, class E1, class E2> SIMDPP_INL
 uint32<N> expr_eval(const expr_mull<uint16<N,E1>,
                                     uint16<N,E2>>& q)
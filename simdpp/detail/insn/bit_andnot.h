@@ -47,6 +47,13 @@ SIMDPP_INL uint8<32> i_bit_andnot(const uint8<32>& a, const uint8<32>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_bit_andnot(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_andnot_si512(b, a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_bit_andnot(const uint8<N>& a, const uint8<N>& b)
 {
@@ -71,6 +78,13 @@ SIMDPP_INL uint8<32> i_bit_andnot(const uint8<32>& a, const mask_int8<32>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_bit_andnot(const uint8<64>& a, const mask_int8<64>& b)
+{
+    return _mm512_maskz_mov_epi8(_knot_mask64(b), a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_bit_andnot(const uint8<N>& a, const mask_int8<N>& b)
 {
@@ -95,6 +109,13 @@ SIMDPP_INL mask_int8<32> i_bit_andnot(const mask_int8<32>& a, const mask_int8<32
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_bit_andnot(const mask_int8<64>& a, const mask_int8<64>& b)
+{
+    return _kandn_mask64(b, a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_bit_andnot(const mask_int8<N>& a, const mask_int8<N>& b)
 {
@@ -115,6 +136,13 @@ SIMDPP_INL uint16<16> i_bit_andnot(const uint16<16>& a, const uint16<16>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_bit_andnot(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_andnot_si512(b, a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_bit_andnot(const uint16<N>& a, const uint16<N>& b)
 {
@@ -139,6 +167,13 @@ SIMDPP_INL uint16<16> i_bit_andnot(const uint16<16>& a, const mask_int16<16>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_bit_andnot(const uint16<32>& a, const mask_int16<32>& b)
+{
+    return _mm512_maskz_mov_epi16(_knot_mask32(b), a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_bit_andnot(const uint16<N>& a, const mask_int16<N>& b)
 {
@@ -163,6 +198,13 @@ SIMDPP_INL mask_int16<16> i_bit_andnot(const mask_int16<16>& a, const mask_int16
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_bit_andnot(const mask_int16<32>& a, const mask_int16<32>& b)
+{
+    return _kandn_mask32(b, a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_bit_andnot(const mask_int16<N>& a, const mask_int16<N>& b)
 {
@@ -47,6 +47,14 @@ SIMDPP_INL uint8x32 i_bit_not(const uint8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_bit_not(const uint8<64>& a)
+{
+    uint8<64> ones = uint8<64>::ones();
+    return bit_xor(a, ones);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_bit_not(const uint8<N>& a)
 {
@@ -171,6 +179,18 @@ SIMDPP_INL mask_int64<8> i_bit_not(const mask_int64<8>& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_bit_not(const mask_int8<64>& a)
+{
+    return _knot_mask64(a);
+}
+
+SIMDPP_INL mask_int16<32> i_bit_not(const mask_int16<32>& a)
+{
+    return _knot_mask32(a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_bit_not(const mask_int8<N>& a)
 {
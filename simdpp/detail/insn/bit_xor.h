@@ -45,10 +45,17 @@ SIMDPP_INL uint8x32 i_bit_xor(const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_bit_xor(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_xor_si512(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_bit_xor(const uint8<N>& a, const uint8<N>& b)
 {
-    SIMDPP_VEC_ARRAY_IMPL2(uint8x32, i_bit_xor, a, b)
+    SIMDPP_VEC_ARRAY_IMPL2(uint8<N>, i_bit_xor, a, b)
 }
 
 // -----------------------------------------------------------------------------
@@ -69,6 +76,13 @@ SIMDPP_INL mask_int8x32 i_bit_xor(const mask_int8x32& a, const mask_int8x32& b)
     }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_bit_xor(const mask_int8<64>& a, const mask_int8<64>& b)
+{
+    return _kxor_mask64(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_bit_xor(const mask_int8<N>& a, const mask_int8<N>& b)
 {
@@ -89,6 +103,13 @@ SIMDPP_INL uint16<16> i_bit_xor(const uint16<16>& a, const uint16<16>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_bit_xor(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_xor_si512(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_bit_xor(const uint16<N>& a, const uint16<N>& b)
 {
@@ -113,6 +134,13 @@ SIMDPP_INL mask_int16<16> i_bit_xor(const mask_int16<16>& a, const mask_int16<16
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_bit_xor(const mask_int16<32>& a, const mask_int16<32>& b)
+{
+    return _kxor_mask32(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_bit_xor(const mask_int16<N>& a, const mask_int16<N>& b)
 {
@@ -62,6 +62,13 @@ SIMDPP_INL uint8<32> i_blend(const uint8<32>& on, const uint8<32>& off, const ui
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_blend(const uint8<64>& on, const uint8<64>& off, const uint8<64>& mask)
+{
+    return _mm512_ternarylogic_epi32(on, off, mask, 0xe4);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_blend(const uint8<N>& on, const uint8<N>& off, const uint8<N>& mask)
 {
@@ -87,6 +94,13 @@ SIMDPP_INL uint8<32> i_blend(const uint8<32>& on, const uint8<32>& off, const ma
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_blend(const uint8<64>& on, const uint8<64>& off, const mask_int8<64>& mask)
+{
+    return _mm512_mask_blend_epi8(mask, off, on);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_blend(const uint8<N>& on, const uint8<N>& off, const mask_int8<N>& mask)
 {
@@ -112,6 +126,13 @@ SIMDPP_INL mask_int8<32> i_blend(const mask_int8<32>& on, const mask_int8<32>& o
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_blend(const mask_int8<64>& on, const mask_int8<64>& off, const mask_int8<64>& mask)
+{
+    return _kor_mask64(_kand_mask64(on, mask), _kandn_mask64(mask, off));
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_blend(const mask_int8<N>& on, const mask_int8<N>& off, const mask_int8<N>& mask)
 {
@@ -133,6 +154,13 @@ SIMDPP_INL uint16<16> i_blend(const uint16<16>& on, const uint16<16>& off, const
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_blend(const uint16<32>& on, const uint16<32>& off, const uint16<32>& mask)
+{
+    return _mm512_ternarylogic_epi32(on, off, mask, 0xe4);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_blend(const uint16<N>& on, const uint16<N>& off, const uint16<N>& mask)
 {
@@ -158,6 +186,13 @@ SIMDPP_INL uint16<16> i_blend(const uint16<16>& on, const uint16<16>& off, const
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_blend(const uint16<32>& on, const uint16<32>& off, const mask_int16<32>& mask)
+{
+    return _mm512_mask_blend_epi16(mask, off, on);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_blend(const uint16<N>& on, const uint16<N>& off, const mask_int16<N>& mask)
 {
@@ -183,6 +218,13 @@ SIMDPP_INL mask_int16<16> i_blend(const mask_int16<16>& on, const mask_int16<16>
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_blend(const mask_int16<32>& on, const mask_int16<32>& off, const mask_int16<32>& mask)
+{
+    return _kor_mask32(_kand_mask32(on, mask), _kandn_mask32(mask, off));
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_blend(const mask_int16<N>& on, const mask_int16<N>& off, const mask_int16<N>& mask)
 {
@@ -49,6 +49,18 @@ SIMDPP_INL mask_int8x32 i_cmp_eq(const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_eq(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_cmpeq_epi8_mask(a, b);
+}
+
+SIMDPP_INL mask_int8<64> i_cmp_eq(const mask_int8<64>& a, const mask_int8<64>& b)
+{
+    return _kxnor_mask64(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_eq(const uint8<N>& a, const uint8<N>& b)
 {
@@ -77,6 +89,18 @@ SIMDPP_INL mask_int16x16 i_cmp_eq(const uint16x16& a, const uint16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_eq(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_cmpeq_epi16_mask(a, b);
+}
+
+SIMDPP_INL mask_int16<32> i_cmp_eq(const mask_int16<32>& a, const mask_int16<32>& b)
+{
+    return _kxnor_mask32(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_eq(const uint16<N>& a, const uint16<N>& b)
 {
@@ -14,6 +14,8 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/make_shuffle_bytes_mask.h>
+#include <simdpp/detail/insn/bit_not.h>
+#include <simdpp/detail/insn/cmp_lt.h>
 #include <simdpp/detail/null/compare.h>
 
 namespace simdpp {
@@ -23,6 +25,75 @@ namespace SIMDPP_ARCH_NAMESPACE {
 namespace detail {
 namespace insn {
 
+SIMDPP_INL mask_int64x2 i_cmp_ge(const int64x2& a, const int64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_ge(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comge_epi64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcgeq_s64(a, b);
+#else
+    return i_bit_not(i_cmp_lt(a, b));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_ge(const int64x4& a, const int64x4& b)
+{
+    return i_bit_not(i_cmp_lt(a, b));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_ge(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_cmpge_epi64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_ge(const int64<N>& a, const int64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_ge, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL mask_int64x2 i_cmp_ge(const uint64x2& a, const uint64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_ge(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comge_epu64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcgeq_u64(a, b);
+#else
+    return i_bit_not(i_cmp_lt(a, b));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_ge(const uint64x4& a, const uint64x4& b)
+{
+    return i_bit_not(i_cmp_lt(a, b));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_ge(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_cmpge_epu64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_ge(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_ge, a, b);
+}
+
+// -----------------------------------------------------------------------------
 
 SIMDPP_INL mask_float32x4 i_cmp_ge(const float32x4& a, const float32x4& b)
 {
@@ -16,7 +16,11 @@
 #include <simdpp/core/make_shuffle_bytes_mask.h>
 #include <simdpp/core/make_uint.h>
 #include <simdpp/detail/not_implemented.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
 #include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/permute4.h>
 #include <simdpp/detail/null/compare.h>
 
 namespace simdpp {
@@ -47,6 +51,13 @@ SIMDPP_INL mask_int8x32 i_cmp_gt(const int8x32& a, const int8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_gt(const int8<64>& a, const int8<64>& b)
+{
+    return _mm512_cmpgt_epi8_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_gt(const int8<N>& a, const int8<N>& b)
 {
@@ -83,6 +94,13 @@ SIMDPP_INL mask_int8x32 i_cmp_gt(const uint8x32& ca, const uint8x32& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_gt(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_cmpgt_epu8_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_gt(const uint8<N>& a, const uint8<N>& b)
 {
@@ -111,6 +129,13 @@ SIMDPP_INL mask_int16x16 i_cmp_gt(const int16x16& a, const int16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_gt(const int16<32>& a, const int16<32>& b)
+{
+    return _mm512_cmpgt_epi16_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_gt(const int16<N>& a, const int16<N>& b)
 {
@@ -147,6 +172,13 @@ SIMDPP_INL mask_int16x16 i_cmp_gt(const uint16x16& ca, const uint16x16& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_gt(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_cmpgt_epu16_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_gt(const uint16<N>& a, const uint16<N>& b)
 {
@@ -234,6 +266,120 @@ mask_int32<N> i_cmp_gt(const uint32<N>& a, const uint32<N>& b)
 
 // -----------------------------------------------------------------------------
 
+#if !SIMDPP_USE_NULL
+/*  Compares 64-bit elements using 32-bit operations. @a sign_mask selects which
+    32-bit halves are biased by 0x80000000 before the signed 32-bit comparison:
+    the low halves always need it because they are compared as unsigned values,
+    the high halves only when the 64-bit elements are unsigned. The function is
+    a template only to defer the lookup of cmp_eq, which is not yet declared
+    when this file is included through core/cmp_eq.h.
+*/
+template<class U32> SIMDPP_INL
+mask_int64x2 i_cmp_gt64_emul(const uint64x2& a, const uint64x2& b,
+                             const U32& sign_mask)
+{
+    U32 a32, b32, gt, eq, gt_lo;
+    a32 = bit_xor(U32(a), sign_mask);
+    b32 = bit_xor(U32(b), sign_mask);
+    gt = i_cmp_gt(int32x4(a32), int32x4(b32));
+    eq = cmp_eq(a32, b32);
+    // gt_hi | (eq_hi & gt_lo), computed in the high half and then broadcast
+#if SIMDPP_USE_ALTIVEC
+    gt_lo = permute4<1,1,3,3>(gt);
+    gt = bit_or(gt, bit_and(eq, gt_lo));
+    return uint64x2(permute4<0,0,2,2>(gt));
+#else
+    gt_lo = permute4<0,0,2,2>(gt);
+    gt = bit_or(gt, bit_and(eq, gt_lo));
+    return uint64x2(permute4<1,1,3,3>(gt));
+#endif
+}
+#endif
+
+SIMDPP_INL mask_int64x2 i_cmp_gt(const int64x2& a, const int64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_gt(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comgt_epi64(a, b);
+#elif SIMDPP_USE_SSE4_2
+    return _mm_cmpgt_epi64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcgtq_s64(a, b);
+#elif SIMDPP_USE_ALTIVEC
+    return i_cmp_gt64_emul(uint64x2(a), uint64x2(b),
+                           make_uint<uint32x4>(0, 0x80000000));
+#else
+    return i_cmp_gt64_emul(uint64x2(a), uint64x2(b),
+                           make_uint<uint32x4>(0x80000000, 0));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_gt(const int64x4& a, const int64x4& b)
+{
+    return _mm256_cmpgt_epi64(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_gt(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_cmpgt_epi64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_gt(const int64<N>& a, const int64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_gt, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL mask_int64x2 i_cmp_gt(const uint64x2& ca, const uint64x2& cb)
+{
+    uint64<2> a = ca, b = cb;
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_gt(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comgt_epu64(a, b);
+#elif SIMDPP_USE_SSE4_2
+    a = bit_xor(a, 0x8000000000000000); // sub
+    b = bit_xor(b, 0x8000000000000000); // sub
+    return _mm_cmpgt_epi64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcgtq_u64(a, b);
+#else
+    return i_cmp_gt64_emul(a, b, make_uint<uint32x4>(0x80000000));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_gt(const uint64x4& ca, const uint64x4& cb)
+{
+    uint64<4> a = ca, b = cb;
+    a = bit_xor(a, 0x8000000000000000); // sub
+    b = bit_xor(b, 0x8000000000000000); // sub
+    return _mm256_cmpgt_epi64(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_gt(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_cmp_epu64_mask(a, b, _MM_CMPINT_NLE);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_gt(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_gt, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
 SIMDPP_INL mask_float32x4 i_cmp_gt(const float32x4& a, const float32x4& b)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
@@ -14,6 +14,8 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/make_shuffle_bytes_mask.h>
+#include <simdpp/detail/insn/bit_not.h>
+#include <simdpp/detail/insn/cmp_gt.h>
 #include <simdpp/detail/null/compare.h>
 
 namespace simdpp {
@@ -23,6 +25,75 @@ namespace SIMDPP_ARCH_NAMESPACE {
 namespace detail {
 namespace insn {
 
+SIMDPP_INL mask_int64x2 i_cmp_le(const int64x2& a, const int64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_le(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comle_epi64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcleq_s64(a, b);
+#else
+    return i_bit_not(i_cmp_gt(a, b));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_le(const int64x4& a, const int64x4& b)
+{
+    return i_bit_not(i_cmp_gt(a, b));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_le(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_cmple_epi64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_le(const int64<N>& a, const int64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_le, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL mask_int64x2 i_cmp_le(const uint64x2& a, const uint64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_le(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comle_epu64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcleq_u64(a, b);
+#else
+    return i_bit_not(i_cmp_gt(a, b));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_le(const uint64x4& a, const uint64x4& b)
+{
+    return i_bit_not(i_cmp_gt(a, b));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_le(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_cmple_epu64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_le(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_le, a, b);
+}
+
+// -----------------------------------------------------------------------------
 
 SIMDPP_INL mask_float32x4 i_cmp_le(const float32x4& a, const float32x4& b)
 {
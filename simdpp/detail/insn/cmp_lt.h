@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/bit_xor.h>
+#include <simdpp/detail/insn/cmp_gt.h>
 #include <simdpp/detail/null/compare.h>
 
 namespace simdpp {
@@ -44,6 +45,13 @@ SIMDPP_INL mask_int8x32 i_cmp_lt(const int8x32& a, const int8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_lt(const int8<64>& a, const int8<64>& b)
+{
+    return _mm512_cmplt_epi8_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_lt(const int8<N>& a, const int8<N>& b)
 {
@@ -80,6 +88,13 @@ SIMDPP_INL mask_int8x32 i_cmp_lt(const uint8x32& ca, const uint8x32& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_lt(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_cmplt_epu8_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_lt(const uint8<N>& a, const uint8<N>& b)
 {
@@ -108,6 +123,13 @@ SIMDPP_INL mask_int16x16 i_cmp_lt(const int16x16& a, const int16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_lt(const int16<32>& a, const int16<32>& b)
+{
+    return _mm512_cmplt_epi16_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_lt(const int16<N>& a, const int16<N>& b)
 {
@@ -145,6 +167,13 @@ SIMDPP_INL mask_int16x16 i_cmp_lt(const uint16x16& ca, const uint16x16& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_lt(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_cmplt_epu16_mask(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_lt(const uint16<N>& a, const uint16<N>& b)
 {
@@ -233,6 +262,76 @@ mask_int32<N> i_cmp_lt(const uint32<N>& a, const uint32<N>& b)
 
 // -----------------------------------------------------------------------------
 
+SIMDPP_INL mask_int64x2 i_cmp_lt(const int64x2& a, const int64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_lt(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comlt_epi64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcltq_s64(a, b);
+#else
+    return i_cmp_gt(b, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_lt(const int64x4& a, const int64x4& b)
+{
+    return _mm256_cmpgt_epi64(b, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_lt(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_cmpgt_epi64_mask(b, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_lt(const int64<N>& a, const int64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_lt, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL mask_int64x2 i_cmp_lt(const uint64x2& a, const uint64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::cmp_lt(a, b);
+#elif SIMDPP_USE_XOP && !SIMDPP_WORKAROUND_XOP_COM
+    return _mm_comlt_epu64(a, b);
+#elif SIMDPP_USE_NEON64
+    return vcltq_u64(a, b);
+#else
+    return i_cmp_gt(b, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL mask_int64x4 i_cmp_lt(const uint64x4& a, const uint64x4& b)
+{
+    return i_cmp_gt(b, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL mask_int64<8> i_cmp_lt(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_cmplt_epu64_mask(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+mask_int64<N> i_cmp_lt(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(mask_int64<N>, i_cmp_lt, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
 SIMDPP_INL mask_float32x4 i_cmp_lt(const float32x4& a, const float32x4& b)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
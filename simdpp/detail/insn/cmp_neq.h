@@ -13,6 +13,7 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_not.h>
 #include <simdpp/core/cmp_eq.h>
 #include <simdpp/detail/not_implemented.h>
@@ -44,6 +45,18 @@ SIMDPP_INL mask_int8x32 i_cmp_neq(const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int8<64> i_cmp_neq(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_cmpneq_epu8_mask(a, b);
+}
+
+SIMDPP_INL mask_int8<64> i_cmp_neq(const mask_int8<64>& a, const mask_int8<64>& b)
+{
+    return _kxor_mask64(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int8<N> i_cmp_neq(const uint8<N>& a, const uint8<N>& b)
 {
@@ -70,6 +83,18 @@ SIMDPP_INL mask_int16x16 i_cmp_neq(const uint16x16& a, const uint16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL mask_int16<32> i_cmp_neq(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_cmpneq_epu16_mask(a, b);
+}
+
+SIMDPP_INL mask_int16<32> i_cmp_neq(const mask_int16<32>& a, const mask_int16<32>& b)
+{
+    return _kxor_mask32(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 mask_int16<N> i_cmp_neq(const uint16<N>& a, const uint16<N>& b)
 {
@@ -129,8 +154,9 @@ SIMDPP_INL mask_int64x2 i_cmp_neq(const uint64x2& a, const uint64x2& b)
     r32 = (uint32x4)cmp_eq(uint32x4(a), uint32x4(b));
     // swap the 32-bit halves
     r32s = bit_or(shift_l<32>(r32), shift_r<32>(r32));
-    // combine the results. Each 32-bit half is ORed with the neighbouring pair
-    r32 = bit_or(r32, r32s);
+    // combine the results. The elements are equal only if both 32-bit halves
+    // are equal
+    r32 = bit_not(bit_and(r32, r32s));
     return r32;
 #elif SIMDPP_USE_ALTIVEC
     uint16x8 mask = make_shuffle_bytes16_mask<0, 2, 1, 3>(mask);
@@ -32,6 +32,18 @@ uint8<32> i_combine(const uint8<16>& a, const uint8<16>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class V = void> SIMDPP_INL
+uint8<64> i_combine(const uint8<32>& a, const uint8<32>& b)
+{
+    uint8<64> r;
+    // r = _mm512_castsi256_si512(a); GCC BUG
+    r = _mm512_inserti64x4(r, a, 0);
+    r = _mm512_inserti64x4(r, b, 1);
+    return r;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 #if SIMDPP_USE_AVX2
@@ -45,6 +57,18 @@ uint16<16> i_combine(const uint16<8>& a, const uint16<8>& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class V = void> SIMDPP_INL
+uint16<32> i_combine(const uint16<16>& a, const uint16<16>& b)
+{
+    uint16<32> r;
+    // r = _mm512_castsi256_si512(a); GCC BUG
+    r = _mm512_inserti64x4(r, a, 0);
+    r = _mm512_inserti64x4(r, b, 1);
+    return r;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 #if SIMDPP_USE_AVX2
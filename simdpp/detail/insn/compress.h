@@ -0,0 +1,502 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_add_sat.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/detail/insn/compress_lut.h>
+#include <simdpp/detail/insn/to_bitmask.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+SIMDPP_INL unsigned i_compress_popcount(uint32_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f;
+    return (x * 0x01010101) >> 24;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_compress_bits_emul(const V& a, unsigned bits)
+{
+    mem_block<V> ma(a);
+    mem_block<V> r(V::zero());
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        if ((bits >> i) & 1) {
+            r[n++] = ma[i];
+        }
+    }
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V i_expand_bits_emul(const V& a, unsigned bits)
+{
+    mem_block<V> ma(a);
+    mem_block<V> r(V::zero());
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        if ((bits >> i) & 1) {
+            r[i] = ma[n++];
+        }
+    }
+    return r;
+}
+
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+/*  Converts a lookup table entry containing up to 8 element indices to a byte
+    permutation mask for elements that are S bytes wide. The unused indices
+    are 255 which remain negative when scaled.
+*/
+template<unsigned S> SIMDPP_INL
+uint8x16 i_compress_lut_to_perm(const uint8_t* entry)
+{
+    SIMDPP_ALIGN(16) uint8_t buf[16];
+    std::memcpy(buf, entry, 8);
+    std::memcpy(buf + 8, entry, 8);
+    uint8x16 idx = load(buf);
+
+    uint8x16 spread, offset;
+    if (S == 2) {
+        spread = make_uint(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+        offset = make_uint(0, 1);
+    } else if (S == 4) {
+        spread = make_uint(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3);
+        offset = make_uint(0, 1, 2, 3);
+    } else {
+        spread = make_uint(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+        offset = make_uint(0, 1, 2, 3, 4, 5, 6, 7);
+    }
+    idx = permute_zbytes16(idx, spread);
+    for (unsigned i = 1; i < S; i *= 2) {
+        idx = add(idx, idx);
+    }
+    return add(idx, offset);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Compresses a native vector given the mask as an integer
+
+SIMDPP_INL uint8x16 i_compress_bits(const uint8x16& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    // The halves are compressed using separate lookups. The permutation mask
+    // for the higher half is placed right after the selected elements of the
+    // lower half.
+    uint64_t lo, hi;
+    const uint64_t none = 0xffffffffffffffff;
+    std::memcpy(&lo, i_compress_lut(bits & 0xff), 8);
+    std::memcpy(&hi, i_compress_lut((bits >> 8) & 0xff), 8);
+    hi |= 0x0808080808080808;
+    unsigned n = i_compress_popcount(bits & 0xff);
+
+    SIMDPP_ALIGN(16) uint8_t buf[24];
+    std::memcpy(buf, &lo, 8);
+    std::memcpy(buf + 8, &none, 8);
+    std::memcpy(buf + 16, &none, 8);
+    std::memcpy(buf + n, &hi, 8);
+    uint8x16 perm = load(buf);
+    return permute_zbytes16(a, perm);
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint16x8 i_compress_bits(const uint16x8& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<2>(i_compress_lut(bits));
+    return (uint16x8) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint32x4 i_compress_bits(const uint32x4& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<4>(i_compress_lut(bits));
+    return (uint32x4) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint64x2 i_compress_bits(const uint64x2& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<8>(i_compress_lut(bits));
+    return (uint64x2) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_compress_bits_emul(a, bits);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_compress_bits(const uint32x8& a, unsigned bits)
+{
+    const __m128i* entry = reinterpret_cast<const __m128i*>(i_compress_lut(bits));
+    __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(entry));
+    __m256i r = _mm256_permutevar8x32_epi32(a, idx);
+    // the unused indices are 255
+    __m256i unused = _mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7));
+    return _mm256_andnot_si256(unused, r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_compress_bits(const uint32<16>& a, unsigned bits)
+{
+    return _mm512_maskz_compress_epi32(bits, a);
+}
+
+SIMDPP_INL uint64<8> i_compress_bits(const uint64<8>& a, unsigned bits)
+{
+    return _mm512_maskz_compress_epi64(bits, a);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Expands a native vector given the mask as an integer
+
+SIMDPP_INL uint8x16 i_expand_bits(const uint8x16& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    // The indices for the higher half are offset by the number of elements
+    // selected in the lower half. The unused indices saturate at 255.
+    unsigned n = i_compress_popcount(bits & 0xff);
+    SIMDPP_ALIGN(16) uint8_t buf[16];
+    SIMDPP_ALIGN(16) uint8_t off[16];
+    std::memcpy(buf, i_expand_lut(bits & 0xff), 8);
+    std::memcpy(buf + 8, i_expand_lut((bits >> 8) & 0xff), 8);
+    std::memset(off, 0, 8);
+    std::memset(off + 8, n, 8);
+    uint8x16 perm = load(buf);
+    perm = add_sat(perm, load<uint8x16>(off));
+    return permute_zbytes16(a, perm);
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint16x8 i_expand_bits(const uint16x8& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<2>(i_expand_lut(bits));
+    return (uint16x8) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint32x4 i_expand_bits(const uint32x4& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<4>(i_expand_lut(bits));
+    return (uint32x4) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+SIMDPP_INL uint64x2 i_expand_bits(const uint64x2& a, unsigned bits)
+{
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC
+    uint8x16 perm = i_compress_lut_to_perm<8>(i_expand_lut(bits));
+    return (uint64x2) permute_zbytes16(uint8x16(a), perm);
+#else
+    return i_expand_bits_emul(a, bits);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_expand_bits(const uint32x8& a, unsigned bits)
+{
+    const __m128i* entry = reinterpret_cast<const __m128i*>(i_expand_lut(bits));
+    __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(entry));
+    __m256i r = _mm256_permutevar8x32_epi32(a, idx);
+    __m256i unused = _mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7));
+    return _mm256_andnot_si256(unused, r);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+/*  Stores the selected elements of a native vector to memory and returns
+    their number. Exactly that number of elements is written.
+*/
+template<class V> SIMDPP_INL
+unsigned i_compress_store_vec(typename V::element_type* p, const V& a,
+                              unsigned bits)
+{
+    mem_block<V> r(i_compress_bits(a, bits));
+    unsigned n = i_compress_popcount(bits);
+    std::memcpy(p, &r[0], n * sizeof(typename V::element_type));
+    return n;
+}
+
+/*  Expands the elements loaded from memory to the positions selected by the
+    mask and returns the number of consumed elements. Only that number of
+    elements is read.
+*/
+template<class V> SIMDPP_INL
+unsigned i_expand_load_vec(V& r, const typename V::element_type* p,
+                           unsigned bits)
+{
+    mem_block<V> b(V::zero());
+    unsigned n = i_compress_popcount(bits);
+    std::memcpy(&b[0], p, n * sizeof(typename V::element_type));
+    r = i_expand_bits(V(b), bits);
+    return n;
+}
+
+#if SIMDPP_USE_AVX2
+// The 256-bit vectors without a cross-lane byte permute are handled in halves
+template<class V, class H> SIMDPP_INL
+unsigned i_compress_store_halves(typename V::element_type* p, const V& a,
+                                 unsigned bits)
+{
+    const unsigned half = V::length / 2;
+    H a0, a1;
+    split(a, a0, a1);
+    unsigned n = i_compress_store_vec(p, a0, bits & ((1u << half) - 1));
+    n += i_compress_store_vec(p + n, a1, bits >> half);
+    return n;
+}
+
+template<class V, class H> SIMDPP_INL
+unsigned i_expand_load_halves(V& r, const typename V::element_type* p,
+                              unsigned bits)
+{
+    const unsigned half = V::length / 2;
+    H r0, r1;
+    unsigned n = i_expand_load_vec(r0, p, bits & ((1u << half) - 1));
+    n += i_expand_load_vec(r1, p + n, bits >> half);
+    r = combine(r0, r1);
+    return n;
+}
+
+SIMDPP_INL unsigned i_compress_store_vec(uint8_t* p, const uint8x32& a,
+                                         unsigned bits)
+{
+    return i_compress_store_halves<uint8x32, uint8x16>(p, a, bits);
+}
+
+SIMDPP_INL unsigned i_compress_store_vec(uint16_t* p, const uint16x16& a,
+                                         unsigned bits)
+{
+    return i_compress_store_halves<uint16x16, uint16x8>(p, a, bits);
+}
+
+SIMDPP_INL unsigned i_compress_store_vec(uint64_t* p, const uint64x4& a,
+                                         unsigned bits)
+{
+    return i_compress_store_halves<uint64x4, uint64x2>(p, a, bits);
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint8x32& r, const uint8_t* p,
+                                      unsigned bits)
+{
+    return i_expand_load_halves<uint8x32, uint8x16>(r, p, bits);
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint16x16& r, const uint16_t* p,
+                                      unsigned bits)
+{
+    return i_expand_load_halves<uint16x16, uint16x8>(r, p, bits);
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint64x4& r, const uint64_t* p,
+                                      unsigned bits)
+{
+    return i_expand_load_halves<uint64x4, uint64x2>(r, p, bits);
+}
+
+template<class V> SIMDPP_INL
+V i_compress_bits_via_store(const V& a, unsigned bits)
+{
+    mem_block<V> r(V::zero());
+    i_compress_store_vec(&r[0], a, bits);
+    return r;
+}
+
+SIMDPP_INL uint8x32 i_compress_bits(const uint8x32& a, unsigned bits)
+{
+    return i_compress_bits_via_store(a, bits);
+}
+
+SIMDPP_INL uint16x16 i_compress_bits(const uint16x16& a, unsigned bits)
+{
+    return i_compress_bits_via_store(a, bits);
+}
+
+SIMDPP_INL uint64x4 i_compress_bits(const uint64x4& a, unsigned bits)
+{
+    return i_compress_bits_via_store(a, bits);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL unsigned i_compress_store_vec(uint32_t* p, const uint32<16>& a,
+                                         unsigned bits)
+{
+    _mm512_mask_compressstoreu_epi32(p, bits, a);
+    return i_compress_popcount(bits);
+}
+
+SIMDPP_INL unsigned i_compress_store_vec(uint64_t* p, const uint64<8>& a,
+                                         unsigned bits)
+{
+    _mm512_mask_compressstoreu_epi64(p, bits, a);
+    return i_compress_popcount(bits);
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint32<16>& r, const uint32_t* p,
+                                      unsigned bits)
+{
+    r = _mm512_maskz_expandloadu_epi32(bits, p);
+    return i_compress_popcount(bits);
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint64<8>& r, const uint64_t* p,
+                                      unsigned bits)
+{
+    r = _mm512_maskz_expandloadu_epi64(bits, p);
+    return i_compress_popcount(bits);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+// The byte and word compress instructions need AVX512-VBMI2, thus the vectors
+// are handled in halves. The 8-bit vectors take 64-bit element masks.
+SIMDPP_INL unsigned i_compress_store_vec(uint8_t* p, const uint8<64>& a,
+                                         uint64_t bits)
+{
+    uint8<32> a0, a1;
+    split(a, a0, a1);
+    unsigned n = i_compress_store_vec(p, a0, unsigned(bits));
+    n += i_compress_store_vec(p + n, a1, unsigned(bits >> 32));
+    return n;
+}
+
+SIMDPP_INL unsigned i_compress_store_vec(uint16_t* p, const uint16<32>& a,
+                                         unsigned bits)
+{
+    uint16<16> a0, a1;
+    split(a, a0, a1);
+    unsigned n = i_compress_store_vec(p, a0, bits & 0xffff);
+    n += i_compress_store_vec(p + n, a1, bits >> 16);
+    return n;
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint8<64>& r, const uint8_t* p,
+                                      uint64_t bits)
+{
+    uint8<32> r0, r1;
+    unsigned n = i_expand_load_vec(r0, p, unsigned(bits));
+    n += i_expand_load_vec(r1, p + n, unsigned(bits >> 32));
+    r = combine(r0, r1);
+    return n;
+}
+
+SIMDPP_INL unsigned i_expand_load_vec(uint16<32>& r, const uint16_t* p,
+                                      unsigned bits)
+{
+    uint16<16> r0, r1;
+    unsigned n = i_expand_load_vec(r0, p, bits & 0xffff);
+    n += i_expand_load_vec(r1, p + n, bits >> 16);
+    r = combine(r0, r1);
+    return n;
+}
+
+SIMDPP_INL uint8<64> i_compress_bits(const uint8<64>& a, uint64_t bits)
+{
+    mem_block<uint8<64>> r(uint8<64>::zero());
+    i_compress_store_vec(&r[0], a, bits);
+    return r;
+}
+
+SIMDPP_INL uint16<32> i_compress_bits(const uint16<32>& a, unsigned bits)
+{
+    mem_block<uint16<32>> r(uint16<32>::zero());
+    i_compress_store_vec(&r[0], a, bits);
+    return r;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+unsigned i_compress_store(typename V::element_type* p, const V& a, const M& mask)
+{
+    unsigned n = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        n += i_compress_store_vec(p + n, a.vec(j),
+                                  i_to_bitmask(mask.vec(j)));
+    }
+    return n;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_compress(const V& a, const M& mask)
+{
+    if (a.vec_length == 1) {
+        V r;
+        r.vec(0) = i_compress_bits(a.vec(0), i_to_bitmask(mask.vec(0)));
+        return r;
+    }
+    mem_block<V> r(V::zero());
+    i_compress_store(&r[0], a, mask);
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+V i_expand_load(const typename V::element_type* p, const M& mask)
+{
+    V r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        p += i_expand_load_vec(r.vec(j), p, i_to_bitmask(mask.vec(j)));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,312 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_LUT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_LUT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Lookup table for compressing 8 elements according to a 8-bit mask. The
+    entry for a mask lists the indices of the set bits in increasing order.
+    The remaining bytes are 255, so that the corresponding elements are
+    zeroed by permute_zbytes16 even after the indices are scaled to multi-byte
+    elements.
+*/
+SIMDPP_INL const uint8_t* i_compress_lut(unsigned bits)
+{
+    static const uint8_t lut[256][8] = {
+        { 255,255,255,255,255,255,255,255 }, {   0,255,255,255,255,255,255,255 },
+        {   1,255,255,255,255,255,255,255 }, {   0,  1,255,255,255,255,255,255 },
+        {   2,255,255,255,255,255,255,255 }, {   0,  2,255,255,255,255,255,255 },
+        {   1,  2,255,255,255,255,255,255 }, {   0,  1,  2,255,255,255,255,255 },
+        {   3,255,255,255,255,255,255,255 }, {   0,  3,255,255,255,255,255,255 },
+        {   1,  3,255,255,255,255,255,255 }, {   0,  1,  3,255,255,255,255,255 },
+        {   2,  3,255,255,255,255,255,255 }, {   0,  2,  3,255,255,255,255,255 },
+        {   1,  2,  3,255,255,255,255,255 }, {   0,  1,  2,  3,255,255,255,255 },
+        {   4,255,255,255,255,255,255,255 }, {   0,  4,255,255,255,255,255,255 },
+        {   1,  4,255,255,255,255,255,255 }, {   0,  1,  4,255,255,255,255,255 },
+        {   2,  4,255,255,255,255,255,255 }, {   0,  2,  4,255,255,255,255,255 },
+        {   1,  2,  4,255,255,255,255,255 }, {   0,  1,  2,  4,255,255,255,255 },
+        {   3,  4,255,255,255,255,255,255 }, {   0,  3,  4,255,255,255,255,255 },
+        {   1,  3,  4,255,255,255,255,255 }, {   0,  1,  3,  4,255,255,255,255 },
+        {   2,  3,  4,255,255,255,255,255 }, {   0,  2,  3,  4,255,255,255,255 },
+        {   1,  2,  3,  4,255,255,255,255 }, {   0,  1,  2,  3,  4,255,255,255 },
+        {   5,255,255,255,255,255,255,255 }, {   0,  5,255,255,255,255,255,255 },
+        {   1,  5,255,255,255,255,255,255 }, {   0,  1,  5,255,255,255,255,255 },
+        {   2,  5,255,255,255,255,255,255 }, {   0,  2,  5,255,255,255,255,255 },
+        {   1,  2,  5,255,255,255,255,255 }, {   0,  1,  2,  5,255,255,255,255 },
+        {   3,  5,255,255,255,255,255,255 }, {   0,  3,  5,255,255,255,255,255 },
+        {   1,  3,  5,255,255,255,255,255 }, {   0,  1,  3,  5,255,255,255,255 },
+        {   2,  3,  5,255,255,255,255,255 }, {   0,  2,  3,  5,255,255,255,255 },
+        {   1,  2,  3,  5,255,255,255,255 }, {   0,  1,  2,  3,  5,255,255,255 },
+        {   4,  5,255,255,255,255,255,255 }, {   0,  4,  5,255,255,255,255,255 },
+        {   1,  4,  5,255,255,255,255,255 }, {   0,  1,  4,  5,255,255,255,255 },
+        {   2,  4,  5,255,255,255,255,255 }, {   0,  2,  4,  5,255,255,255,255 },
+        {   1,  2,  4,  5,255,255,255,255 }, {   0,  1,  2,  4,  5,255,255,255 },
+        {   3,  4,  5,255,255,255,255,255 }, {   0,  3,  4,  5,255,255,255,255 },
+        {   1,  3,  4,  5,255,255,255,255 }, {   0,  1,  3,  4,  5,255,255,255 },
+        {   2,  3,  4,  5,255,255,255,255 }, {   0,  2,  3,  4,  5,255,255,255 },
+        {   1,  2,  3,  4,  5,255,255,255 }, {   0,  1,  2,  3,  4,  5,255,255 },
+        {   6,255,255,255,255,255,255,255 }, {   0,  6,255,255,255,255,255,255 },
+        {   1,  6,255,255,255,255,255,255 }, {   0,  1,  6,255,255,255,255,255 },
+        {   2,  6,255,255,255,255,255,255 }, {   0,  2,  6,255,255,255,255,255 },
+        {   1,  2,  6,255,255,255,255,255 }, {   0,  1,  2,  6,255,255,255,255 },
+        {   3,  6,255,255,255,255,255,255 }, {   0,  3,  6,255,255,255,255,255 },
+        {   1,  3,  6,255,255,255,255,255 }, {   0,  1,  3,  6,255,255,255,255 },
+        {   2,  3,  6,255,255,255,255,255 }, {   0,  2,  3,  6,255,255,255,255 },
+        {   1,  2,  3,  6,255,255,255,255 }, {   0,  1,  2,  3,  6,255,255,255 },
+        {   4,  6,255,255,255,255,255,255 }, {   0,  4,  6,255,255,255,255,255 },
+        {   1,  4,  6,255,255,255,255,255 }, {   0,  1,  4,  6,255,255,255,255 },
+        {   2,  4,  6,255,255,255,255,255 }, {   0,  2,  4,  6,255,255,255,255 },
+        {   1,  2,  4,  6,255,255,255,255 }, {   0,  1,  2,  4,  6,255,255,255 },
+        {   3,  4,  6,255,255,255,255,255 }, {   0,  3,  4,  6,255,255,255,255 },
+        {   1,  3,  4,  6,255,255,255,255 }, {   0,  1,  3,  4,  6,255,255,255 },
+        {   2,  3,  4,  6,255,255,255,255 }, {   0,  2,  3,  4,  6,255,255,255 },
+        {   1,  2,  3,  4,  6,255,255,255 }, {   0,  1,  2,  3,  4,  6,255,255 },
+        {   5,  6,255,255,255,255,255,255 }, {   0,  5,  6,255,255,255,255,255 },
+        {   1,  5,  6,255,255,255,255,255 }, {   0,  1,  5,  6,255,255,255,255 },
+        {   2,  5,  6,255,255,255,255,255 }, {   0,  2,  5,  6,255,255,255,255 },
+        {   1,  2,  5,  6,255,255,255,255 }, {   0,  1,  2,  5,  6,255,255,255 },
+        {   3,  5,  6,255,255,255,255,255 }, {   0,  3,  5,  6,255,255,255,255 },
+        {   1,  3,  5,  6,255,255,255,255 }, {   0,  1,  3,  5,  6,255,255,255 },
+        {   2,  3,  5,  6,255,255,255,255 }, {   0,  2,  3,  5,  6,255,255,255 },
+        {   1,  2,  3,  5,  6,255,255,255 }, {   0,  1,  2,  3,  5,  6,255,255 },
+        {   4,  5,  6,255,255,255,255,255 }, {   0,  4,  5,  6,255,255,255,255 },
+        {   1,  4,  5,  6,255,255,255,255 }, {   0,  1,  4,  5,  6,255,255,255 },
+        {   2,  4,  5,  6,255,255,255,255 }, {   0,  2,  4,  5,  6,255,255,255 },
+        {   1,  2,  4,  5,  6,255,255,255 }, {   0,  1,  2,  4,  5,  6,255,255 },
+        {   3,  4,  5,  6,255,255,255,255 }, {   0,  3,  4,  5,  6,255,255,255 },
+        {   1,  3,  4,  5,  6,255,255,255 }, {   0,  1,  3,  4,  5,  6,255,255 },
+        {   2,  3,  4,  5,  6,255,255,255 }, {   0,  2,  3,  4,  5,  6,255,255 },
+        {   1,  2,  3,  4,  5,  6,255,255 }, {   0,  1,  2,  3,  4,  5,  6,255 },
+        {   7,255,255,255,255,255,255,255 }, {   0,  7,255,255,255,255,255,255 },
+        {   1,  7,255,255,255,255,255,255 }, {   0,  1,  7,255,255,255,255,255 },
+        {   2,  7,255,255,255,255,255,255 }, {   0,  2,  7,255,255,255,255,255 },
+        {   1,  2,  7,255,255,255,255,255 }, {   0,  1,  2,  7,255,255,255,255 },
+        {   3,  7,255,255,255,255,255,255 }, {   0,  3,  7,255,255,255,255,255 },
+        {   1,  3,  7,255,255,255,255,255 }, {   0,  1,  3,  7,255,255,255,255 },
+        {   2,  3,  7,255,255,255,255,255 }, {   0,  2,  3,  7,255,255,255,255 },
+        {   1,  2,  3,  7,255,255,255,255 }, {   0,  1,  2,  3,  7,255,255,255 },
+        {   4,  7,255,255,255,255,255,255 }, {   0,  4,  7,255,255,255,255,255 },
+        {   1,  4,  7,255,255,255,255,255 }, {   0,  1,  4,  7,255,255,255,255 },
+        {   2,  4,  7,255,255,255,255,255 }, {   0,  2,  4,  7,255,255,255,255 },
+        {   1,  2,  4,  7,255,255,255,255 }, {   0,  1,  2,  4,  7,255,255,255 },
+        {   3,  4,  7,255,255,255,255,255 }, {   0,  3,  4,  7,255,255,255,255 },
+        {   1,  3,  4,  7,255,255,255,255 }, {   0,  1,  3,  4,  7,255,255,255 },
+        {   2,  3,  4,  7,255,255,255,255 }, {   0,  2,  3,  4,  7,255,255,255 },
+        {   1,  2,  3,  4,  7,255,255,255 }, {   0,  1,  2,  3,  4,  7,255,255 },
+        {   5,  7,255,255,255,255,255,255 }, {   0,  5,  7,255,255,255,255,255 },
+        {   1,  5,  7,255,255,255,255,255 }, {   0,  1,  5,  7,255,255,255,255 },
+        {   2,  5,  7,255,255,255,255,255 }, {   0,  2,  5,  7,255,255,255,255 },
+        {   1,  2,  5,  7,255,255,255,255 }, {   0,  1,  2,  5,  7,255,255,255 },
+        {   3,  5,  7,255,255,255,255,255 }, {   0,  3,  5,  7,255,255,255,255 },
+        {   1,  3,  5,  7,255,255,255,255 }, {   0,  1,  3,  5,  7,255,255,255 },
+        {   2,  3,  5,  7,255,255,255,255 }, {   0,  2,  3,  5,  7,255,255,255 },
+        {   1,  2,  3,  5,  7,255,255,255 }, {   0,  1,  2,  3,  5,  7,255,255 },
+        {   4,  5,  7,255,255,255,255,255 }, {   0,  4,  5,  7,255,255,255,255 },
+        {   1,  4,  5,  7,255,255,255,255 }, {   0,  1,  4,  5,  7,255,255,255 },
+        {   2,  4,  5,  7,255,255,255,255 }, {   0,  2,  4,  5,  7,255,255,255 },
+        {   1,  2,  4,  5,  7,255,255,255 }, {   0,  1,  2,  4,  5,  7,255,255 },
+        {   3,  4,  5,  7,255,255,255,255 }, {   0,  3,  4,  5,  7,255,255,255 },
+        {   1,  3,  4,  5,  7,255,255,255 }, {   0,  1,  3,  4,  5,  7,255,255 },
+        {   2,  3,  4,  5,  7,255,255,255 }, {   0,  2,  3,  4,  5,  7,255,255 },
+        {   1,  2,  3,  4,  5,  7,255,255 }, {   0,  1,  2,  3,  4,  5,  7,255 },
+        {   6,  7,255,255,255,255,255,255 }, {   0,  6,  7,255,255,255,255,255 },
+        {   1,  6,  7,255,255,255,255,255 }, {   0,  1,  6,  7,255,255,255,255 },
+        {   2,  6,  7,255,255,255,255,255 }, {   0,  2,  6,  7,255,255,255,255 },
+        {   1,  2,  6,  7,255,255,255,255 }, {   0,  1,  2,  6,  7,255,255,255 },
+        {   3,  6,  7,255,255,255,255,255 }, {   0,  3,  6,  7,255,255,255,255 },
+        {   1,  3,  6,  7,255,255,255,255 }, {   0,  1,  3,  6,  7,255,255,255 },
+        {   2,  3,  6,  7,255,255,255,255 }, {   0,  2,  3,  6,  7,255,255,255 },
+        {   1,  2,  3,  6,  7,255,255,255 }, {   0,  1,  2,  3,  6,  7,255,255 },
+        {   4,  6,  7,255,255,255,255,255 }, {   0,  4,  6,  7,255,255,255,255 },
+        {   1,  4,  6,  7,255,255,255,255 }, {   0,  1,  4,  6,  7,255,255,255 },
+        {   2,  4,  6,  7,255,255,255,255 }, {   0,  2,  4,  6,  7,255,255,255 },
+        {   1,  2,  4,  6,  7,255,255,255 }, {   0,  1,  2,  4,  6,  7,255,255 },
+        {   3,  4,  6,  7,255,255,255,255 }, {   0,  3,  4,  6,  7,255,255,255 },
+        {   1,  3,  4,  6,  7,255,255,255 }, {   0,  1,  3,  4,  6,  7,255,255 },
+        {   2,  3,  4,  6,  7,255,255,255 }, {   0,  2,  3,  4,  6,  7,255,255 },
+        {   1,  2,  3,  4,  6,  7,255,255 }, {   0,  1,  2,  3,  4,  6,  7,255 },
+        {   5,  6,  7,255,255,255,255,255 }, {   0,  5,  6,  7,255,255,255,255 },
+        {   1,  5,  6,  7,255,255,255,255 }, {   0,  1,  5,  6,  7,255,255,255 },
+        {   2,  5,  6,  7,255,255,255,255 }, {   0,  2,  5,  6,  7,255,255,255 },
+        {   1,  2,  5,  6,  7,255,255,255 }, {   0,  1,  2,  5,  6,  7,255,255 },
+        {   3,  5,  6,  7,255,255,255,255 }, {   0,  3,  5,  6,  7,255,255,255 },
+        {   1,  3,  5,  6,  7,255,255,255 }, {   0,  1,  3,  5,  6,  7,255,255 },
+        {   2,  3,  5,  6,  7,255,255,255 }, {   0,  2,  3,  5,  6,  7,255,255 },
+        {   1,  2,  3,  5,  6,  7,255,255 }, {   0,  1,  2,  3,  5,  6,  7,255 },
+        {   4,  5,  6,  7,255,255,255,255 }, {   0,  4,  5,  6,  7,255,255,255 },
+        {   1,  4,  5,  6,  7,255,255,255 }, {   0,  1,  4,  5,  6,  7,255,255 },
+        {   2,  4,  5,  6,  7,255,255,255 }, {   0,  2,  4,  5,  6,  7,255,255 },
+        {   1,  2,  4,  5,  6,  7,255,255 }, {   0,  1,  2,  4,  5,  6,  7,255 },
+        {   3,  4,  5,  6,  7,255,255,255 }, {   0,  3,  4,  5,  6,  7,255,255 },
+        {   1,  3,  4,  5,  6,  7,255,255 }, {   0,  1,  3,  4,  5,  6,  7,255 },
+        {   2,  3,  4,  5,  6,  7,255,255 }, {   0,  2,  3,  4,  5,  6,  7,255 },
+        {   1,  2,  3,  4,  5,  6,  7,255 }, {   0,  1,  2,  3,  4,  5,  6,  7 }
+    };
+    return lut[bits];
+}
+
+/*  Lookup table for expanding 8 elements according to a 8-bit mask. Each
+    byte of the entry for a mask contains the number of the set bits below
+    the corresponding bit if that bit is set, or 255 otherwise.
+*/
+SIMDPP_INL const uint8_t* i_expand_lut(unsigned bits)
+{
+    static const uint8_t lut[256][8] = {
+        { 255,255,255,255,255,255,255,255 }, {   0,255,255,255,255,255,255,255 },
+        { 255,  0,255,255,255,255,255,255 }, {   0,  1,255,255,255,255,255,255 },
+        { 255,255,  0,255,255,255,255,255 }, {   0,255,  1,255,255,255,255,255 },
+        { 255,  0,  1,255,255,255,255,255 }, {   0,  1,  2,255,255,255,255,255 },
+        { 255,255,255,  0,255,255,255,255 }, {   0,255,255,  1,255,255,255,255 },
+        { 255,  0,255,  1,255,255,255,255 }, {   0,  1,255,  2,255,255,255,255 },
+        { 255,255,  0,  1,255,255,255,255 }, {   0,255,  1,  2,255,255,255,255 },
+        { 255,  0,  1,  2,255,255,255,255 }, {   0,  1,  2,  3,255,255,255,255 },
+        { 255,255,255,255,  0,255,255,255 }, {   0,255,255,255,  1,255,255,255 },
+        { 255,  0,255,255,  1,255,255,255 }, {   0,  1,255,255,  2,255,255,255 },
+        { 255,255,  0,255,  1,255,255,255 }, {   0,255,  1,255,  2,255,255,255 },
+        { 255,  0,  1,255,  2,255,255,255 }, {   0,  1,  2,255,  3,255,255,255 },
+        { 255,255,255,  0,  1,255,255,255 }, {   0,255,255,  1,  2,255,255,255 },
+        { 255,  0,255,  1,  2,255,255,255 }, {   0,  1,255,  2,  3,255,255,255 },
+        { 255,255,  0,  1,  2,255,255,255 }, {   0,255,  1,  2,  3,255,255,255 },
+        { 255,  0,  1,  2,  3,255,255,255 }, {   0,  1,  2,  3,  4,255,255,255 },
+        { 255,255,255,255,255,  0,255,255 }, {   0,255,255,255,255,  1,255,255 },
+        { 255,  0,255,255,255,  1,255,255 }, {   0,  1,255,255,255,  2,255,255 },
+        { 255,255,  0,255,255,  1,255,255 }, {   0,255,  1,255,255,  2,255,255 },
+        { 255,  0,  1,255,255,  2,255,255 }, {   0,  1,  2,255,255,  3,255,255 },
+        { 255,255,255,  0,255,  1,255,255 }, {   0,255,255,  1,255,  2,255,255 },
+        { 255,  0,255,  1,255,  2,255,255 }, {   0,  1,255,  2,255,  3,255,255 },
+        { 255,255,  0,  1,255,  2,255,255 }, {   0,255,  1,  2,255,  3,255,255 },
+        { 255,  0,  1,  2,255,  3,255,255 }, {   0,  1,  2,  3,255,  4,255,255 },
+        { 255,255,255,255,  0,  1,255,255 }, {   0,255,255,255,  1,  2,255,255 },
+        { 255,  0,255,255,  1,  2,255,255 }, {   0,  1,255,255,  2,  3,255,255 },
+        { 255,255,  0,255,  1,  2,255,255 }, {   0,255,  1,255,  2,  3,255,255 },
+        { 255,  0,  1,255,  2,  3,255,255 }, {   0,  1,  2,255,  3,  4,255,255 },
+        { 255,255,255,  0,  1,  2,255,255 }, {   0,255,255,  1,  2,  3,255,255 },
+        { 255,  0,255,  1,  2,  3,255,255 }, {   0,  1,255,  2,  3,  4,255,255 },
+        { 255,255,  0,  1,  2,  3,255,255 }, {   0,255,  1,  2,  3,  4,255,255 },
+        { 255,  0,  1,  2,  3,  4,255,255 }, {   0,  1,  2,  3,  4,  5,255,255 },
+        { 255,255,255,255,255,255,  0,255 }, {   0,255,255,255,255,255,  1,255 },
+        { 255,  0,255,255,255,255,  1,255 }, {   0,  1,255,255,255,255,  2,255 },
+        { 255,255,  0,255,255,255,  1,255 }, {   0,255,  1,255,255,255,  2,255 },
+        { 255,  0,  1,255,255,255,  2,255 }, {   0,  1,  2,255,255,255,  3,255 },
+        { 255,255,255,  0,255,255,  1,255 }, {   0,255,255,  1,255,255,  2,255 },
+        { 255,  0,255,  1,255,255,  2,255 }, {   0,  1,255,  2,255,255,  3,255 },
+        { 255,255,  0,  1,255,255,  2,255 }, {   0,255,  1,  2,255,255,  3,255 },
+        { 255,  0,  1,  2,255,255,  3,255 }, {   0,  1,  2,  3,255,255,  4,255 },
+        { 255,255,255,255,  0,255,  1,255 }, {   0,255,255,255,  1,255,  2,255 },
+        { 255,  0,255,255,  1,255,  2,255 }, {   0,  1,255,255,  2,255,  3,255 },
+        { 255,255,  0,255,  1,255,  2,255 }, {   0,255,  1,255,  2,255,  3,255 },
+        { 255,  0,  1,255,  2,255,  3,255 }, {   0,  1,  2,255,  3,255,  4,255 },
+        { 255,255,255,  0,  1,255,  2,255 }, {   0,255,255,  1,  2,255,  3,255 },
+        { 255,  0,255,  1,  2,255,  3,255 }, {   0,  1,255,  2,  3,255,  4,255 },
+        { 255,255,  0,  1,  2,255,  3,255 }, {   0,255,  1,  2,  3,255,  4,255 },
+        { 255,  0,  1,  2,  3,255,  4,255 }, {   0,  1,  2,  3,  4,255,  5,255 },
+        { 255,255,255,255,255,  0,  1,255 }, {   0,255,255,255,255,  1,  2,255 },
+        { 255,  0,255,255,255,  1,  2,255 }, {   0,  1,255,255,255,  2,  3,255 },
+        { 255,255,  0,255,255,  1,  2,255 }, {   0,255,  1,255,255,  2,  3,255 },
+        { 255,  0,  1,255,255,  2,  3,255 }, {   0,  1,  2,255,255,  3,  4,255 },
+        { 255,255,255,  0,255,  1,  2,255 }, {   0,255,255,  1,255,  2,  3,255 },
+        { 255,  0,255,  1,255,  2,  3,255 }, {   0,  1,255,  2,255,  3,  4,255 },
+        { 255,255,  0,  1,255,  2,  3,255 }, {   0,255,  1,  2,255,  3,  4,255 },
+        { 255,  0,  1,  2,255,  3,  4,255 }, {   0,  1,  2,  3,255,  4,  5,255 },
+        { 255,255,255,255,  0,  1,  2,255 }, {   0,255,255,255,  1,  2,  3,255 },
+        { 255,  0,255,255,  1,  2,  3,255 }, {   0,  1,255,255,  2,  3,  4,255 },
+        { 255,255,  0,255,  1,  2,  3,255 }, {   0,255,  1,255,  2,  3,  4,255 },
+        { 255,  0,  1,255,  2,  3,  4,255 }, {   0,  1,  2,255,  3,  4,  5,255 },
+        { 255,255,255,  0,  1,  2,  3,255 }, {   0,255,255,  1,  2,  3,  4,255 },
+        { 255,  0,255,  1,  2,  3,  4,255 }, {   0,  1,255,  2,  3,  4,  5,255 },
+        { 255,255,  0,  1,  2,  3,  4,255 }, {   0,255,  1,  2,  3,  4,  5,255 },
+        { 255,  0,  1,  2,  3,  4,  5,255 }, {   0,  1,  2,  3,  4,  5,  6,255 },
+        { 255,255,255,255,255,255,255,  0 }, {   0,255,255,255,255,255,255,  1 },
+        { 255,  0,255,255,255,255,255,  1 }, {   0,  1,255,255,255,255,255,  2 },
+        { 255,255,  0,255,255,255,255,  1 }, {   0,255,  1,255,255,255,255,  2 },
+        { 255,  0,  1,255,255,255,255,  2 }, {   0,  1,  2,255,255,255,255,  3 },
+        { 255,255,255,  0,255,255,255,  1 }, {   0,255,255,  1,255,255,255,  2 },
+        { 255,  0,255,  1,255,255,255,  2 }, {   0,  1,255,  2,255,255,255,  3 },
+        { 255,255,  0,  1,255,255,255,  2 }, {   0,255,  1,  2,255,255,255,  3 },
+        { 255,  0,  1,  2,255,255,255,  3 }, {   0,  1,  2,  3,255,255,255,  4 },
+        { 255,255,255,255,  0,255,255,  1 }, {   0,255,255,255,  1,255,255,  2 },
+        { 255,  0,255,255,  1,255,255,  2 }, {   0,  1,255,255,  2,255,255,  3 },
+        { 255,255,  0,255,  1,255,255,  2 }, {   0,255,  1,255,  2,255,255,  3 },
+        { 255,  0,  1,255,  2,255,255,  3 }, {   0,  1,  2,255,  3,255,255,  4 },
+        { 255,255,255,  0,  1,255,255,  2 }, {   0,255,255,  1,  2,255,255,  3 },
+        { 255,  0,255,  1,  2,255,255,  3 }, {   0,  1,255,  2,  3,255,255,  4 },
+        { 255,255,  0,  1,  2,255,255,  3 }, {   0,255,  1,  2,  3,255,255,  4 },
+        { 255,  0,  1,  2,  3,255,255,  4 }, {   0,  1,  2,  3,  4,255,255,  5 },
+        { 255,255,255,255,255,  0,255,  1 }, {   0,255,255,255,255,  1,255,  2 },
+        { 255,  0,255,255,255,  1,255,  2 }, {   0,  1,255,255,255,  2,255,  3 },
+        { 255,255,  0,255,255,  1,255,  2 }, {   0,255,  1,255,255,  2,255,  3 },
+        { 255,  0,  1,255,255,  2,255,  3 }, {   0,  1,  2,255,255,  3,255,  4 },
+        { 255,255,255,  0,255,  1,255,  2 }, {   0,255,255,  1,255,  2,255,  3 },
+        { 255,  0,255,  1,255,  2,255,  3 }, {   0,  1,255,  2,255,  3,255,  4 },
+        { 255,255,  0,  1,255,  2,255,  3 }, {   0,255,  1,  2,255,  3,255,  4 },
+        { 255,  0,  1,  2,255,  3,255,  4 }, {   0,  1,  2,  3,255,  4,255,  5 },
+        { 255,255,255,255,  0,  1,255,  2 }, {   0,255,255,255,  1,  2,255,  3 },
+        { 255,  0,255,255,  1,  2,255,  3 }, {   0,  1,255,255,  2,  3,255,  4 },
+        { 255,255,  0,255,  1,  2,255,  3 }, {   0,255,  1,255,  2,  3,255,  4 },
+        { 255,  0,  1,255,  2,  3,255,  4 }, {   0,  1,  2,255,  3,  4,255,  5 },
+        { 255,255,255,  0,  1,  2,255,  3 }, {   0,255,255,  1,  2,  3,255,  4 },
+        { 255,  0,255,  1,  2,  3,255,  4 }, {   0,  1,255,  2,  3,  4,255,  5 },
+        { 255,255,  0,  1,  2,  3,255,  4 }, {   0,255,  1,  2,  3,  4,255,  5 },
+        { 255,  0,  1,  2,  3,  4,255,  5 }, {   0,  1,  2,  3,  4,  5,255,  6 },
+        { 255,255,255,255,255,255,  0,  1 }, {   0,255,255,255,255,255,  1,  2 },
+        { 255,  0,255,255,255,255,  1,  2 }, {   0,  1,255,255,255,255,  2,  3 },
+        { 255,255,  0,255,255,255,  1,  2 }, {   0,255,  1,255,255,255,  2,  3 },
+        { 255,  0,  1,255,255,255,  2,  3 }, {   0,  1,  2,255,255,255,  3,  4 },
+        { 255,255,255,  0,255,255,  1,  2 }, {   0,255,255,  1,255,255,  2,  3 },
+        { 255,  0,255,  1,255,255,  2,  3 }, {   0,  1,255,  2,255,255,  3,  4 },
+        { 255,255,  0,  1,255,255,  2,  3 }, {   0,255,  1,  2,255,255,  3,  4 },
+        { 255,  0,  1,  2,255,255,  3,  4 }, {   0,  1,  2,  3,255,255,  4,  5 },
+        { 255,255,255,255,  0,255,  1,  2 }, {   0,255,255,255,  1,255,  2,  3 },
+        { 255,  0,255,255,  1,255,  2,  3 }, {   0,  1,255,255,  2,255,  3,  4 },
+        { 255,255,  0,255,  1,255,  2,  3 }, {   0,255,  1,255,  2,255,  3,  4 },
+        { 255,  0,  1,255,  2,255,  3,  4 }, {   0,  1,  2,255,  3,255,  4,  5 },
+        { 255,255,255,  0,  1,255,  2,  3 }, {   0,255,255,  1,  2,255,  3,  4 },
+        { 255,  0,255,  1,  2,255,  3,  4 }, {   0,  1,255,  2,  3,255,  4,  5 },
+        { 255,255,  0,  1,  2,255,  3,  4 }, {   0,255,  1,  2,  3,255,  4,  5 },
+        { 255,  0,  1,  2,  3,255,  4,  5 }, {   0,  1,  2,  3,  4,255,  5,  6 },
+        { 255,255,255,255,255,  0,  1,  2 }, {   0,255,255,255,255,  1,  2,  3 },
+        { 255,  0,255,255,255,  1,  2,  3 }, {   0,  1,255,255,255,  2,  3,  4 },
+        { 255,255,  0,255,255,  1,  2,  3 }, {   0,255,  1,255,255,  2,  3,  4 },
+        { 255,  0,  1,255,255,  2,  3,  4 }, {   0,  1,  2,255,255,  3,  4,  5 },
+        { 255,255,255,  0,255,  1,  2,  3 }, {   0,255,255,  1,255,  2,  3,  4 },
+        { 255,  0,255,  1,255,  2,  3,  4 }, {   0,  1,255,  2,255,  3,  4,  5 },
+        { 255,255,  0,  1,255,  2,  3,  4 }, {   0,255,  1,  2,255,  3,  4,  5 },
+        { 255,  0,  1,  2,255,  3,  4,  5 }, {   0,  1,  2,  3,255,  4,  5,  6 },
+        { 255,255,255,255,  0,  1,  2,  3 }, {   0,255,255,255,  1,  2,  3,  4 },
+        { 255,  0,255,255,  1,  2,  3,  4 }, {   0,  1,255,255,  2,  3,  4,  5 },
+        { 255,255,  0,255,  1,  2,  3,  4 }, {   0,255,  1,255,  2,  3,  4,  5 },
+        { 255,  0,  1,255,  2,  3,  4,  5 }, {   0,  1,  2,255,  3,  4,  5,  6 },
+        { 255,255,255,  0,  1,  2,  3,  4 }, {   0,255,255,  1,  2,  3,  4,  5 },
+        { 255,  0,255,  1,  2,  3,  4,  5 }, {   0,  1,255,  2,  3,  4,  5,  6 },
+        { 255,255,  0,  1,  2,  3,  4,  5 }, {   0,255,  1,  2,  3,  4,  5,  6 },
+        { 255,  0,  1,  2,  3,  4,  5,  6 }, {   0,  1,  2,  3,  4,  5,  6,  7 }
+    };
+    return lut[bits];
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,121 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_DOT_BF16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_DOT_BF16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/detail/vec_extract.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Each pair of bfloat16 values occupies one 32-bit element. The value in the
+    high half is converted to float by clearing the low half, the value in the
+    low half by shifting it to the high half. The products of two bfloat16
+    values are exact in binary32, thus fmadd and mul followed by add produce
+    the same results.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_dot_bf16_emul(const bfloat16<N*2>& a, const bfloat16<N*2>& b,
+                           const float32<N>& c)
+{
+    uint32<N> ua = bit_cast<uint32<N>>(a);
+    uint32<N> ub = bit_cast<uint32<N>>(b);
+    uint32<N> mask = make_uint(0xffff0000);
+
+    uint32<N> a_hi, b_hi, a_lo, b_lo;
+    a_hi = bit_and(ua, mask);
+    b_hi = bit_and(ub, mask);
+    a_lo = shift_l<16>(ua);
+    b_lo = shift_l<16>(ub);
+
+    float32<N> fa_hi, fb_hi, fa_lo, fb_lo, r;
+    fa_hi = bit_cast<float32<N>>(a_hi);
+    fb_hi = bit_cast<float32<N>>(b_hi);
+    fa_lo = bit_cast<float32<N>>(a_lo);
+    fb_lo = bit_cast<float32<N>>(b_lo);
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4
+    r = fmadd(fa_hi, fb_hi, c);
+    r = fmadd(fa_lo, fb_lo, r);
+#else
+    r = add(c, mul(fa_hi, fb_hi));
+    r = add(r, mul(fa_lo, fb_lo));
+#endif
+    return r;
+}
+
+#if SIMDPP_USE_AVX512BF16
+SIMDPP_INL float32<4> i_dot_bf16(const bfloat16<8>& a, const bfloat16<8>& b,
+                                 const float32<4>& c)
+{
+    // the instruction raises no floating-point exceptions, thus computing
+    // the undefined upper lanes is harmless
+    __m512bh a2 = (__m512bh) _mm512_castsi128_si512(a);
+    __m512bh b2 = (__m512bh) _mm512_castsi128_si512(b);
+    __m512 r = _mm512_dpbf16_ps(_mm512_castps128_ps512(c), a2, b2);
+    return _mm512_castps512_ps128(r);
+}
+
+SIMDPP_INL float32<8> i_dot_bf16(const bfloat16<16>& a, const bfloat16<16>& b,
+                                 const float32<8>& c)
+{
+    __m512bh a2 = (__m512bh) _mm512_castsi256_si512(a);
+    __m512bh b2 = (__m512bh) _mm512_castsi256_si512(b);
+    __m512 r = _mm512_dpbf16_ps(_mm512_castps256_ps512(c), a2, b2);
+    return _mm512_castps512_ps256(r);
+}
+
+SIMDPP_INL float32<16> i_dot_bf16(const bfloat16<32>& a, const bfloat16<32>& b,
+                                  const float32<16>& c)
+{
+    __m512i a2 = _mm512_inserti64x4(_mm512_castsi256_si512(a.vec(0)), a.vec(1), 1);
+    __m512i b2 = _mm512_inserti64x4(_mm512_castsi256_si512(b.vec(0)), b.vec(1), 1);
+    return _mm512_dpbf16_ps(c, (__m512bh) a2, (__m512bh) b2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_dot_bf16(const bfloat16<N*2>& a, const bfloat16<N*2>& b,
+                      const float32<N>& c)
+{
+#if SIMDPP_USE_AVX512BF16
+    float32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_dot_bf16(detail::vec_extract<float32<N>::base_length*2>(a, i),
+                              detail::vec_extract<float32<N>::base_length*2>(b, i),
+                              c.vec(i));
+    }
+    return r;
+#else
+    return i_dot_bf16_emul(a, b, c);
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
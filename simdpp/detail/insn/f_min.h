@@ -65,7 +65,7 @@ SIMDPP_INL float64x2 i_min(const float64x2& a, const float64x2& b)
 #elif SIMDPP_USE_SSE2
     return _mm_min_pd(a, b);
 #elif SIMDPP_USE_NEON64
-    return vmaxq_f64(a, b);
+    return vminq_f64(a, b);
 #endif
 }
 
@@ -0,0 +1,127 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_NEARBYINT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_NEARBYINT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/detail/null/foreach.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Adding and subtracting 2^(mantissa bits) with the sign of the value rounds
+    away the fraction in the current rounding mode. The values whose magnitude
+    is not less than that are already integers and are returned unchanged.
+*/
+template<class V> SIMDPP_INL
+V i_nearbyint_magic(const V& a, const V& magic)
+{
+    V af = abs(a);
+    V sign = bit_xor(a, af);
+    V m = bit_or(magic, sign);
+    V r = sub(add(a, m), m);
+    r = bit_or(abs(r), sign); // fix the sign of zero results
+    return blend(r, a, cmp_lt(af, magic)); // takes care of NaNs
+}
+
+SIMDPP_INL float32x4 i_nearbyint(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    return detail::null::foreach<float32x4>(a, [](float x){ return std::nearbyint(x); });
+#elif SIMDPP_USE_SSE4_1
+    return _mm_round_ps(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+#elif SIMDPP_USE_NEON64
+    return vrndiq_f32(a);
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON_FLT_SP
+    return i_nearbyint_magic(a, make_float<float32x4>(8388608.0f));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_round((__vector float)a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float32x8 i_nearbyint(const float32x8& a)
+{
+    return _mm256_round_ps(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_nearbyint(const float32<16>& a)
+{
+    return _mm512_roundscale_ps(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_nearbyint(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_nearbyint, a);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_nearbyint(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return detail::null::foreach<float64x2>(a, [](double x){ return std::nearbyint(x); });
+#elif SIMDPP_USE_SSE4_1
+    return _mm_round_pd(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+#elif SIMDPP_USE_NEON64
+    return vrndiq_f64(a);
+#elif SIMDPP_USE_SSE2
+    return i_nearbyint_magic(a, make_float<float64x2>(4503599627370496.0));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float64x4 i_nearbyint(const float64x4& a)
+{
+    return _mm256_round_pd(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_nearbyint(const float64<8>& a)
+{
+    return _mm512_roundscale_pd(a, _MM_FROUND_CUR_DIRECTION | _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_nearbyint(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_nearbyint, a);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,124 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ROUND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/f_trunc.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/detail/null/foreach.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The difference between the value and the truncated value is exact, thus
+    the result does not depend on the current rounding mode. If the magnitude
+    of the difference is at least 0.5, the truncated value is moved away from
+    zero by one.
+*/
+template<class V> SIMDPP_INL
+V i_round_from_trunc(const V& a)
+{
+    V t = trunc(a);
+    V af = abs(a);
+    V sign = bit_xor(a, af);
+    V d = abs(sub(a, t));
+    V one = bit_or(make_float<V>(1.0), sign);
+    V r = blend(add(t, one), t, cmp_ge(d, make_float<V>(0.5)));
+    return bit_or(abs(r), sign); // fix the sign of zero results
+}
+
+SIMDPP_INL float32x4 i_round(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    return detail::null::foreach<float32x4>(a, [](float x){ return std::round(x); });
+#elif SIMDPP_USE_NEON64
+    return vrndaq_f32(a);
+#else
+    return i_round_from_trunc(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float32x8 i_round(const float32x8& a)
+{
+    return i_round_from_trunc(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_round(const float32<16>& a)
+{
+    return i_round_from_trunc(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_round(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_round, a);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_round(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return detail::null::foreach<float64x2>(a, [](double x){ return std::round(x); });
+#elif SIMDPP_USE_NEON64
+    return vrndaq_f64(a);
+#else
+    return i_round_from_trunc(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float64x4 i_round(const float64x4& a)
+{
+    return i_round_from_trunc(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_round(const float64<8>& a)
+{
+    return i_round_from_trunc(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_round(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_round, a);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
+
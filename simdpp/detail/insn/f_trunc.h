@@ -15,6 +15,11 @@
 #include <cmath>
 #include <simdpp/types.h>
 #include <simdpp/core/f_ceil.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/to_float64.h>
+#include <simdpp/core/to_int64.h>
 #include <simdpp/detail/null/foreach.h>
 
 namespace simdpp {
@@ -36,14 +41,14 @@ SIMDPP_INL float32x4 i_trunc(const float32x4& a)
 #elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON_FLT_SP
     //check if the value is not too large
     float32x4 af = abs(a);
-    mask_float32x4 mask = cmp_gt(af, 8388607.0f);
+    mask_float32x4 mask = cmp_lt(af, 8388608.0f);
 
     //truncate
     int32x4 ia = to_int32(a);
     float32x4 fa = to_float32(ia);
 
     //combine the results
-    return blend(a, fa, mask);     // takes care of NaNs
+    return blend(fa, a, mask);     // takes care of NaNs
 #elif SIMDPP_USE_ALTIVEC
     return vec_trunc((__vector float)a);
 #endif
@@ -59,7 +64,7 @@ SIMDPP_INL float32x8 i_trunc(const float32x8& a)
 #if SIMDPP_USE_AVX512
 SIMDPP_INL float32<16> i_trunc(const float32<16>& a)
 {
-    return _mm512_roundscale_ps(a, 0x13); // scale by 1, truncate
+    return _mm512_roundscale_ps(a, 0x03); // keep no fraction bits, truncate
 }
 #endif
 
@@ -69,6 +74,50 @@ float32<N> i_trunc(const float32<N>& a)
     SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_trunc, a);
 }
 
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_trunc(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return detail::null::foreach<float64x2>(a, [](double x){ return std::trunc(x); });
+#elif SIMDPP_USE_SSE4_1
+    return _mm_round_pd(a, 3); // 3 = i_truncate
+#elif SIMDPP_USE_NEON64
+    return vrndq_f64(a);
+#elif SIMDPP_USE_SSE2
+    //check if the value is not too large
+    float64x2 af = abs(a);
+    mask_float64x2 mask = cmp_lt(af, 4503599627370496.0);
+
+    //truncate, fixing the sign of zero results
+    float64x2 fa = to_float64(to_int64(a));
+    fa = bit_or(abs(fa), bit_xor(a, af));
+
+    //combine the results
+    return blend(fa, a, mask);     // takes care of NaNs
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float64x4 i_trunc(const float64x4& a)
+{
+    return _mm256_round_pd(a, 3); // 3 = i_truncate
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_trunc(const float64<8>& a)
+{
+    return _mm512_roundscale_pd(a, 0x03); // keep no fraction bits, truncate
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_trunc(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_trunc, a);
+}
+
 
 } // namespace insn
 } // namespace detail
@@ -0,0 +1,211 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_FROM_BITMASK_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_FROM_BITMASK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Each bit is broadcast to all elements that it affects, then the elements
+    are compared against a vector that has a different bit set in each
+    element.
+*/
+SIMDPP_INL void i_from_bitmask(mask_int8x16& r, uint64_t bits)
+{
+    // broadcast each byte of the bitmask to 8 bytes
+    uint64_t b0 = (bits & 0xff) * 0x0101010101010101;
+    uint64_t b1 = ((bits >> 8) & 0xff) * 0x0101010101010101;
+    uint8x16 b = (uint8x16) (uint64x2) make_uint(b0, b1);
+    uint8x16 w = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    r = cmp_eq(bit_and(b, w), w);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_from_bitmask(mask_int8x32& r, uint64_t bits)
+{
+    uint64_t b0 = (bits & 0xff) * 0x0101010101010101;
+    uint64_t b1 = ((bits >> 8) & 0xff) * 0x0101010101010101;
+    uint64_t b2 = ((bits >> 16) & 0xff) * 0x0101010101010101;
+    uint64_t b3 = ((bits >> 24) & 0xff) * 0x0101010101010101;
+    uint8x32 b = (uint8x32) (uint64x4) make_uint(b0, b1, b2, b3);
+    uint8x32 w = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    r = cmp_eq(bit_and(b, w), w);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_from_bitmask(mask_int8<64>& r, uint64_t bits)
+{
+    r = __mmask64(bits);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_int8<N>& r, uint64_t bits)
+{
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        i_from_bitmask(r.vec(j), bits >> (j * r.base_length));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_from_bitmask(mask_int16x8& r, uint64_t bits)
+{
+    uint16x8 b = splat(unsigned(bits & 0xffff));
+    uint16x8 w = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    r = cmp_eq(bit_and(b, w), w);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_from_bitmask(mask_int16x16& r, uint64_t bits)
+{
+    uint16x16 b = splat(unsigned(bits & 0xffff));
+    uint16x16 w = make_uint(0x0001, 0x0002, 0x0004, 0x0008,
+                            0x0010, 0x0020, 0x0040, 0x0080,
+                            0x0100, 0x0200, 0x0400, 0x0800,
+                            0x1000, 0x2000, 0x4000, 0x8000);
+    r = cmp_eq(bit_and(b, w), w);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_from_bitmask(mask_int16<32>& r, uint64_t bits)
+{
+    r = __mmask32(bits);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_int16<N>& r, uint64_t bits)
+{
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        i_from_bitmask(r.vec(j), bits >> (j * r.base_length));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_from_bitmask(mask_int32x4& r, uint64_t bits)
+{
+    uint32x4 b = splat(unsigned(bits));
+    uint32x4 w = make_uint(0x1, 0x2, 0x4, 0x8);
+    r = cmp_eq(bit_and(b, w), w);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_from_bitmask(mask_int32x8& r, uint64_t bits)
+{
+    uint32x8 b = splat(unsigned(bits));
+    uint32x8 w = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    r = cmp_eq(bit_and(b, w), w);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_from_bitmask(mask_int32<16>& r, uint64_t bits)
+{
+    r = __mmask16(bits);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_int32<N>& r, uint64_t bits)
+{
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        i_from_bitmask(r.vec(j), bits >> (j * r.base_length));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_from_bitmask(mask_int64x2& r, uint64_t bits)
+{
+    uint64x2 b = splat(bits);
+    uint64x2 w = make_uint(0x1, 0x2);
+    r = cmp_eq(bit_and(b, w), w);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_from_bitmask(mask_int64x4& r, uint64_t bits)
+{
+    uint64x4 b = splat(bits);
+    uint64x4 w = make_uint(0x1, 0x2, 0x4, 0x8);
+    r = cmp_eq(bit_and(b, w), w);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_from_bitmask(mask_int64<8>& r, uint64_t bits)
+{
+    r = __mmask8(bits);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_int64<N>& r, uint64_t bits)
+{
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        i_from_bitmask(r.vec(j), bits >> (j * r.base_length));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_float32<N>& r, uint64_t bits)
+{
+    mask_int32<N> m;
+    i_from_bitmask(m, bits);
+    r = mask_float32<N>(m);
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_from_bitmask(mask_float32<16>& r, uint64_t bits)
+{
+    r = __mmask16(bits);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_from_bitmask(mask_float64<N>& r, uint64_t bits)
+{
+    mask_int64<N> m;
+    i_from_bitmask(m, bits);
+    r = mask_float64<N>(m);
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_from_bitmask(mask_float64<8>& r, uint64_t bits)
+{
+    r = __mmask8(bits);
+}
+#endif
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,538 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/detail/insn/split.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Loads the elements one by one. The index vector is stored to memory and
+    the result is assembled in memory, which the compiler usually turns into
+    a sequence of scalar loads and element inserts.
+*/
+template<class V, class I> SIMDPP_INL
+V i_gather_emul(const typename V::element_type* base, const I& idx)
+{
+    mem_block<I> ix(idx);
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = base[ix[i]];
+    }
+    return r;
+}
+
+/*  Same as i_gather_emul, except that only the elements for which the
+    corresponding element in @a mask is nonzero are loaded. The rest are
+    copied from @a src. The memory at the masked-out indices is not accessed.
+*/
+template<class V, class I, class M> SIMDPP_INL
+V i_gather_masked_emul(const typename V::element_type* base, const I& idx,
+                       const M& mask, const V& src)
+{
+    mem_block<I> ix(idx);
+    mem_block<M> mk(mask);
+    mem_block<V> r(src);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (mk[i] != 0) {
+            r[i] = base[ix[i]];
+        }
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32x4 i_gather(const uint32_t* base, const uint32x4& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 4);
+#else
+    return i_gather_emul<uint32x4>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_gather(const uint32_t* base, const uint32x8& idx)
+{
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx, 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_gather(const uint32_t* base, const uint32<16>& idx)
+{
+    return _mm512_i32gather_epi32(idx, base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_gather(const uint32_t* base, const uint32<N>& idx)
+{
+    uint32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather(base, idx.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float32x4 i_gather(const float* base, const uint32x4& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i32gather_ps(base, idx, 4);
+#else
+    return i_gather_emul<float32x4>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL float32x8 i_gather(const float* base, const uint32x8& idx)
+{
+    return _mm256_i32gather_ps(base, idx, 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_gather(const float* base, const uint32<16>& idx)
+{
+    return _mm512_i32gather_ps(idx, base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_gather(const float* base, const uint32<N>& idx)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // the floating-point vectors are wider than the integer vectors
+    return i_gather_emul<float32<N>>(base, idx);
+#else
+    float32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather(base, idx.vec(j));
+    }
+    return r;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64x2 i_gather(const uint64_t* base, const uint64x2& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i64gather_epi64(reinterpret_cast<const long long*>(base), idx, 8);
+#else
+    return i_gather_emul<uint64x2>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_gather(const uint64_t* base, const uint64x4& idx)
+{
+    return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(base), idx, 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_gather(const uint64_t* base, const uint64<8>& idx)
+{
+    return _mm512_i64gather_epi64(idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_gather(const uint64_t* base, const uint64<N>& idx)
+{
+    uint64<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather(base, idx.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements with 32-bit indices
+
+SIMDPP_INL uint64<4> i_gather(const uint64_t* base, const uint32x4& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_i32gather_epi64(reinterpret_cast<const long long*>(base), idx, 8);
+#else
+    return i_gather_emul<uint64<4>>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_gather(const uint64_t* base, const uint32<8>& idx)
+{
+    return _mm512_i32gather_epi64(idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_gather(const uint64_t* base, const uint32<N>& idx)
+{
+#if SIMDPP_USE_AVX2
+    // the native index vectors hold twice as many elements as the native
+    // data vectors
+    uint32<N/2> idx_lo, idx_hi;
+    i_split(idx, idx_lo, idx_hi);
+    uint64<N/2> r_lo = i_gather(base, idx_lo);
+    uint64<N/2> r_hi = i_gather(base, idx_hi);
+    return combine(r_lo, r_hi);
+#else
+    return i_gather_emul<uint64<N>>(base, idx);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_gather(const double* base, const uint64x2& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i64gather_pd(base, idx, 8);
+#else
+    return i_gather_emul<float64x2>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL float64x4 i_gather(const double* base, const uint64x4& idx)
+{
+    return _mm256_i64gather_pd(base, idx, 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_gather(const double* base, const uint64<8>& idx)
+{
+    return _mm512_i64gather_pd(idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_gather(const double* base, const uint64<N>& idx)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // the floating-point vectors are wider than the integer vectors
+    return i_gather_emul<float64<N>>(base, idx);
+#else
+    float64<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather(base, idx.vec(j));
+    }
+    return r;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements with 32-bit indices
+
+SIMDPP_INL float64<4> i_gather(const double* base, const uint32x4& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_i32gather_pd(base, idx, 8);
+#else
+    return i_gather_emul<float64<4>>(base, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_gather(const double* base, const uint32<8>& idx)
+{
+    return _mm512_i32gather_pd(idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_gather(const double* base, const uint32<N>& idx)
+{
+#if SIMDPP_USE_AVX2
+    // the native index vectors hold twice as many elements as the native
+    // data vectors
+    uint32<N/2> idx_lo, idx_hi;
+    i_split(idx, idx_lo, idx_hi);
+    float64<N/2> r_lo = i_gather(base, idx_lo);
+    float64<N/2> r_hi = i_gather(base, idx_hi);
+    return combine(r_lo, r_hi);
+#else
+    return i_gather_emul<float64<N>>(base, idx);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32x4 i_gather_masked(const uint32_t* base, const uint32x4& idx,
+                                    const mask_int32x4& mask, const uint32x4& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i32gather_epi32(src, reinterpret_cast<const int*>(base),
+                                    idx, mask, 4);
+#else
+    return i_gather_masked_emul(base, idx, mask.unmask(), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_gather_masked(const uint32_t* base, const uint32x8& idx,
+                                    const mask_int32x8& mask, const uint32x8& src)
+{
+    return _mm256_mask_i32gather_epi32(src, reinterpret_cast<const int*>(base),
+                                       idx, mask, 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_gather_masked(const uint32_t* base, const uint32<16>& idx,
+                                      const mask_int32<16>& mask, const uint32<16>& src)
+{
+    return _mm512_mask_i32gather_epi32(src, mask, idx, base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_gather_masked(const uint32_t* base, const uint32<N>& idx,
+                          const mask_int32<N>& mask, const uint32<N>& src)
+{
+    uint32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather_masked(base, idx.vec(j), mask.vec(j), src.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float32x4 i_gather_masked(const float* base, const uint32x4& idx,
+                                     const mask_float32x4& mask, const float32x4& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i32gather_ps(src, base, idx, mask, 4);
+#else
+    return i_gather_masked_emul(base, idx, bit_cast<uint32x4>(mask.unmask()), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL float32x8 i_gather_masked(const float* base, const uint32x8& idx,
+                                     const mask_float32x8& mask, const float32x8& src)
+{
+    return _mm256_mask_i32gather_ps(src, base, idx, mask, 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_gather_masked(const float* base, const uint32<16>& idx,
+                                       const mask_float32<16>& mask, const float32<16>& src)
+{
+    return _mm512_mask_i32gather_ps(src, mask, idx, base, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_gather_masked(const float* base, const uint32<N>& idx,
+                           const mask_float32<N>& mask, const float32<N>& src)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    return i_gather_masked_emul(base, idx, bit_cast<uint32<N>>(mask.unmask()), src);
+#else
+    float32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather_masked(base, idx.vec(j), mask.vec(j), src.vec(j));
+    }
+    return r;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64x2 i_gather_masked(const uint64_t* base, const uint64x2& idx,
+                                    const mask_int64x2& mask, const uint64x2& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i64gather_epi64(src, reinterpret_cast<const long long*>(base),
+                                    idx, mask, 8);
+#else
+    return i_gather_masked_emul(base, idx, mask.unmask(), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_gather_masked(const uint64_t* base, const uint64x4& idx,
+                                    const mask_int64x4& mask, const uint64x4& src)
+{
+    return _mm256_mask_i64gather_epi64(src, reinterpret_cast<const long long*>(base),
+                                       idx, mask, 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_gather_masked(const uint64_t* base, const uint64<8>& idx,
+                                     const mask_int64<8>& mask, const uint64<8>& src)
+{
+    return _mm512_mask_i64gather_epi64(src, mask, idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_gather_masked(const uint64_t* base, const uint64<N>& idx,
+                          const mask_int64<N>& mask, const uint64<N>& src)
+{
+    uint64<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather_masked(base, idx.vec(j), mask.vec(j), src.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements with 32-bit indices
+
+SIMDPP_INL uint64<4> i_gather_masked(const uint64_t* base, const uint32x4& idx,
+                                     const mask_int64<4>& mask, const uint64<4>& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_mask_i32gather_epi64(src, reinterpret_cast<const long long*>(base),
+                                       idx, mask, 8);
+#else
+    return i_gather_masked_emul(base, idx, mask.unmask(), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_gather_masked(const uint64_t* base, const uint32<8>& idx,
+                                     const mask_int64<8>& mask, const uint64<8>& src)
+{
+    return _mm512_mask_i32gather_epi64(src, mask, idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_gather_masked(const uint64_t* base, const uint32<N>& idx,
+                          const mask_int64<N>& mask, const uint64<N>& src)
+{
+#if SIMDPP_USE_AVX2
+    uint32<N/2> idx_lo, idx_hi;
+    mask_int64<N/2> mask_lo, mask_hi;
+    uint64<N/2> src_lo, src_hi;
+    i_split(idx, idx_lo, idx_hi);
+    i_split(mask, mask_lo, mask_hi);
+    i_split(src, src_lo, src_hi);
+    uint64<N/2> r_lo = i_gather_masked(base, idx_lo, mask_lo, src_lo);
+    uint64<N/2> r_hi = i_gather_masked(base, idx_hi, mask_hi, src_hi);
+    return combine(r_lo, r_hi);
+#else
+    return i_gather_masked_emul(base, idx, mask.unmask(), src);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_gather_masked(const double* base, const uint64x2& idx,
+                                     const mask_float64x2& mask, const float64x2& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i64gather_pd(src, base, idx, mask, 8);
+#else
+    return i_gather_masked_emul(base, idx, bit_cast<uint64x2>(mask.unmask()), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL float64x4 i_gather_masked(const double* base, const uint64x4& idx,
+                                     const mask_float64x4& mask, const float64x4& src)
+{
+    return _mm256_mask_i64gather_pd(src, base, idx, mask, 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_gather_masked(const double* base, const uint64<8>& idx,
+                                      const mask_float64<8>& mask, const float64<8>& src)
+{
+    return _mm512_mask_i64gather_pd(src, mask, idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_gather_masked(const double* base, const uint64<N>& idx,
+                           const mask_float64<N>& mask, const float64<N>& src)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    return i_gather_masked_emul(base, idx, bit_cast<uint64<N>>(mask.unmask()), src);
+#else
+    float64<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_gather_masked(base, idx.vec(j), mask.vec(j), src.vec(j));
+    }
+    return r;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// 64-bit elements with 32-bit indices
+
+SIMDPP_INL float64<4> i_gather_masked(const double* base, const uint32x4& idx,
+                                      const mask_float64<4>& mask, const float64<4>& src)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_mask_i32gather_pd(src, base, idx, mask, 8);
+#else
+    return i_gather_masked_emul(base, idx, bit_cast<uint64<4>>(mask.unmask()), src);
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_gather_masked(const double* base, const uint32<8>& idx,
+                                      const mask_float64<8>& mask, const float64<8>& src)
+{
+    return _mm512_mask_i32gather_pd(src, mask, idx, base, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_gather_masked(const double* base, const uint32<N>& idx,
+                           const mask_float64<N>& mask, const float64<N>& src)
+{
+#if SIMDPP_USE_AVX2
+    uint32<N/2> idx_lo, idx_hi;
+    mask_float64<N/2> mask_lo, mask_hi;
+    float64<N/2> src_lo, src_hi;
+    i_split(idx, idx_lo, idx_hi);
+    i_split(mask, mask_lo, mask_hi);
+    i_split(src, src_lo, src_hi);
+    float64<N/2> r_lo = i_gather_masked(base, idx_lo, mask_lo, src_lo);
+    float64<N/2> r_hi = i_gather_masked(base, idx_hi, mask_hi, src_hi);
+    return combine(r_lo, r_hi);
+#else
+    return i_gather_masked_emul(base, idx, bit_cast<uint64<N>>(mask.unmask()), src);
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
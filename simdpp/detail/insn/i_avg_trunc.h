@@ -50,6 +50,13 @@ SIMDPP_INL uint8x32 i_avg_trunc(const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_avg_trunc(const uint8<64>& a, const uint8<64>& b)
+{
+    return v_emul_avg_trunc(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_avg_trunc(const uint8<N>& a, const uint8<N>& b)
 {
@@ -89,6 +96,19 @@ SIMDPP_INL int8x32 i_avg_trunc(const int8x32& a, const int8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int8<64> i_avg_trunc(const int8<64>& a, const int8<64>& b)
+{
+    uint8<64> a2, b2, bias, r;
+    bias = make_uint(0x80);
+    a2 = bit_xor(a, bias); // add
+    b2 = bit_xor(b, bias); // add
+    r = i_avg_trunc(a2, b2); // unsigned
+    r = bit_xor(r, bias); // sub
+    return r;
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int8<N> i_avg_trunc(const int8<N>& a, const int8<N>& b)
 {
@@ -117,6 +137,13 @@ SIMDPP_INL uint16x16 i_avg_trunc(const uint16x16& a, const uint16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_avg_trunc(const uint16<32>& a, const uint16<32>& b)
+{
+    return v_emul_avg_trunc(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_avg_trunc(const uint16<N>& a, const uint16<N>& b)
 {
@@ -155,6 +182,18 @@ SIMDPP_INL int16x16 i_avg_trunc(const int16x16& a, const int16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_avg_trunc(const int16<32>& a, const int16<32>& b)
+{
+    uint16<32> a2, b2, r;
+    a2 = bit_xor(a, 0x8000); // add
+    b2 = bit_xor(b, 0x8000); // add
+    r = i_avg_trunc(a2, b2); // unsigned
+    r = bit_xor(r, 0x8000); // sub
+    return r;
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int16<N> i_avg_trunc(const int16<N>& a, const int16<N>& b)
 {
@@ -0,0 +1,218 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+// Returns the higher halves of the 64-bit products of the 32-bit elements
+SIMDPP_INL uint32x4 i_mul_hi_u32(const uint32x4& a, const uint32x4& b)
+{
+#if SIMDPP_USE_SSE2
+    __m128i ev, od;
+    ev = _mm_mul_epu32(a, b);
+    od = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    ev = _mm_srli_epi64(ev, 32);
+    od = _mm_and_si128(od, _mm_set_epi32(-1, 0, -1, 0));
+    return _mm_or_si128(ev, od);
+#elif SIMDPP_USE_NEON
+    uint64x2_t lo = vmull_u32(vget_low_u32(a), vget_low_u32(b));
+    uint64x2_t hi = vmull_u32(vget_high_u32(a), vget_high_u32(b));
+    return vcombine_u32(vshrn_n_u64(lo, 32), vshrn_n_u64(hi, 32));
+#else
+    mem_block<uint32x4> ma(a), mb(b);
+    for (unsigned i = 0; i < 4; ++i) {
+        ma[i] = uint32_t((uint64_t(ma[i]) * mb[i]) >> 32);
+    }
+    return ma;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_mul_hi_u32(const uint32x8& a, const uint32x8& b)
+{
+    __m256i ev, od;
+    ev = _mm256_mul_epu32(a, b);
+    od = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    od = _mm256_and_si256(od, _mm256_set1_epi64x(0xffffffff00000000));
+    return _mm256_or_si256(ev, od);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_mul_hi_u32(const uint32<16>& a, const uint32<16>& b)
+{
+    __m512i ev, od;
+    ev = _mm512_mul_epu32(a, b);
+    od = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_mov_epi32(ev, 0xaaaa, od);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_mul_hi_u32(const uint32<N>& a, const uint32<N>& b)
+{
+    uint32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_mul_hi_u32(a.vec(j), b.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int32x4 i_mul_hi_s32(const int32x4& a, const int32x4& b)
+{
+#if SIMDPP_USE_SSE4_1
+    __m128i ev, od;
+    ev = _mm_mul_epi32(a, b);
+    od = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    ev = _mm_srli_epi64(ev, 32);
+    return _mm_blend_epi16(ev, od, 0xcc);
+#elif SIMDPP_USE_SSE2
+    // compute the unsigned product and correct for the negative operands:
+    // hi_s(a*b) = hi_u(a*b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+    __m128i r, ca, cb;
+    r = i_mul_hi_u32(uint32x4(a), uint32x4(b));
+    ca = _mm_and_si128(_mm_srai_epi32(a, 31), b);
+    cb = _mm_and_si128(_mm_srai_epi32(b, 31), a);
+    r = _mm_sub_epi32(r, _mm_add_epi32(ca, cb));
+    return r;
+#elif SIMDPP_USE_NEON
+    int64x2_t lo = vmull_s32(vget_low_s32(a), vget_low_s32(b));
+    int64x2_t hi = vmull_s32(vget_high_s32(a), vget_high_s32(b));
+    return vcombine_s32(vshrn_n_s64(lo, 32), vshrn_n_s64(hi, 32));
+#else
+    mem_block<int32x4> ma(a), mb(b);
+    for (unsigned i = 0; i < 4; ++i) {
+        ma[i] = int32_t((int64_t(ma[i]) * mb[i]) >> 32);
+    }
+    return ma;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int32x8 i_mul_hi_s32(const int32x8& a, const int32x8& b)
+{
+    __m256i ev, od;
+    ev = _mm256_mul_epi32(a, b);
+    od = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int32<16> i_mul_hi_s32(const int32<16>& a, const int32<16>& b)
+{
+    __m512i ev, od;
+    ev = _mm512_mul_epi32(a, b);
+    od = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_mov_epi32(ev, 0xaaaa, od);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_mul_hi_s32(const int32<N>& a, const int32<N>& b)
+{
+    int32<N> r;
+    for (unsigned j = 0; j < r.vec_length; ++j) {
+        r.vec(j) = i_mul_hi_s32(a.vec(j), b.vec(j));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div(const uint16<N>& a, const divider<uint16_t>& d)
+{
+    if (d.magic() == 0) {
+        return shift_r(a, d.shift());
+    }
+    uint16<N> q = mul_hi(a, (uint16<N>) splat(d.magic()));
+    if (d.is_add()) {
+        uint16<N> t = sub(a, q);
+        q = add(shift_r<1>(t), q);
+    }
+    return shift_r(q, d.shift());
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div(const uint32<N>& a, const divider<uint32_t>& d)
+{
+    if (d.magic() == 0) {
+        return shift_r(a, d.shift());
+    }
+    uint32<N> q = i_mul_hi_u32(a, (uint32<N>) splat(d.magic()));
+    if (d.is_add()) {
+        uint32<N> t = sub(a, q);
+        q = add(shift_r<1>(t), q);
+    }
+    return shift_r(q, d.shift());
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_div(const int32<N>& a, const divider<int32_t>& d)
+{
+    int32<N> q;
+    if (d.magic() == 0) {
+        // round towards zero by adding 2^shift-1 to the negative numerators
+        int32<N> bias = splat((uint32_t(1) << d.shift()) - 1);
+        bias = bit_and(shift_r<31>(a), bias);
+        q = shift_r(add(a, bias), d.shift());
+    } else {
+        q = i_mul_hi_s32(a, (int32<N>) splat(d.magic()));
+        if (d.is_add()) {
+            if (d.is_negative()) {
+                q = sub(q, a);
+            } else {
+                q = add(q, a);
+            }
+        }
+        q = shift_r(q, d.shift());
+        // add one to the negative results
+        q = add(q, int32<N>(shift_r<31>(uint32<N>(q))));
+        return q;
+    }
+    if (d.is_negative()) {
+        q = sub(int32<N>::zero(), q);
+    }
+    return q;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
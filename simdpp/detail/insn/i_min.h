@@ -48,6 +48,13 @@ SIMDPP_INL int8x32 i_min(const int8x32& a, const int8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int8<64> i_min(const int8<64>& a, const int8<64>& b)
+{
+    return _mm512_min_epi8(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int8<N> i_min(const int8<N>& a, const int8<N>& b)
 {
@@ -76,6 +83,13 @@ SIMDPP_INL uint8x32 i_min(const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_min(const uint8<64>& a, const uint8<64>& b)
+{
+    return _mm512_min_epu8(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_min(const uint8<N>& a, const uint8<N>& b)
 {
@@ -104,6 +118,13 @@ SIMDPP_INL int16x16 i_min(const int16x16& a, const int16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_min(const int16<32>& a, const int16<32>& b)
+{
+    return _mm512_min_epi16(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int16<N> i_min(const int16<N>& a, const int16<N>& b)
 {
@@ -135,6 +156,13 @@ SIMDPP_INL uint16x16 i_min(const uint16x16& a, const uint16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_min(const uint16<32>& a, const uint16<32>& b)
+{
+    return _mm512_min_epu16(a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_min(const uint16<N>& a, const uint16<N>& b)
 {
@@ -217,6 +245,72 @@ uint32<N> i_min(const uint32<N>& a, const uint32<N>& b)
     SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, i_min, a, b);
 }
 
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int64x2 i_min(const int64x2& a, const int64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::min(a, b);
+#else
+    mask_int64x2 mask = cmp_lt(a, b);
+    return blend(a, b, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int64x4 i_min(const int64x4& a, const int64x4& b)
+{
+    mask_int64x4 mask = cmp_lt(a, b);
+    return blend(a, b, mask);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int64<8> i_min(const int64<8>& a, const int64<8>& b)
+{
+    return _mm512_min_epi64(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_min(const int64<N>& a, const int64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(int64<N>, i_min, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64x2 i_min(const uint64x2& a, const uint64x2& b)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::min(a, b);
+#else
+    mask_int64x2 mask = cmp_lt(a, b);
+    return blend(a, b, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_min(const uint64x4& a, const uint64x4& b)
+{
+    mask_int64x4 mask = cmp_lt(a, b);
+    return blend(a, b, mask);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_min(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_min_epu64(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_min(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_min, a, b);
+}
+
 } // namespace insn
 } // namespace detail
 #ifndef SIMDPP_DOXYGEN
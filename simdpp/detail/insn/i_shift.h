@@ -98,6 +98,15 @@ struct shift_u8_mask<7,V> { V operator()() { return make_uint(0x7f); } };
 template<class V>
 struct shift_u8_mask<8,V> { V operator()() { return make_uint(0xff); } };
 
+// Returns a mask that has all bits set in the elements in which the bit B of
+// the shift count is set
+template<unsigned B, unsigned N> SIMDPP_INL
+uint16<N> shift_v_bit_mask(const uint16<N>& count)
+{
+    int16<N> m = shift_l<15-B>(count);
+    return (uint16<N>) shift_r<15>(m);
+}
+
 } // namespace detail
 } // namespace insn
 #ifndef SIMDPP_DOXYGEN
@@ -16,7 +16,10 @@
 #include <simdpp/detail/not_implemented.h>
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/core/set_splat.h>
+#include <simdpp/core/shuffle1.h>
 #include <simdpp/detail/insn/i_shift.h>
 #include <simdpp/detail/null/math.h>
 
@@ -66,6 +69,21 @@ SIMDPP_INL uint8x32 i_shift_l(const uint8x32& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_shift_l(const uint8<64>& a, unsigned count)
+{
+    uint16<32> mask, a16;
+    mask = uint16<32>::ones();
+    mask = shift_r(mask, 16-count);
+    mask = shift_l(mask, 8);
+
+    a16 = a;
+    a16 = shift_l(a16, count);
+    a16 = bit_andnot(a16, mask);
+    return uint8<64>(a16);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_shift_l(const uint8<N>& a, unsigned count)
 {
@@ -96,6 +114,13 @@ SIMDPP_INL uint16x16 i_shift_l(const uint16x16& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_l(const uint16<32>& a, unsigned count)
+{
+    return _mm512_sll_epi16(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_shift_l(const uint16<N>& a, unsigned count)
 {
@@ -226,6 +251,23 @@ uint8<32> i_shift_l(const uint8<32>& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint8<64> i_shift_l(const uint8<64>& a)
+{
+    static_assert(count <= 8, "Shift out of bounds");
+    uint16<32> mask, a16;
+    mask = uint16<32>::ones();
+    mask = shift_r<16-count>(mask);
+    mask = shift_l<8>(mask);
+
+    a16 = a;
+    a16 = shift_l<count>(a16);
+    a16 = bit_andnot(a16, mask);
+    return uint8<64>(a16);
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 uint8<N> i_shift_l(const uint8<N>& a)
 {
@@ -260,6 +302,15 @@ uint16x16 i_shift_l(const uint16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint16<32> i_shift_l(const uint16<32>& a)
+{
+    static_assert(count <= 16, "Shift out of bounds");
+    return _mm512_slli_epi16(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 uint16<N> i_shift_l(const uint16<N>& a)
 {
@@ -351,6 +402,176 @@ uint64<N> i_shift_l(const uint64<N>& a)
     static_assert(count <= 64, "Shift out of bounds");
     SIMDPP_VEC_ARRAY_IMPL1(uint64<N>, i_shift_l<count>, a);
 }
+
+// -----------------------------------------------------------------------------
+// Shifts by a different count for each element. The counts must be less than
+// the width of the element.
+
+SIMDPP_INL uint32x4 i_shift_l(const uint32x4& a, const uint32x4& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_l_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_sllv_epi32(a, count);
+#elif SIMDPP_USE_SSE2
+    // 2^count is computed by adding count to the exponent of 1.0f. The
+    // conversion of 2^31 overflows to 0x80000000 which is the expected value
+    uint32x4 p, one;
+    one = splat(0x3f800000);
+    p = _mm_add_epi32(_mm_slli_epi32(count, 23), one);
+    p = _mm_cvttps_epi32(_mm_castsi128_ps(p));
+#if SIMDPP_USE_SSE4_1
+    return _mm_mullo_epi32(a, p);
+#else
+    __m128i r0, r1;
+    r0 = _mm_mul_epu32(a, p);
+    r1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(p, 32));
+    r0 = _mm_shuffle_epi32(r0, _MM_SHUFFLE(2,0,2,0));
+    r1 = _mm_shuffle_epi32(r1, _MM_SHUFFLE(2,0,2,0));
+    return _mm_unpacklo_epi32(r0, r1);
+#endif
+#elif SIMDPP_USE_NEON
+    int32x4 shift = count;
+    return vshlq_u32(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sl((__vector uint32_t)a, (__vector uint32_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_shift_l(const uint32x8& a, const uint32x8& count)
+{
+    return _mm256_sllv_epi32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_shift_l(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_sllv_epi32(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_shift_l(const uint32<N>& a, const uint32<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, i_shift_l, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+/*  The 16-bit elements are shifted as halves of 32-bit elements. The high
+    half is cleared from the low bits beforehand and the bits shifted out of
+    the low half are cleared afterwards.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> v_shift_l_v16_avx2(const uint16<N>& a, const uint16<N>& count)
+{
+    uint32<N/2> a32, c32, mask, lo, hi;
+    a32 = a;
+    c32 = count;
+    mask = splat(0x0000ffff);
+
+    lo = i_shift_l(a32, uint32<N/2>(bit_and(c32, mask)));
+    lo = bit_and(lo, mask);
+    hi = i_shift_l(uint32<N/2>(bit_andnot(a32, mask)),
+                   uint32<N/2>(shift_r<16>(c32)));
+    return (uint16<N>) bit_or(lo, hi);
+}
+#endif
+
+/*  The shifts by 1, 2, 4 and 8 bits are applied to the elements in which the
+    corresponding bit of the count is set.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> v_shift_l_v16_emul(const uint16<N>& a, const uint16<N>& count)
+{
+    uint16<N> r = a;
+    r = blend(shift_l<1>(r), r, shift_v_bit_mask<0>(count));
+    r = blend(shift_l<2>(r), r, shift_v_bit_mask<1>(count));
+    r = blend(shift_l<4>(r), r, shift_v_bit_mask<2>(count));
+    r = blend(shift_l<8>(r), r, shift_v_bit_mask<3>(count));
+    return r;
+}
+
+SIMDPP_INL uint16x8 i_shift_l(const uint16x8& a, const uint16x8& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_l_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_l_v16_avx2(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_shift_l_v16_emul(a, count);
+#elif SIMDPP_USE_NEON
+    int16x8 shift = count;
+    return vshlq_u16(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sl((__vector uint16_t)a, (__vector uint16_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint16x16 i_shift_l(const uint16x16& a, const uint16x16& count)
+{
+    return v_shift_l_v16_avx2(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_l(const uint16<32>& a, const uint16<32>& count)
+{
+    return _mm512_sllv_epi16(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_shift_l(const uint16<N>& a, const uint16<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint16<N>, i_shift_l, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64x2 i_shift_l(const uint64x2& a, const uint64x2& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_l_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_sllv_epi64(a, count);
+#elif SIMDPP_USE_SSE2
+    // _mm_sll_epi64 takes the count from the low element only
+    uint64x2 r0, r1;
+    r0 = _mm_sll_epi64(a, count);
+    r1 = _mm_sll_epi64(a, _mm_unpackhi_epi64(count, count));
+    return shuffle1<0,1>(r0, r1);
+#elif SIMDPP_USE_NEON
+    int64x2 shift = count;
+    return vshlq_u64(a, shift);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_shift_l(const uint64x4& a, const uint64x4& count)
+{
+    return _mm256_sllv_epi64(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_shift_l(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_sllv_epi64(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_shift_l(const uint64<N>& a, const uint64<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_shift_l, a, count);
+}
 /// @}
 
 } // namespace insn
@@ -17,9 +17,11 @@
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
 #include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
 #include <simdpp/core/splat.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/permute4.h>
+#include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/detail/insn/i_shift.h>
 #include <simdpp/detail/null/math.h>
@@ -72,6 +74,22 @@ SIMDPP_INL int8x32 i_shift_r(const int8x32& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int8<64> i_shift_r(const int8<64>& a, unsigned count)
+{
+    uint16<32> hi, lo;
+    lo = hi = a;
+
+    lo = shift_l<8>(lo);
+    lo = shift_r(int16<32>(lo), count);
+    lo = shift_r<8>(lo);
+
+    hi = shift_r(int16<32>(hi), 8+count);
+    hi = shift_l<8>(hi);
+    return (int8<64>) bit_or(lo, hi);    //higher part of lo is already clear
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int8<N> i_shift_r(const int8<N>& a, unsigned count)
 {
@@ -118,6 +136,21 @@ SIMDPP_INL uint8x32 i_shift_r(const uint8x32& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_shift_r(const uint8<64>& a, unsigned count)
+{
+    uint16<32> mask, a16;
+    mask = uint16<32>::ones();
+    mask = shift_l(mask, 16-count);
+    mask = shift_r<8>(mask);
+
+    a16 = a;
+    a16 = shift_r(a16, count);
+    a16 = bit_andnot(a16, mask);
+    return uint8<64>(a16);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_shift_r(const uint8<N>& a, unsigned count)
 {
@@ -148,6 +181,13 @@ SIMDPP_INL int16x16 i_shift_r(const int16x16& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_shift_r(const int16<32>& a, unsigned count)
+{
+    return _mm512_sra_epi16(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int16<N> i_shift_r(const int16<N>& a, unsigned count)
 {
@@ -178,6 +218,13 @@ SIMDPP_INL uint16x16 i_shift_r(const uint16x16& a, unsigned count)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_r(const uint16<32>& a, unsigned count)
+{
+    return _mm512_srl_epi16(a, _mm_cvtsi32_si128(count));
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_shift_r(const uint16<N>& a, unsigned count)
 {
@@ -420,6 +467,24 @@ int8x32 i_shift_r(const int8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+int8<64> i_shift_r(const int8<64>& a)
+{
+    static_assert(count <= 8, "Shift out of bounds");
+    uint16<32> hi, lo;
+    lo = hi = a;
+
+    lo = shift_l<8>(lo);
+    lo = shift_r<count>(int16<32>(lo));
+    lo = shift_r<8>(lo);
+
+    hi = shift_r<8+count>(int16<32>(hi));
+    hi = shift_l<8>(hi);
+    return (int8<64>) bit_or(lo, hi);    //higher part of lo is already clear
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 int8<N> i_shift_r(const int8<N>& a)
 {
@@ -465,6 +530,23 @@ uint8x32 i_shift_r(const uint8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint8<64> i_shift_r(const uint8<64>& a)
+{
+    static_assert(count <= 8, "Shift out of bounds");
+    uint16<32> mask, a16;
+    mask = uint16<32>::ones();
+    mask = shift_l<16-count>(mask);
+    mask = shift_r<8>(mask);
+
+    a16 = a;
+    a16 = shift_r<count>(a16);
+    a16 = bit_andnot(a16, mask);
+    return uint8<64>(a16);
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 uint8<N> i_shift_r(const uint8<N>& a)
 {
@@ -499,6 +581,15 @@ int16x16 i_shift_r(const int16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+int16<32> i_shift_r(const int16<32>& a)
+{
+    static_assert(count <= 16, "Shift out of bounds");
+    return _mm512_srai_epi16(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 int16<N> i_shift_r(const int16<N>& a)
 {
@@ -533,6 +624,15 @@ uint16x16 i_shift_r(const uint16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned count> SIMDPP_INL
+uint16<32> i_shift_r(const uint16<32>& a)
+{
+    static_assert(count <= 16, "Shift out of bounds");
+    return _mm512_srli_epi16(a, count);
+}
+#endif
+
 template<unsigned count, unsigned N> SIMDPP_INL
 uint16<N> i_shift_r(const uint16<N>& a)
 {
@@ -722,6 +822,342 @@ uint8<N> shift_r_u8(const uint8<N>& a)
 #endif
 }
 
+// -----------------------------------------------------------------------------
+// Shifts by a different count for each element. The counts must be less than
+// the width of the element.
+
+#if SIMDPP_USE_SSE2
+/*  _mm_sra_epi32 and _mm_srl_epi32 take the count from the low 64 bits, thus
+    each element is shifted separately and the results are combined.
+*/
+template<bool Signed> SIMDPP_INL
+__m128i v_shift_r_v32_sse2(const __m128i& a, const __m128i& count)
+{
+    __m128i c01, c23, c1, c3, r0, r1, r2, r3;
+    c01 = _mm_unpacklo_epi32(count, _mm_setzero_si128());
+    c23 = _mm_unpackhi_epi32(count, _mm_setzero_si128());
+    c1 = _mm_unpackhi_epi64(c01, c01);
+    c3 = _mm_unpackhi_epi64(c23, c23);
+    if (Signed) {
+        r0 = _mm_sra_epi32(a, c01);
+        r1 = _mm_sra_epi32(a, c1);
+        r2 = _mm_sra_epi32(a, c23);
+        r3 = _mm_sra_epi32(a, c3);
+    } else {
+        r0 = _mm_srl_epi32(a, c01);
+        r1 = _mm_srl_epi32(a, c1);
+        r2 = _mm_srl_epi32(a, c23);
+        r3 = _mm_srl_epi32(a, c3);
+    }
+    // select r0[0], r1[1], r2[2] and r3[3]
+    __m128 r01, r23;
+    r01 = _mm_shuffle_ps(_mm_castsi128_ps(r0), _mm_castsi128_ps(r1),
+                         _MM_SHUFFLE(1,1,0,0));
+    r23 = _mm_shuffle_ps(_mm_castsi128_ps(r2), _mm_castsi128_ps(r3),
+                         _MM_SHUFFLE(3,3,2,2));
+    return _mm_castps_si128(_mm_shuffle_ps(r01, r23, _MM_SHUFFLE(2,0,2,0)));
+}
+#endif
+
+SIMDPP_INL int32x4 i_shift_r(const int32x4& a, const uint32x4& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_srav_epi32(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_shift_r_v32_sse2<true>(a, count);
+#elif SIMDPP_USE_NEON
+    int32x4 shift = count;
+    shift = vnegq_s32(shift);
+    return vshlq_s32(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sra((__vector int32_t)a, (__vector uint32_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int32x8 i_shift_r(const int32x8& a, const uint32x8& count)
+{
+    return _mm256_srav_epi32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int32<16> i_shift_r(const int32<16>& a, const uint32<16>& count)
+{
+    return _mm512_srav_epi32(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_shift_r(const int32<N>& a, const uint32<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(int32<N>, i_shift_r, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32x4 i_shift_r(const uint32x4& a, const uint32x4& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_srlv_epi32(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_shift_r_v32_sse2<false>(a, count);
+#elif SIMDPP_USE_NEON
+    int32x4 shift = count;
+    shift = vnegq_s32(shift);
+    return vshlq_u32(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sr((__vector uint32_t)a, (__vector uint32_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_shift_r(const uint32x8& a, const uint32x8& count)
+{
+    return _mm256_srlv_epi32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_shift_r(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_srlv_epi32(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_shift_r(const uint32<N>& a, const uint32<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, i_shift_r, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+/*  The 16-bit elements are shifted as halves of 32-bit elements. The low half
+    is moved to the high half beforehand so that the sign bit is shifted in.
+*/
+template<unsigned N> SIMDPP_INL
+int16<N> v_shift_r_v16_avx2(const int16<N>& a, const uint16<N>& count)
+{
+    int32<N/2> a32, lo, hi;
+    uint32<N/2> c32, mask;
+    a32 = a;
+    c32 = count;
+    mask = splat(0x0000ffff);
+
+    lo = shift_l<16>(a32);
+    lo = i_shift_r(lo, uint32<N/2>(bit_and(c32, mask)));
+    lo = shift_r<16>(uint32<N/2>(lo));
+    hi = i_shift_r(a32, uint32<N/2>(shift_r<16>(c32)));
+    hi = bit_andnot(hi, mask);
+    return (int16<N>) bit_or(lo, hi);
+}
+
+// The bits shifted out of the high half are cleared afterwards
+template<unsigned N> SIMDPP_INL
+uint16<N> v_shift_r_v16_avx2(const uint16<N>& a, const uint16<N>& count)
+{
+    uint32<N/2> a32, c32, mask, lo, hi;
+    a32 = a;
+    c32 = count;
+    mask = splat(0x0000ffff);
+
+    lo = i_shift_r(uint32<N/2>(bit_and(a32, mask)),
+                   uint32<N/2>(bit_and(c32, mask)));
+    hi = i_shift_r(a32, uint32<N/2>(shift_r<16>(c32)));
+    hi = bit_andnot(hi, mask);
+    return (uint16<N>) bit_or(lo, hi);
+}
+#endif
+
+/*  The shifts by 1, 2, 4 and 8 bits are applied to the elements in which the
+    corresponding bit of the count is set.
+*/
+template<class V, unsigned N> SIMDPP_INL
+V v_shift_r_v16_emul(const V& a, const uint16<N>& count)
+{
+    V r = a;
+    r = blend(shift_r<1>(r), r, V(shift_v_bit_mask<0>(count)));
+    r = blend(shift_r<2>(r), r, V(shift_v_bit_mask<1>(count)));
+    r = blend(shift_r<4>(r), r, V(shift_v_bit_mask<2>(count)));
+    r = blend(shift_r<8>(r), r, V(shift_v_bit_mask<3>(count)));
+    return r;
+}
+
+SIMDPP_INL int16x8 i_shift_r(const int16x8& a, const uint16x8& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_r_v16_avx2(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_shift_r_v16_emul(a, count);
+#elif SIMDPP_USE_NEON
+    int16x8 shift = count;
+    shift = vnegq_s16(shift);
+    return vshlq_s16(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sra((__vector int16_t)a, (__vector uint16_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int16x16 i_shift_r(const int16x16& a, const uint16x16& count)
+{
+    return v_shift_r_v16_avx2(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_shift_r(const int16<32>& a, const uint16<32>& count)
+{
+    return _mm512_srav_epi16(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_shift_r(const int16<N>& a, const uint16<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(int16<N>, i_shift_r, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint16x8 i_shift_r(const uint16x8& a, const uint16x8& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_r_v16_avx2(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_shift_r_v16_emul(a, count);
+#elif SIMDPP_USE_NEON
+    int16x8 shift = count;
+    shift = vnegq_s16(shift);
+    return vshlq_u16(a, shift);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sr((__vector uint16_t)a, (__vector uint16_t)count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint16x16 i_shift_r(const uint16x16& a, const uint16x16& count)
+{
+    return v_shift_r_v16_avx2(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_r(const uint16<32>& a, const uint16<32>& count)
+{
+    return _mm512_srlv_epi16(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_shift_r(const uint16<N>& a, const uint16<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint16<N>, i_shift_r, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64x2 i_shift_r(const uint64x2& a, const uint64x2& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_srlv_epi64(a, count);
+#elif SIMDPP_USE_SSE2
+    // _mm_srl_epi64 takes the count from the low element only
+    uint64x2 r0, r1;
+    r0 = _mm_srl_epi64(a, count);
+    r1 = _mm_srl_epi64(a, _mm_unpackhi_epi64(count, count));
+    return shuffle1<0,1>(r0, r1);
+#elif SIMDPP_USE_NEON
+    int64x2 shift = count;
+    shift = vsubq_s64(vdupq_n_s64(0), shift);
+    return vshlq_u64(a, shift);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_shift_r(const uint64x4& a, const uint64x4& count)
+{
+    return _mm256_srlv_epi64(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64<8> i_shift_r(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_srlv_epi64(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_shift_r(const uint64<N>& a, const uint64<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, i_shift_r, a, count);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  There's no arithmetic variable 64-bit shift before AVX-512. The negative
+    elements are inverted, shifted logically and inverted back.
+*/
+SIMDPP_INL int64x2 i_shift_r(const int64x2& a, const uint64x2& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_SSE2
+#if SIMDPP_USE_AVX2
+    __m128i sgn = _mm_cmpgt_epi64(_mm_setzero_si128(), a);
+#else
+    __m128i sgn = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3,3,1,1));
+#endif
+    uint64x2 r = _mm_xor_si128(a, sgn);
+    r = i_shift_r(r, count);
+    return _mm_xor_si128(r, sgn);
+#elif SIMDPP_USE_NEON
+    int64x2 shift = count;
+    shift = vsubq_s64(vdupq_n_s64(0), shift);
+    return vshlq_s64(a, shift);
+#else
+    return SIMDPP_NOT_IMPLEMENTED2(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int64x4 i_shift_r(const int64x4& a, const uint64x4& count)
+{
+    __m256i sgn = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    __m256i r = _mm256_xor_si256(a, sgn);
+    r = _mm256_srlv_epi64(r, count);
+    return _mm256_xor_si256(r, sgn);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int64<8> i_shift_r(const int64<8>& a, const uint64<8>& count)
+{
+    return _mm512_srav_epi64(a, count);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_shift_r(const int64<N>& a, const uint64<N>& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(int64<N>, i_shift_r, a, count);
+}
+
 
 } // namespace insn
 } // namespace detail
@@ -53,6 +53,8 @@ SIMDPP_INL void i_load(uint8x16& a, const char* p)
 SIMDPP_INL void i_load(uint16x8& a, const char* p) { uint8x16 r; i_load(r, p); a = r;  }
 SIMDPP_INL void i_load(uint32x4& a, const char* p) { uint8x16 r; i_load(r, p); a = r;  }
 SIMDPP_INL void i_load(uint64x2& a, const char* p) { uint8x16 r; i_load(r, p); a = r;  }
+SIMDPP_INL void i_load(float16x8& a, const char* p) { uint8x16 r; i_load(r, p); a = r;  }
+SIMDPP_INL void i_load(bfloat16x8& a, const char* p) { uint8x16 r; i_load(r, p); a = r;  }
 
 SIMDPP_INL void i_load(float32x4& a, const char* p)
 {
@@ -100,6 +102,17 @@ SIMDPP_INL void i_load(uint64x4& a,  const char* p)
     a = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
 }
 #endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load(uint8<64>& a,  const char* p)
+{
+    a = _mm512_load_si512(p);
+}
+SIMDPP_INL void i_load(uint16<32>& a, const char* p)
+{
+    a = _mm512_load_si512(p);
+}
+#endif
 #if SIMDPP_USE_AVX
 SIMDPP_INL void i_load(float32x8& a, const char* p)
 {
@@ -112,6 +125,14 @@ SIMDPP_INL void i_load(float64x4& a, const char* p)
 #endif
 
 #if SIMDPP_USE_AVX512
+SIMDPP_INL void i_load(float16<16>& a, const char* p)
+{
+    a = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+}
+SIMDPP_INL void i_load(bfloat16<16>& a, const char* p)
+{
+    a = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+}
 SIMDPP_INL void i_load(uint32<16>& a,  const char* p)
 {
     a = _mm512_load_epi32(p);
@@ -139,6 +160,10 @@ void i_load(uint32<N>& a, const char* p) { v_load(a, p); }
 template<unsigned N> SIMDPP_INL
 void i_load(uint64<N>& a, const char* p) { v_load(a, p); }
 template<unsigned N> SIMDPP_INL
+void i_load(float16<N>& a, const char* p){ v_load(a, p); }
+template<unsigned N> SIMDPP_INL
+void i_load(bfloat16<N>& a, const char* p){ v_load(a, p); }
+template<unsigned N> SIMDPP_INL
 void i_load(float32<N>& a, const char* p){ v_load(a, p); }
 template<unsigned N> SIMDPP_INL
 void i_load(float64<N>& a, const char* p){ v_load(a, p); }
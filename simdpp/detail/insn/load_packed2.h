@@ -59,6 +59,13 @@ SIMDPP_INL void i_load_packed2(uint8x32& a, uint8x32& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed2(uint8<64>& a, uint8<64>& b, const char* p)
+{
+    v512_load_packed2(a, b, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed2(uint8<N>& a, uint8<N>& b, const char* p)
 {
@@ -88,6 +95,13 @@ SIMDPP_INL void i_load_packed2(uint16x16& a, uint16x16& b, const char* p)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed2(uint16<32>& a, uint16<32>& b, const char* p)
+{
+    v512_load_packed2(a, b, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed2(uint16<N>& a, uint16<N>& b, const char* p)
 {
@@ -61,6 +61,13 @@ SIMDPP_INL void i_load_packed3(uint8x32& a, uint8x32& b, uint8x32& c, const char
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed3(uint8<64>& a, uint8<64>& b, uint8<64>& c, const char* p)
+{
+    v512_load_packed3(a, b, c, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed3(uint8<N>& a, uint8<N>& b, uint8<N>& c, const char* p)
 {
@@ -93,6 +100,14 @@ SIMDPP_INL void i_load_packed3(uint16x16& a, uint16x16& b, uint16x16& c,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed3(uint16<32>& a, uint16<32>& b, uint16<32>& c,
+                               const char* p)
+{
+    v512_load_packed3(a, b, c, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed3(uint16<N>& a, uint16<N>& b, uint16<N>& c, const char* p)
 {
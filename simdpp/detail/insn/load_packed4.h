@@ -63,6 +63,14 @@ SIMDPP_INL void i_load_packed4(uint8x32& a, uint8x32& b, uint8x32& c, uint8x32&
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed4(uint8<64>& a, uint8<64>& b, uint8<64>& c, uint8<64>& d,
+                               const char* p)
+{
+    v512_load_packed4(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed4(uint8<N>& a, uint8<N>& b, uint8<N>& c, uint8<N>& d,
                     const char* p)
@@ -97,6 +105,14 @@ SIMDPP_INL void i_load_packed4(uint16x16& a, uint16x16& b, uint16x16& c, uint16x
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_packed4(uint16<32>& a, uint16<32>& b, uint16<32>& c, uint16<32>& d,
+                               const char* p)
+{
+    v512_load_packed4(a, b, c, d, p);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_load_packed4(uint16<N>& a, uint16<N>& b, uint16<N>& c, uint16<N>& d,
                     const char* p)
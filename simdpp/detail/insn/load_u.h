@@ -102,6 +102,20 @@ SIMDPP_INL uint64x2 i_load_u(uint64x2& a, const void* p)
 #endif
 }
 
+SIMDPP_INL float16x8 i_load_u(float16x8& a, const void* p)
+{
+    uint16x8 b = i_load_u(b, p);
+    a = b;
+    return a;
+}
+
+SIMDPP_INL bfloat16x8 i_load_u(bfloat16x8& a, const void* p)
+{
+    uint16x8 b = i_load_u(b, p);
+    a = b;
+    return a;
+}
+
 SIMDPP_INL float32x4 i_load_u(float32x4& a, const void* p)
 {
     const float* q = reinterpret_cast<const float*>(p);
@@ -156,6 +170,17 @@ SIMDPP_INL uint64x4  i_load_u(uint64x4& a,  const void* p)
     a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); return a;
 }
 #endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_load_u(uint8<64>& a, const void* p)
+{
+    a = _mm512_loadu_si512(p); return a;
+}
+SIMDPP_INL uint16<32> i_load_u(uint16<32>& a, const void* p)
+{
+    a = _mm512_loadu_si512(p); return a;
+}
+#endif
 #if SIMDPP_USE_AVX
 SIMDPP_INL float32x8 i_load_u(float32x8& a, const void* p)
 {
@@ -167,6 +192,14 @@ SIMDPP_INL float64x4 i_load_u(float64x4& a, const void* p)
 }
 #endif
 #if SIMDPP_USE_AVX512
+SIMDPP_INL float16<16> i_load_u(float16<16>& a, const void* p)
+{
+    a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); return a;
+}
+SIMDPP_INL bfloat16<16> i_load_u(bfloat16<16>& a, const void* p)
+{
+    a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); return a;
+}
 SIMDPP_INL uint32<16> i_load_u(uint32<16>& a, const void* p)
 {
     a = _mm512_loadu_si512(p); return a;
@@ -206,6 +239,16 @@ uint64<N> i_load_u(uint64<N>& a, const void* p)
     v_load_u(a, reinterpret_cast<const char*>(p)); return a;
 }
 template<unsigned N> SIMDPP_INL
+float16<N> i_load_u(float16<N>& a, const void* p)
+{
+    v_load_u(a, reinterpret_cast<const char*>(p)); return a;
+}
+template<unsigned N> SIMDPP_INL
+bfloat16<N> i_load_u(bfloat16<N>& a, const void* p)
+{
+    v_load_u(a, reinterpret_cast<const char*>(p)); return a;
+}
+template<unsigned N> SIMDPP_INL
 float32<N> i_load_u(float32<N>& a, const void* p)
 {
     v_load_u(a, reinterpret_cast<const char*>(p)); return a;
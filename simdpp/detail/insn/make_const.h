@@ -244,6 +244,29 @@ void i_make_const(uint8<32>& v, const expr_vec_make_const<VE,N>& e)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class VE, unsigned N> SIMDPP_INL
+void i_make_const(uint8<64>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_epi8(e.val(63), e.val(62), e.val(61), e.val(60),
+                        e.val(59), e.val(58), e.val(57), e.val(56),
+                        e.val(55), e.val(54), e.val(53), e.val(52),
+                        e.val(51), e.val(50), e.val(49), e.val(48),
+                        e.val(47), e.val(46), e.val(45), e.val(44),
+                        e.val(43), e.val(42), e.val(41), e.val(40),
+                        e.val(39), e.val(38), e.val(37), e.val(36),
+                        e.val(35), e.val(34), e.val(33), e.val(32),
+                        e.val(31), e.val(30), e.val(29), e.val(28),
+                        e.val(27), e.val(26), e.val(25), e.val(24),
+                        e.val(23), e.val(22), e.val(21), e.val(20),
+                        e.val(19), e.val(18), e.val(17), e.val(16),
+                        e.val(15), e.val(14), e.val(13), e.val(12),
+                        e.val(11), e.val(10), e.val(9),  e.val(8),
+                        e.val(7),  e.val(6),  e.val(5),  e.val(4),
+                        e.val(3),  e.val(2),  e.val(1),  e.val(0));
+}
+#endif
+
 template<unsigned N, class VE, unsigned NE> SIMDPP_INL
 void i_make_const(uint8<N>& v, const expr_vec_make_const<VE,NE>& e)
 {
@@ -321,6 +344,21 @@ void i_make_const(uint16<16>& v, const expr_vec_make_const<VE,N>& e)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<class VE, unsigned N> SIMDPP_INL
+void i_make_const(uint16<32>& v, const expr_vec_make_const<VE,N>& e)
+{
+    v = _mm512_set_epi16(e.val(31), e.val(30), e.val(29), e.val(28),
+                         e.val(27), e.val(26), e.val(25), e.val(24),
+                         e.val(23), e.val(22), e.val(21), e.val(20),
+                         e.val(19), e.val(18), e.val(17), e.val(16),
+                         e.val(15), e.val(14), e.val(13), e.val(12),
+                         e.val(11), e.val(10), e.val(9),  e.val(8),
+                         e.val(7),  e.val(6),  e.val(5),  e.val(4),
+                         e.val(3),  e.val(2),  e.val(1),  e.val(0));
+}
+#endif
+
 
 template<unsigned N, class VE, unsigned NE> SIMDPP_INL
 void i_make_const(uint16<N>& v, const expr_vec_make_const<VE,NE>& e)
@@ -68,6 +68,18 @@ uint16x16 i_permute4(const uint16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
+uint16<32> i_permute4(const uint16<32>& a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    uint16<32> b = a;
+    b = sse::permute_lo<s0,s1,s2,s3>(b);
+    b = sse::permute_hi<s0,s1,s2,s3>(b);
+    return b;
+}
+#endif
+
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3, unsigned N> SIMDPP_INL
 uint16<N> i_permute4(const uint16<N>& a)
 {
@@ -0,0 +1,415 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_ADD_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_ADD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/move_l.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/to_int16.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The reductions of the vectors consisting of multiple native vectors first
+    combine the native vectors using vertical operations and only then reduce
+    the single remaining native vector. The wide native vectors are reduced by
+    splitting them in halves. The integer sums are computed modulo 2^n where n
+    is the width of the result type.
+*/
+
+// Sums all elements of a vector using the scalar element accessors
+template<class R, class V> SIMDPP_INL
+R i_reduce_add_el(const V& a)
+{
+    R r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        for (unsigned i = 0; i < a.vec(j).length; ++i) {
+            r += a.vec(j).el(i);
+        }
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint64_t i_reduce_add(const uint64x2& a)
+{
+#if SIMDPP_USE_NULL
+    return a.el(0) + a.el(1);
+#elif SIMDPP_USE_NEON64
+    return vaddvq_u64(a);
+#elif SIMDPP_USE_NEON
+    uint64x1_t r = vadd_u64(vget_low_u64(a), vget_high_u64(a));
+    return vget_lane_u64(r, 0);
+#else
+    return extract<0>(a) + extract<1>(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64_t i_reduce_add(const uint64x4& a)
+{
+    uint64x2 r1, r2;
+    split(a, r1, r2);
+    uint64x2 r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64_t i_reduce_add(const uint64<8>& a)
+{
+    uint64<4> r1, r2;
+    split(a, r1, r2);
+    uint64<4> r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_reduce_add(const uint64<N>& a)
+{
+    typename uint64<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, a.vec(j));
+    }
+    return i_reduce_add(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32_t i_reduce_add(const uint32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_add_el<uint32_t>(a);
+#elif SIMDPP_USE_NEON64
+    return vaddvq_u32(a);
+#elif SIMDPP_USE_NEON
+    uint32x2_t r = vadd_u32(vget_low_u32(a), vget_high_u32(a));
+    r = vpadd_u32(r, r);
+    return vget_lane_u32(r, 0);
+#else
+    uint32x4 r = add(a, move4_l<2>(a));
+    r = add(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32_t i_reduce_add(const uint32x8& a)
+{
+    uint32x4 r1, r2;
+    split(a, r1, r2);
+    uint32x4 r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32_t i_reduce_add(const uint32<16>& a)
+{
+    uint32<8> r1, r2;
+    split(a, r1, r2);
+    uint32<8> r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_add(const uint32<N>& a)
+{
+    typename uint32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, a.vec(j));
+    }
+    return i_reduce_add(r);
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_SSE2
+// Sums pairs of adjacent 16-bit elements into 32-bit elements
+SIMDPP_INL uint32x4 i_reduce_add_pairs(const int16x8& a)
+{
+    int16x8 ones = make_int(1);
+    return _mm_madd_epi16(a, ones);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32x8 i_reduce_add_pairs(const int16x16& a)
+{
+    int16x16 ones = make_int(1);
+    return _mm256_madd_epi16(a, ones);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint32<16> i_reduce_add_pairs(const int16<32>& a)
+{
+    int16<32> ones = make_int(1);
+    return _mm512_madd_epi16(a, ones);
+}
+#endif
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32_t i_reduce_add(const int16<N>& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_add_el<int32_t>(a);
+#elif SIMDPP_USE_NEON64
+    int32_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r += vaddlvq_s16(a.vec(j));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    auto r = i_reduce_add_pairs(a.vec(0));
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, i_reduce_add_pairs(a.vec(j)));
+    }
+    return i_reduce_add(r);
+#else
+    int32x4 r = int32x4::zero();
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        int32<8> w = to_int32(a.vec(j));
+        r = add(r, add(w.vec(0), w.vec(1)));
+    }
+    return i_reduce_add(uint32x4(r));
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_add(const uint16<N>& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_add_el<uint32_t>(a);
+#elif SIMDPP_USE_NEON64
+    uint32_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r += vaddlvq_u16(a.vec(j));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    // pmaddwd works on signed values only, thus the elements are biased by
+    // 0x8000 and the bias is subtracted from the result
+    uint16<N> bias = make_uint(0x8000);
+    int16<N> sa = bit_xor(a, bias);
+    return uint32_t(i_reduce_add(sa)) + 0x8000u * N;
+#else
+    uint32x4 r = uint32x4::zero();
+    uint16x8 zero = uint16x8::zero();
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        uint32x4 lo, hi;
+#if SIMDPP_USE_ALTIVEC
+        lo = zip8_lo(zero, a.vec(j));
+        hi = zip8_hi(zero, a.vec(j));
+#else
+        lo = zip8_lo(a.vec(j), zero);
+        hi = zip8_hi(a.vec(j), zero);
+#endif
+        r = add(r, add(lo, hi));
+    }
+    return i_reduce_add(r);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_SSE2
+// psadbw sums the unsigned bytes within each 64-bit element
+SIMDPP_INL uint64x2 i_reduce_add_sad(const uint8x16& a)
+{
+    return _mm_sad_epu8(a, _mm_setzero_si128());
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64x4 i_reduce_add_sad(const uint8x32& a)
+{
+    return _mm256_sad_epu8(a, _mm256_setzero_si256());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint64<8> i_reduce_add_sad(const uint8<64>& a)
+{
+    return _mm512_sad_epu8(a, _mm512_setzero_si512());
+}
+#endif
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16_t i_reduce_add(const uint8<N>& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_add_el<uint16_t>(a);
+#elif SIMDPP_USE_NEON64
+    uint16_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r += vaddlvq_u8(a.vec(j));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    auto r = i_reduce_add_sad(a.vec(0));
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, i_reduce_add_sad(a.vec(j)));
+    }
+    return uint16_t(i_reduce_add(r));
+#else
+    uint16x8 r = uint16x8::zero();
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        uint16<16> w = to_int16(a.vec(j));
+        r = add(r, add(w.vec(0), w.vec(1)));
+    }
+    return uint16_t(i_reduce_add(r));
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+int16_t i_reduce_add(const int8<N>& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_add_el<int16_t>(a);
+#elif SIMDPP_USE_NEON64
+    int16_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r += vaddlvq_s8(a.vec(j));
+    }
+    return r;
+#else
+    // the elements are biased by 0x80 so that the unsigned sum can be used
+    uint8<N> bias = make_uint(0x80);
+    uint8<N> ua = bit_xor(a, bias);
+    return int16_t(i_reduce_add(ua) - 0x80u * N);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float i_reduce_add(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    return i_reduce_add_el<float>(a);
+#elif SIMDPP_USE_SSE2
+    __m128 h = _mm_movehl_ps(a, a);
+    __m128 r = _mm_add_ps(a, h);
+    h = _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1));
+    return _mm_cvtss_f32(_mm_add_ss(r, h));
+#elif SIMDPP_USE_NEON64
+    return vaddvq_f32(a);
+#elif SIMDPP_USE_NEON_FLT_SP
+    float32x2_t r = vadd_f32(vget_low_f32(a), vget_high_f32(a));
+    r = vpadd_f32(r, r);
+    return vget_lane_f32(r, 0);
+#elif SIMDPP_USE_ALTIVEC
+    float32x4 r = add(a, move4_l<2>(a));
+    r = add(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float i_reduce_add(const float32x8& a)
+{
+    float32x4 r1, r2;
+    split(a, r1, r2);
+    float32x4 r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float i_reduce_add(const float32<16>& a)
+{
+    float32<8> r1, r2;
+    split(a, r1, r2);
+    float32<8> r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float i_reduce_add(const float32<N>& a)
+{
+    typename float32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, a.vec(j));
+    }
+    return i_reduce_add(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL double i_reduce_add(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return i_reduce_add_el<double>(a);
+#elif SIMDPP_USE_SSE2
+    __m128d h = _mm_unpackhi_pd(a, a);
+    return _mm_cvtsd_f64(_mm_add_sd(a, h));
+#elif SIMDPP_USE_NEON64
+    return vaddvq_f64(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL double i_reduce_add(const float64x4& a)
+{
+    float64x2 r1, r2;
+    split(a, r1, r2);
+    float64x2 r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL double i_reduce_add(const float64<8>& a)
+{
+    float64<4> r1, r2;
+    split(a, r1, r2);
+    float64<4> r = add(r1, r2);
+    return i_reduce_add(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+double i_reduce_add(const float64<N>& a)
+{
+    typename float64<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, a.vec(j));
+    }
+    return i_reduce_add(r);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,91 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_AND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_AND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/move_l.h>
+#include <simdpp/core/split.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  The bitwise reductions don't depend on the element boundaries, thus all
+    integer vectors are reduced as vectors of 64-bit elements and the result
+    is folded to the element width afterwards.
+*/
+SIMDPP_INL uint64_t i_reduce_and(const uint64x2& a)
+{
+#if SIMDPP_USE_NULL
+    return a.el(0) & a.el(1);
+#elif SIMDPP_USE_NEON
+    return vgetq_lane_u64(a, 0) & vgetq_lane_u64(a, 1);
+#else
+    uint64x2 r = bit_and(a, move2_l<1>(a));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint64_t i_reduce_and(const uint64x4& a)
+{
+    uint64x2 r1, r2;
+    split(a, r1, r2);
+    uint64x2 r = bit_and(r1, r2);
+    return i_reduce_and(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint64_t i_reduce_and(const uint64<8>& a)
+{
+    uint64<4> r1, r2;
+    split(a, r1, r2);
+    uint64<4> r = bit_and(r1, r2);
+    return i_reduce_and(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_reduce_and(const uint64<N>& a)
+{
+    typename uint64<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = bit_and(r, a.vec(j));
+    }
+    return i_reduce_and(r);
+}
+
+// Folds the 64-bit result of i_reduce_and to the width of R
+template<class R> SIMDPP_INL
+R i_reduce_and_fold(uint64_t r)
+{
+    for (unsigned w = 32; w >= sizeof(R) * 8; w /= 2) {
+        r &= r >> w;
+    }
+    return R(r);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,489 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_MIN_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_MIN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/move_l.h>
+#include <simdpp/core/split.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+// Computes the minimum of the elements using the scalar element accessors
+template<class R, class V> SIMDPP_INL
+R i_reduce_min_el(const V& a)
+{
+    R r = a.el(0);
+    for (unsigned i = 1; i < a.length; ++i) {
+        r = r < a.el(i) ? r : a.el(i);
+    }
+    return r;
+}
+
+#if SIMDPP_USE_SSE4_1
+/*  phminposuw computes the minimum of unsigned 16-bit elements. The minimum of
+    the other element types is computed by transforming the elements so that
+    their order is preserved and the result is transformed back. The 8-bit
+    elements are first reduced to the 16-bit ones: after the shift the high
+    byte of each 16-bit element is zero.
+*/
+SIMDPP_INL uint16_t i_reduce_minpos16(__m128i a, int x)
+{
+    __m128i r = _mm_xor_si128(a, _mm_set1_epi16(x));
+    r = _mm_minpos_epu16(r);
+    return uint16_t(_mm_cvtsi128_si32(r) ^ x);
+}
+
+SIMDPP_INL uint8_t i_reduce_minpos8(__m128i a, int x)
+{
+    __m128i r = _mm_xor_si128(a, _mm_set1_epi8(char(x)));
+    r = _mm_min_epu8(r, _mm_srli_epi16(r, 8));
+    r = _mm_minpos_epu16(r);
+    return uint8_t(_mm_cvtsi128_si32(r) ^ x);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int8_t i_reduce_min(const int8x16& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<int8_t>(a);
+#elif SIMDPP_USE_SSE4_1
+    return i_reduce_minpos8(a, 0x80);
+#elif SIMDPP_USE_NEON64
+    return vminvq_s8(a);
+#elif SIMDPP_USE_NEON
+    int8x8_t r = vmin_s8(vget_low_s8(a), vget_high_s8(a));
+    r = vpmin_s8(r, r);
+    r = vpmin_s8(r, r);
+    r = vpmin_s8(r, r);
+    return vget_lane_s8(r, 0);
+#else
+    int8x16 r = min(a, move16_l<8>(a));
+    r = min(r, move16_l<4>(r));
+    r = min(r, move16_l<2>(r));
+    r = min(r, move16_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int8_t i_reduce_min(const int8x32& a)
+{
+    int8x16 r1, r2;
+    split(a, r1, r2);
+    int8x16 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int8_t i_reduce_min(const int8<64>& a)
+{
+    int8<32> r1, r2;
+    split(a, r1, r2);
+    int8<32> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int8_t i_reduce_min(const int8<N>& a)
+{
+    typename int8<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint8_t i_reduce_min(const uint8x16& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<uint8_t>(a);
+#elif SIMDPP_USE_SSE4_1
+    return i_reduce_minpos8(a, 0);
+#elif SIMDPP_USE_NEON64
+    return vminvq_u8(a);
+#elif SIMDPP_USE_NEON
+    uint8x8_t r = vmin_u8(vget_low_u8(a), vget_high_u8(a));
+    r = vpmin_u8(r, r);
+    r = vpmin_u8(r, r);
+    r = vpmin_u8(r, r);
+    return vget_lane_u8(r, 0);
+#else
+    uint8x16 r = min(a, move16_l<8>(a));
+    r = min(r, move16_l<4>(r));
+    r = min(r, move16_l<2>(r));
+    r = min(r, move16_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint8_t i_reduce_min(const uint8x32& a)
+{
+    uint8x16 r1, r2;
+    split(a, r1, r2);
+    uint8x16 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8_t i_reduce_min(const uint8<64>& a)
+{
+    uint8<32> r1, r2;
+    split(a, r1, r2);
+    uint8<32> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8_t i_reduce_min(const uint8<N>& a)
+{
+    typename uint8<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int16_t i_reduce_min(const int16x8& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<int16_t>(a);
+#elif SIMDPP_USE_SSE4_1
+    return i_reduce_minpos16(a, 0x8000);
+#elif SIMDPP_USE_NEON64
+    return vminvq_s16(a);
+#elif SIMDPP_USE_NEON
+    int16x4_t r = vmin_s16(vget_low_s16(a), vget_high_s16(a));
+    r = vpmin_s16(r, r);
+    r = vpmin_s16(r, r);
+    return vget_lane_s16(r, 0);
+#else
+    int16x8 r = min(a, move8_l<4>(a));
+    r = min(r, move8_l<2>(r));
+    r = min(r, move8_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int16_t i_reduce_min(const int16x16& a)
+{
+    int16x8 r1, r2;
+    split(a, r1, r2);
+    int16x8 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16_t i_reduce_min(const int16<32>& a)
+{
+    int16<16> r1, r2;
+    split(a, r1, r2);
+    int16<16> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int16_t i_reduce_min(const int16<N>& a)
+{
+    typename int16<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint16_t i_reduce_min(const uint16x8& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<uint16_t>(a);
+#elif SIMDPP_USE_SSE4_1
+    return i_reduce_minpos16(a, 0);
+#elif SIMDPP_USE_SSE2
+    // min_epu16 is not available, use the signed minimum on biased values
+    int16x8 bias = make_int(-0x8000);
+    int16x8 sa = bit_xor(a, bias);
+    return uint16_t(i_reduce_min(sa) ^ 0x8000);
+#elif SIMDPP_USE_NEON64
+    return vminvq_u16(a);
+#elif SIMDPP_USE_NEON
+    uint16x4_t r = vmin_u16(vget_low_u16(a), vget_high_u16(a));
+    r = vpmin_u16(r, r);
+    r = vpmin_u16(r, r);
+    return vget_lane_u16(r, 0);
+#else
+    uint16x8 r = min(a, move8_l<4>(a));
+    r = min(r, move8_l<2>(r));
+    r = min(r, move8_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint16_t i_reduce_min(const uint16x16& a)
+{
+    uint16x8 r1, r2;
+    split(a, r1, r2);
+    uint16x8 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16_t i_reduce_min(const uint16<32>& a)
+{
+    uint16<16> r1, r2;
+    split(a, r1, r2);
+    uint16<16> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16_t i_reduce_min(const uint16<N>& a)
+{
+    typename uint16<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int32_t i_reduce_min(const int32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<int32_t>(a);
+#elif SIMDPP_USE_NEON64
+    return vminvq_s32(a);
+#elif SIMDPP_USE_NEON
+    int32x2_t r = vmin_s32(vget_low_s32(a), vget_high_s32(a));
+    r = vpmin_s32(r, r);
+    return vget_lane_s32(r, 0);
+#else
+    int32x4 r = min(a, move4_l<2>(a));
+    r = min(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int32_t i_reduce_min(const int32x8& a)
+{
+    int32x4 r1, r2;
+    split(a, r1, r2);
+    int32x4 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int32_t i_reduce_min(const int32<16>& a)
+{
+    int32<8> r1, r2;
+    split(a, r1, r2);
+    int32<8> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32_t i_reduce_min(const int32<N>& a)
+{
+    typename int32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32_t i_reduce_min(const uint32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_min_el<uint32_t>(a);
+#elif SIMDPP_USE_NEON64
+    return vminvq_u32(a);
+#elif SIMDPP_USE_NEON
+    uint32x2_t r = vmin_u32(vget_low_u32(a), vget_high_u32(a));
+    r = vpmin_u32(r, r);
+    return vget_lane_u32(r, 0);
+#else
+    uint32x4 r = min(a, move4_l<2>(a));
+    r = min(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32_t i_reduce_min(const uint32x8& a)
+{
+    uint32x4 r1, r2;
+    split(a, r1, r2);
+    uint32x4 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32_t i_reduce_min(const uint32<16>& a)
+{
+    uint32<8> r1, r2;
+    split(a, r1, r2);
+    uint32<8> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_min(const uint32<N>& a)
+{
+    typename uint32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float i_reduce_min(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    return i_reduce_min_el<float>(a);
+#elif SIMDPP_USE_SSE2
+    __m128 h = _mm_movehl_ps(a, a);
+    __m128 r = _mm_min_ps(a, h);
+    h = _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1));
+    return _mm_cvtss_f32(_mm_min_ss(r, h));
+#elif SIMDPP_USE_NEON64
+    return vminvq_f32(a);
+#elif SIMDPP_USE_NEON_FLT_SP
+    float32x2_t r = vmin_f32(vget_low_f32(a), vget_high_f32(a));
+    r = vpmin_f32(r, r);
+    return vget_lane_f32(r, 0);
+#elif SIMDPP_USE_ALTIVEC
+    float32x4 r = min(a, move4_l<2>(a));
+    r = min(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float i_reduce_min(const float32x8& a)
+{
+    float32x4 r1, r2;
+    split(a, r1, r2);
+    float32x4 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float i_reduce_min(const float32<16>& a)
+{
+    float32<8> r1, r2;
+    split(a, r1, r2);
+    float32<8> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float i_reduce_min(const float32<N>& a)
+{
+    typename float32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL double i_reduce_min(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return i_reduce_min_el<double>(a);
+#elif SIMDPP_USE_SSE2
+    __m128d h = _mm_unpackhi_pd(a, a);
+    return _mm_cvtsd_f64(_mm_min_sd(a, h));
+#elif SIMDPP_USE_NEON64
+    return vminvq_f64(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL double i_reduce_min(const float64x4& a)
+{
+    float64x2 r1, r2;
+    split(a, r1, r2);
+    float64x2 r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL double i_reduce_min(const float64<8>& a)
+{
+    float64<4> r1, r2;
+    split(a, r1, r2);
+    float64<4> r = min(r1, r2);
+    return i_reduce_min(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+double i_reduce_min(const float64<N>& a)
+{
+    typename float64<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = min(r, a.vec(j));
+    }
+    return i_reduce_min(r);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,225 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_MUL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_REDUCE_MUL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/move_l.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+// Multiplies all elements of a vector using the scalar element accessors
+template<class R, class V> SIMDPP_INL
+R i_reduce_mul_el(const V& a)
+{
+    R r = a.el(0);
+    for (unsigned i = 1; i < a.length; ++i) {
+        r *= a.el(i);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32_t i_reduce_mul(const uint32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return i_reduce_mul_el<uint32_t>(a);
+#elif SIMDPP_USE_SSE2
+    // pmuludq multiplies the even elements; the products of adjacent
+    // elements are computed first, then the product of the two results
+    __m128i r = _mm_mul_epu32(a, _mm_srli_epi64(a, 32));
+    r = _mm_mul_epu32(r, _mm_srli_si128(r, 8));
+    return _mm_cvtsi128_si32(r);
+#elif SIMDPP_USE_NEON
+    uint32x2_t r = vmul_u32(vget_low_u32(a), vget_high_u32(a));
+    return vget_lane_u32(r, 0) * vget_lane_u32(r, 1);
+#elif SIMDPP_USE_ALTIVEC
+    uint32x4 r = mul_lo(a, move4_l<2>(a));
+    r = mul_lo(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32_t i_reduce_mul(const uint32x8& a)
+{
+    uint32x4 r1, r2;
+    split(a, r1, r2);
+    uint32x4 r = mul_lo(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32_t i_reduce_mul(const uint32<16>& a)
+{
+    uint32<8> r1, r2;
+    split(a, r1, r2);
+    uint32<8> r = mul_lo(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_mul(const uint32<N>& a)
+{
+    typename uint32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = mul_lo(r, a.vec(j));
+    }
+    return i_reduce_mul(r);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The 16-bit elements are extended to 32 bits so that the low half of the
+    product is computed. The two halves are multiplied right away.
+*/
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_mul(const uint16<N>& a)
+{
+    uint16<N> zero = uint16<N>::zero();
+    uint32<N/2> lo, hi;
+#if SIMDPP_USE_ALTIVEC
+    lo = zip8_lo(zero, a);
+    hi = zip8_hi(zero, a);
+#else
+    lo = zip8_lo(a, zero);
+    hi = zip8_hi(a, zero);
+#endif
+    uint32<N/2> r = mul_lo(lo, hi);
+    return i_reduce_mul(r);
+}
+
+template<unsigned N> SIMDPP_INL
+int32_t i_reduce_mul(const int16<N>& a)
+{
+    uint32<N> w = to_int32(a);
+    return int32_t(i_reduce_mul(w));
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float i_reduce_mul(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    return i_reduce_mul_el<float>(a);
+#elif SIMDPP_USE_SSE2
+    __m128 h = _mm_movehl_ps(a, a);
+    __m128 r = _mm_mul_ps(a, h);
+    h = _mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1));
+    return _mm_cvtss_f32(_mm_mul_ss(r, h));
+#elif SIMDPP_USE_NEON_FLT_SP
+    float32x2_t r = vmul_f32(vget_low_f32(a), vget_high_f32(a));
+    return vget_lane_f32(r, 0) * vget_lane_f32(r, 1);
+#elif SIMDPP_USE_ALTIVEC
+    float32x4 r = mul(a, move4_l<2>(a));
+    r = mul(r, move4_l<1>(r));
+    return extract<0>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float i_reduce_mul(const float32x8& a)
+{
+    float32x4 r1, r2;
+    split(a, r1, r2);
+    float32x4 r = mul(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float i_reduce_mul(const float32<16>& a)
+{
+    float32<8> r1, r2;
+    split(a, r1, r2);
+    float32<8> r = mul(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float i_reduce_mul(const float32<N>& a)
+{
+    typename float32<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = mul(r, a.vec(j));
+    }
+    return i_reduce_mul(r);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL double i_reduce_mul(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    return i_reduce_mul_el<double>(a);
+#elif SIMDPP_USE_SSE2
+    __m128d h = _mm_unpackhi_pd(a, a);
+    return _mm_cvtsd_f64(_mm_mul_sd(a, h));
+#elif SIMDPP_USE_NEON64
+    return vgetq_lane_f64(a, 0) * vgetq_lane_f64(a, 1);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL double i_reduce_mul(const float64x4& a)
+{
+    float64x2 r1, r2;
+    split(a, r1, r2);
+    float64x2 r = mul(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL double i_reduce_mul(const float64<8>& a)
+{
+    float64<4> r1, r2;
+    split(a, r1, r2);
+    float64<4> r = mul(r1, r2);
+    return i_reduce_mul(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+double i_reduce_mul(const float64<N>& a)
+{
+    typename float64<N>::base_vector_type r = a.vec(0);
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = mul(r, a.vec(j));
+    }
+    return i_reduce_mul(r);
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
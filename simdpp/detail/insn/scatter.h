@@ -0,0 +1,328 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Stores the elements one by one. The elements are stored in the order of
+    increasing index so that the element at the highest position wins when
+    several indices are equal. This matches the AVX-512 scatter instructions.
+*/
+template<class V, class I> SIMDPP_INL
+void i_scatter_emul(typename V::element_type* base, const I& idx, const V& a)
+{
+    mem_block<I> ix(idx);
+    mem_block<V> ma(a);
+    for (unsigned i = 0; i < V::length; ++i) {
+        base[ix[i]] = ma[i];
+    }
+}
+
+// Stores only the elements for which the element in @a mask is nonzero
+template<class V, class I, class M> SIMDPP_INL
+void i_scatter_masked_emul(typename V::element_type* base, const I& idx,
+                           const V& a, const M& mask)
+{
+    mem_block<I> ix(idx);
+    mem_block<M> mk(mask);
+    mem_block<V> ma(a);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (mk[i] != 0) {
+            base[ix[i]] = ma[i];
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter(uint32_t* base, const uint32x4& idx, const uint32x4& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_scatter(uint32_t* base, const uint32x8& idx, const uint32x8& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter(uint32_t* base, const uint32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(base, idx, a, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(uint32_t* base, const uint32<N>& idx, const uint32<N>& a)
+{
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter(base, idx.vec(j), a.vec(j));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter(float* base, const uint32x4& idx, const float32x4& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_scatter(float* base, const uint32<8>& idx, const float32x8& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter(float* base, const uint32<16>& idx, const float32<16>& a)
+{
+    _mm512_i32scatter_ps(base, idx, a, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(float* base, const uint32<N>& idx, const float32<N>& a)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // the floating-point vectors are wider than the integer vectors
+    i_scatter_emul(base, idx, a);
+#else
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter(base, idx.vec(j), a.vec(j));
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter(uint64_t* base, const uint64x2& idx, const uint64x2& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_scatter(uint64_t* base, const uint64x4& idx, const uint64x4& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter(uint64_t* base, const uint64<8>& idx, const uint64<8>& a)
+{
+    _mm512_i64scatter_epi64(base, idx, a, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(uint64_t* base, const uint64<N>& idx, const uint64<N>& a)
+{
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter(base, idx.vec(j), a.vec(j));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter(double* base, const uint64x2& idx, const float64x2& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_scatter(double* base, const uint64<4>& idx, const float64x4& a)
+{
+    i_scatter_emul(base, idx, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter(double* base, const uint64<8>& idx, const float64<8>& a)
+{
+    _mm512_i64scatter_pd(base, idx, a, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter(double* base, const uint64<N>& idx, const float64<N>& a)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    // the floating-point vectors are wider than the integer vectors
+    i_scatter_emul(base, idx, a);
+#else
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter(base, idx.vec(j), a.vec(j));
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter_masked(uint32_t* base, const uint32x4& idx,
+                                 const uint32x4& a, const mask_int32x4& mask)
+{
+    i_scatter_masked_emul(base, idx, a, mask.unmask());
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_scatter_masked(uint32_t* base, const uint32x8& idx,
+                                 const uint32x8& a, const mask_int32x8& mask)
+{
+    i_scatter_masked_emul(base, idx, a, mask.unmask());
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter_masked(uint32_t* base, const uint32<16>& idx,
+                                 const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(base, mask, idx, a, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(uint32_t* base, const uint32<N>& idx,
+                      const uint32<N>& a, const mask_int32<N>& mask)
+{
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter_masked(base, idx.vec(j), a.vec(j), mask.vec(j));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter_masked(float* base, const uint32x4& idx,
+                                 const float32x4& a, const mask_float32x4& mask)
+{
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint32x4>(mask.unmask()));
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_scatter_masked(float* base, const uint32<8>& idx,
+                                 const float32x8& a, const mask_float32x8& mask)
+{
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint32<8>>(mask.unmask()));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter_masked(float* base, const uint32<16>& idx,
+                                 const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_i32scatter_ps(base, mask, idx, a, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(float* base, const uint32<N>& idx,
+                      const float32<N>& a, const mask_float32<N>& mask)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint32<N>>(mask.unmask()));
+#else
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter_masked(base, idx.vec(j), a.vec(j), mask.vec(j));
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter_masked(uint64_t* base, const uint64x2& idx,
+                                 const uint64x2& a, const mask_int64x2& mask)
+{
+    i_scatter_masked_emul(base, idx, a, mask.unmask());
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_scatter_masked(uint64_t* base, const uint64x4& idx,
+                                 const uint64x4& a, const mask_int64x4& mask)
+{
+    i_scatter_masked_emul(base, idx, a, mask.unmask());
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter_masked(uint64_t* base, const uint64<8>& idx,
+                                 const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_i64scatter_epi64(base, mask, idx, a, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(uint64_t* base, const uint64<N>& idx,
+                      const uint64<N>& a, const mask_int64<N>& mask)
+{
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter_masked(base, idx.vec(j), a.vec(j), mask.vec(j));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_scatter_masked(double* base, const uint64x2& idx,
+                                 const float64x2& a, const mask_float64x2& mask)
+{
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint64x2>(mask.unmask()));
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_scatter_masked(double* base, const uint64<4>& idx,
+                                 const float64x4& a, const mask_float64x4& mask)
+{
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint64<4>>(mask.unmask()));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_scatter_masked(double* base, const uint64<8>& idx,
+                                 const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_i64scatter_pd(base, mask, idx, a, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_scatter_masked(double* base, const uint64<N>& idx,
+                      const float64<N>& a, const mask_float64<N>& mask)
+{
+#if SIMDPP_USE_AVX && !SIMDPP_USE_AVX2
+    i_scatter_masked_emul(base, idx, a, bit_cast<uint64<N>>(mask.unmask()));
+#else
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        i_scatter_masked(base, idx.vec(j), a.vec(j), mask.vec(j));
+    }
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
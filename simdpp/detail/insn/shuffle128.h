@@ -63,6 +63,18 @@ uint64<8> shuffle2_128(const uint64<8>& a, const uint64<8>& b)
     static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
     return _mm512_shuffle_i64x2(a, b, (s3<<6) + (s2<<4) + (s1<<2) + s0);
 }
+#if SIMDPP_USE_AVX512BW
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
+uint8<64> shuffle2_128(const uint8<64>& a, const uint8<64>& b)
+{
+    return (uint8<64>) shuffle2_128<s0,s1,s2,s3>(uint64<8>(a), uint64<8>(b));
+}
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
+uint16<32> shuffle2_128(const uint16<32>& a, const uint16<32>& b)
+{
+    return (uint16<32>) shuffle2_128<s0,s1,s2,s3>(uint64<8>(a), uint64<8>(b));
+}
+#endif
 template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
 float32<16> shuffle2_128(const float32<16>& a, const float32<16>& b)
 {
@@ -141,6 +153,22 @@ float64x4 shuffle1_128(const float64x4& a, const float64x4& b)
 #endif
 }
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s0, unsigned s1> SIMDPP_INL
+uint8<64> shuffle1_128(const uint8<64>& a, const uint8<64>& b)
+{
+    static_assert(s0 < 2 && s1 < 2, "Selector out of range");
+    return shuffle2_128<s0,s1,s0+2,s1+2>(a, b);
+}
+
+template<unsigned s0, unsigned s1> SIMDPP_INL
+uint16<32> shuffle1_128(const uint16<32>& a, const uint16<32>& b)
+{
+    static_assert(s0 < 2 && s1 < 2, "Selector out of range");
+    return shuffle2_128<s0,s1,s0+2,s1+2>(a, b);
+}
+#endif
+
 #if SIMDPP_USE_AVX512
 template<unsigned s0, unsigned s1> SIMDPP_INL
 uint32<16> shuffle1_128(const uint32<16>& a, const uint32<16>& b)
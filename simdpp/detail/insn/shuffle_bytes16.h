@@ -94,6 +94,18 @@ SIMDPP_INL uint8x32 i_shuffle_bytes16(const uint8x32& a, const uint8x32& b, cons
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_shuffle_bytes16(const uint8<64>& a, const uint8<64>& b, const uint8<64>& mask)
+{
+    uint8<64> ai, bi;
+    __mmask64 sel = _mm512_test_epi8_mask(mask, _mm512_set1_epi8(0x10));
+
+    ai = _mm512_shuffle_epi8(a, mask);
+    bi = _mm512_shuffle_epi8(b, mask);
+    return _mm512_mask_blend_epi8(sel, ai, bi);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_shuffle_bytes16(const uint8<N>& a, const uint8<N>& b, const uint8<N>& mask)
 {
@@ -47,6 +47,18 @@ uint8x32 i_splat(const uint8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s> SIMDPP_INL
+uint8<64> i_splat(const uint8<64>& a)
+{
+    static_assert(s < 64, "Access out of bounds");
+    uint8x16 lo;
+    lo = _mm512_extracti32x4_epi32(a, s / 16);
+    lo = move16_l<s % 16>(lo);
+    return _mm512_broadcastb_epi8(lo);
+}
+#endif
+
 template<unsigned s, unsigned N> SIMDPP_INL
 uint8<N> i_splat(const uint8<N>& a)
 {
@@ -74,6 +86,18 @@ uint16x16 i_splat(const uint16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s> SIMDPP_INL
+uint16<32> i_splat(const uint16<32>& a)
+{
+    static_assert(s < 32, "Access out of bounds");
+    uint16x8 lo;
+    lo = _mm512_extracti32x4_epi32(a, s / 8);
+    lo = move8_l<s % 8>(lo);
+    return _mm512_broadcastw_epi16(lo);
+}
+#endif
+
 template<unsigned s, unsigned N> SIMDPP_INL
 uint16<N> i_splat(const uint16<N>& a)
 {
@@ -36,6 +36,10 @@ uint16x8 i_splat8(const uint16x8& a);
 template<unsigned s> SIMDPP_INL
 uint16x16 i_splat8(const uint16x16& a);
 #endif
+#if SIMDPP_USE_AVX512BW
+template<unsigned s> SIMDPP_INL
+uint16<32> i_splat8(const uint16<32>& a);
+#endif
 
 // -----------------------------------------------------------------------------
 
@@ -88,6 +92,16 @@ uint8x32 i_splat16(const uint8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s> SIMDPP_INL
+uint8<64> i_splat16(const uint8<64>& a)
+{
+    static_assert(s < 16, "Access out of bounds");
+    uint16<32> b; b = s < 8 ? zip16_lo(a, a) : zip16_hi(a, a);
+    return (uint8<64>) i_splat8<s%8>(b);
+}
+#endif
+
 template<unsigned s, unsigned N> SIMDPP_INL
 uint8<N> i_splat16(const uint8<N>& a)
 {
@@ -153,6 +167,25 @@ uint16x16 i_splat8(const uint16x16& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+template<unsigned s> SIMDPP_INL
+uint16<32> i_splat8(const uint16<32>& a)
+{
+    static_assert(s < 8, "Access out of bounds");
+    if (s < 4) {
+        const unsigned q = (s < 4) ? s : 0;
+        uint64<8> h = _mm512_shufflelo_epi16(a, q << 6 | q << 4 | q << 2 | q);
+        h = permute2<0,0>(h);
+        return uint16<32>(h);
+    } else {
+        const unsigned q = (s < 4) ? 0 : s - 4;
+        uint64<8> h = _mm512_shufflehi_epi16(a, q << 6 | q << 4 | q << 2 | q);
+        h = permute2<1,1>(h);
+        return uint16<32>(h);
+    }
+}
+#endif
+
 template<unsigned s, unsigned N> SIMDPP_INL
 uint16<N> i_splat8(const uint16<N>& a)
 {
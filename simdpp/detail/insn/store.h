@@ -45,6 +45,14 @@ SIMDPP_INL void i_store(char* p, const uint8x32& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store(char* p, const uint8<64>& a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_store_si512(p, a);
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 SIMDPP_INL void i_store(char* p, const uint16<8>& a)
@@ -59,6 +67,14 @@ SIMDPP_INL void i_store(char* p, const uint16<16>& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store(char* p, const uint16<32>& a)
+{
+    p = detail::assume_aligned(p, 64);
+    _mm512_store_si512(p, a);
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 SIMDPP_INL void i_store(char* p, const uint32<4>& a)
@@ -105,6 +121,30 @@ SIMDPP_INL void i_store(char* p, const uint64<8>& a)
 
 // -----------------------------------------------------------------------------
 
+SIMDPP_INL void i_store(char* p, const float16<8>& a)
+{
+    i_store(p, uint8<16>(a));
+}
+
+SIMDPP_INL void i_store(char* p, const bfloat16<8>& a)
+{
+    i_store(p, uint8<16>(a));
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_store(char* p, const float16<16>& a)
+{
+    i_store(p, uint8<32>(a));
+}
+
+SIMDPP_INL void i_store(char* p, const bfloat16<16>& a)
+{
+    i_store(p, uint8<32>(a));
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 SIMDPP_INL void i_store(char* p, const float32x4& a)
 {
     float* q = reinterpret_cast<float*>(p);
@@ -191,6 +231,10 @@ void i_store(char* p, const uint32<N>& a) { v_store(p, a); }
 template<unsigned N> SIMDPP_INL
 void i_store(char* p, const uint64<N>& a) { v_store(p, a); }
 template<unsigned N> SIMDPP_INL
+void i_store(char* p, const float16<N>& a){ v_store(p, a); }
+template<unsigned N> SIMDPP_INL
+void i_store(char* p, const bfloat16<N>& a){ v_store(p, a); }
+template<unsigned N> SIMDPP_INL
 void i_store(char* p, const float32<N>& a){ v_store(p, a); }
 template<unsigned N> SIMDPP_INL
 void i_store(char* p, const float64<N>& a){ v_store(p, a); }
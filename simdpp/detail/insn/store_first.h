@@ -66,7 +66,15 @@ SIMDPP_INL void i_store_first(char* p, const uint8x32& a, unsigned n)
     uint8x32 mask = load_u(mask_d + 32 - n);
     uint8x32 b = load(p);
     b = blend(a, b, mask);
-    store(p, a);
+    store(p, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_first(char* p, const uint8<64>& a, unsigned n)
+{
+    __mmask64 mask = n >= 64 ? ~__mmask64(0) : (__mmask64(1) << n) - 1;
+    _mm512_mask_storeu_epi8(p, mask, a);
 }
 #endif
 
@@ -95,6 +103,13 @@ SIMDPP_INL void i_store_first(char* p, const uint16x16& a, unsigned n)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_first(char* p, const uint16<32>& a, unsigned n)
+{
+    _mm512_mask_storeu_epi16(p, __mmask32(0xffffffffull >> (32-n)), a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_first(char* p, const uint16<N>& a, unsigned n)
 {
@@ -71,6 +71,14 @@ SIMDPP_INL void i_store_last(char* p, const uint8x32& a, unsigned n)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_last(char* p, const uint8<64>& a, unsigned n)
+{
+    __mmask64 mask = n == 0 ? __mmask64(0) : ~__mmask64(0) << (64-n);
+    _mm512_mask_storeu_epi8(p, mask, a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_last(char* p, const uint8<N>& a, unsigned n)
 {
@@ -97,6 +105,13 @@ SIMDPP_INL void i_store_last(char* p, const uint16x16& a, unsigned n)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_last(char* p, const uint16<32>& a, unsigned n)
+{
+    _mm512_mask_storeu_epi16(p, __mmask32(0xffffffffull << (32-n)), a);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_last(char* p, const uint16<N>& a, unsigned n)
 {
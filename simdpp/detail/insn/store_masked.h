@@ -0,0 +1,278 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_MASKED_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/align.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/store.h>
+#include <simdpp/detail/null/memory.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+// Multi-vector i_store_masked is mostly boilerplate
+template<class V, class M> SIMDPP_INL
+void v_store_masked(char* p, const V& a, const M& mask);
+
+// Instruction sets without masked stores read the destination, merge the new
+// elements and write the whole vector back
+template<class V, class M> SIMDPP_INL
+void v_store_masked_blend(char* p, const V& a, const M& mask)
+{
+    V b = load(p);
+    b = blend(a, b, mask);
+    store(p, b);
+}
+
+SIMDPP_INL void i_store_masked(char* p, const uint8<16>& a, const mask_int8<16>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_store_masked(char* p, const uint8<32>& a, const mask_int8<32>& mask)
+{
+    v_store_masked_blend(p, a, mask);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_masked(char* p, const uint8<64>& a, const mask_int8<64>& mask)
+{
+    _mm512_mask_storeu_epi8(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const uint8<N>& a, const mask_int8<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_store_masked(char* p, const uint16<8>& a, const mask_int16<8>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_store_masked(char* p, const uint16<16>& a, const mask_int16<16>& mask)
+{
+    v_store_masked_blend(p, a, mask);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_masked(char* p, const uint16<32>& a, const mask_int16<32>& mask)
+{
+    _mm512_mask_storeu_epi16(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const uint16<N>& a, const mask_int16<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_store_masked(char* p, const uint32<4>& a, const mask_int32<4>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX2
+    _mm_maskstore_epi32(reinterpret_cast<int*>(p), mask, a);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_store_masked(char* p, const uint32<8>& a, const mask_int32<8>& mask)
+{
+    _mm256_maskstore_epi32(reinterpret_cast<int*>(p), mask, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_store_masked(char* p, const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_store_epi32(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const uint32<N>& a, const mask_int32<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_store_masked(char* p, const uint64<2>& a, const mask_int64<2>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    _mm_maskstore_epi64(reinterpret_cast<__int64*>(p), mask, a);
+#else
+    _mm_maskstore_epi64(reinterpret_cast<long long*>(p), mask, a);
+#endif
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL void i_store_masked(char* p, const uint64<4>& a, const mask_int64<4>& mask)
+{
+#if __INTEL_COMPILER
+    _mm256_maskstore_epi64(reinterpret_cast<__int64*>(p), mask, a);
+#else
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(p), mask, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_store_masked(char* p, const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_store_epi64(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const uint64<N>& a, const mask_int64<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_store_masked(char* p, const float32<4>& a, const mask_float32<4>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX && !SIMDPP_USE_AMD
+    _mm_maskstore_ps(reinterpret_cast<float*>(p), _mm_castps_si128(mask), a);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_store_masked(char* p, const float32<8>& a, const mask_float32<8>& mask)
+{
+#if !SIMDPP_USE_AMD
+    _mm256_maskstore_ps(reinterpret_cast<float*>(p), _mm256_castps_si256(mask), a);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_store_masked(char* p, const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_store_ps(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const float32<N>& a, const mask_float32<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL void i_store_masked(char* p, const float64<2>& a, const mask_float64<2>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    detail::null::store_masked(p, a, mask);
+#elif SIMDPP_USE_AVX && !SIMDPP_USE_AMD
+    _mm_maskstore_pd(reinterpret_cast<double*>(p), _mm_castpd_si128(mask), a);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL void i_store_masked(char* p, const float64<4>& a, const mask_float64<4>& mask)
+{
+#if !SIMDPP_USE_AMD
+    _mm256_maskstore_pd(reinterpret_cast<double*>(p), _mm256_castpd_si256(mask), a);
+#else
+    v_store_masked_blend(p, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_store_masked(char* p, const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_store_pd(p, mask, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_masked(char* p, const float64<N>& a, const mask_float64<N>& mask)
+{
+    v_store_masked(p, a, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+void v_store_masked(char* p, const V& a, const M& mask)
+{
+    unsigned veclen = sizeof(typename V::base_vector_type);
+
+    p = detail::assume_aligned(p, veclen);
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_store_masked(p, a.vec(i), mask.vec(i));
+        p += veclen;
+    }
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -59,6 +59,13 @@ SIMDPP_INL void i_store_packed2(char* p, const uint8x32& a, const uint8x32& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed2(char* p, const uint8<64>& a, const uint8<64>& b)
+{
+    v512_store_pack2(p, a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed2(char* p, const uint8<N>& a, const uint8<N>& b)
 {
@@ -89,6 +96,13 @@ SIMDPP_INL void i_store_packed2(char* p, const uint16x16& a, const uint16x16& b)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed2(char* p, const uint16<32>& a, const uint16<32>& b)
+{
+    v512_store_pack2(p, a, b);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed2(char* p, const uint16<N>& a, const uint16<N>& b)
 {
@@ -62,6 +62,14 @@ SIMDPP_INL void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed3(char* p,
+                                const uint8<64>& a, const uint8<64>& b, const uint8<64>& c)
+{
+    v512_store_pack3(p, a, b, c);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed3(char* p,
                      const uint8<N>& a, const uint8<N>& b, const uint8<N>& c)
@@ -96,6 +104,14 @@ SIMDPP_INL void i_store_packed3(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed3(char* p,
+                                const uint16<32>& a, const uint16<32>& b, const uint16<32>& c)
+{
+    v512_store_pack3(p, a, b, c);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed3(char* p,
                      const uint16<N>& a, const uint16<N>& b, const uint16<N>& c)
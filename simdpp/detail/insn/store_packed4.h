@@ -64,6 +64,14 @@ SIMDPP_INL void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed4(char* p,
+                                const uint8<64>& a, const uint8<64>& b, const uint8<64>& c, const uint8<64>& d)
+{
+    v512_store_pack4(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed4(char* p,
                      const uint8<N>& a, const uint8<N>& b, const uint8<N>& c, const uint8<N>& d)
@@ -99,6 +107,14 @@ SIMDPP_INL void i_store_packed4(char* p,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_packed4(char* p,
+                                const uint16<32>& a, const uint16<32>& b, const uint16<32>& c, const uint16<32>& d)
+{
+    v512_store_pack4(p, a, b, c, d);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_store_packed4(char* p,
                      const uint16<N>& a, const uint16<N>& b, const uint16<N>& c, const uint16<N>& d)
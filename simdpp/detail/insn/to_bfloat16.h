@@ -0,0 +1,161 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_BFLOAT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_BFLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/detail/vec_extract.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+// Sets the quiet bit of NaN elements. The bfloat16 value is stored in the
+// high 16 bits of each element.
+template<unsigned N> SIMDPP_INL
+uint32<N> i_bfloat16_quiet_nan(const uint32<N>& r, const uint32<N>& x)
+{
+    int32<N> ax = bit_and(x, make_uint<uint32<N>>(0x7fffffff));
+    uint32<N> qnan = bit_or(x, make_uint<uint32<N>>(0x00400000));
+    return blend(qnan, r, cmp_gt(ax, make_int<int32<N>>(0x7f800000)));
+}
+
+// Rounds to nearest even by adding 0x7fff plus the lowest retained bit. The
+// carry propagates into the exponent, thus large values overflow to infinity.
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_bfloat16_emul(const float32<N>& a)
+{
+    uint32<N> x = bit_cast<uint32<N>>(a);
+    uint32<N> r = shift_r<16>(x);
+    r = bit_and(r, make_uint<uint32<N>>(1));
+    r = add(r, make_uint<uint32<N>>(0x7fff));
+    r = add(x, r);
+    return i_bfloat16_quiet_nan(r, x);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_bfloat16_trunc_emul(const float32<N>& a)
+{
+    uint32<N> x = bit_cast<uint32<N>>(a);
+    return i_bfloat16_quiet_nan(x, x);
+}
+
+// Narrows the high 16 bits of each element
+SIMDPP_INL bfloat16<8> i_bfloat16_narrow(const uint32<8>& a)
+{
+#if SIMDPP_USE_NULL
+    bfloat16<8> r;
+    for (unsigned i = 0; i < 4; ++i) {
+        r.el(i) = uint16_t(a.vec(0).el(i) >> 16);
+        r.el(i+4) = uint16_t(a.vec(1).el(i) >> 16);
+    }
+    return r;
+#elif SIMDPP_USE_AVX2
+    // arithmetic shift keeps the values within the range of int16
+    __m256i s = _mm256_srai_epi32(a, 16);
+    return _mm_packs_epi32(_mm256_castsi256_si128(s),
+                           _mm256_extracti128_si256(s, 1));
+#elif SIMDPP_USE_SSE2
+    __m128i s1 = _mm_srai_epi32(a.vec(0), 16);
+    __m128i s2 = _mm_srai_epi32(a.vec(1), 16);
+    return _mm_packs_epi32(s1, s2);
+#elif SIMDPP_USE_NEON
+    return vcombine_u16(vshrn_n_u32(a.vec(0), 16), vshrn_n_u32(a.vec(1), 16));
+#elif SIMDPP_USE_ALTIVEC
+    uint32<8> s = shift_r<16>(a);
+    return vec_pack((__vector uint32_t)s.vec(0), (__vector uint32_t)s.vec(1));
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL bfloat16<16> i_bfloat16_narrow(const uint32<16>& a)
+{
+    return _mm512_cvtepi32_epi16(_mm512_srli_epi32(a, 16));
+}
+#endif
+
+SIMDPP_INL bfloat16<8> i_to_bfloat16(const float32<8>& a)
+{
+#if SIMDPP_USE_AVX512BF16
+    __m256bh r = _mm512_cvtneps_pbh(_mm512_castps256_ps512(a));
+    return _mm256_castsi256_si128((__m256i) r);
+#else
+    return i_bfloat16_narrow(i_to_bfloat16_emul(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL bfloat16<16> i_to_bfloat16(const float32<16>& a)
+{
+#if SIMDPP_USE_AVX512BF16
+    return (__m256i) _mm512_cvtneps_pbh(a);
+#else
+    return i_bfloat16_narrow(i_to_bfloat16_emul(a));
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+bfloat16<N> i_to_bfloat16(const float32<N>& a)
+{
+    bfloat16<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_bfloat16(detail::vec_extract<bfloat16<N>::base_length>(a, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL bfloat16<8> i_to_bfloat16_trunc(const float32<8>& a)
+{
+    return i_bfloat16_narrow(i_to_bfloat16_trunc_emul(a));
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL bfloat16<16> i_to_bfloat16_trunc(const float32<16>& a)
+{
+    return i_bfloat16_narrow(i_to_bfloat16_trunc_emul(a));
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+bfloat16<N> i_to_bfloat16_trunc(const float32<N>& a)
+{
+    bfloat16<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_bfloat16_trunc(detail::vec_extract<bfloat16<N>::base_length>(a, i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,248 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_BITMASK_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_BITMASK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/reduce_add.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_int8x16& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_epi8(a);
+#else
+    return extract_bits_any(a.unmask());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL unsigned i_to_bitmask(const mask_int8x32& a)
+{
+    return unsigned(_mm256_movemask_epi8(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint64_t i_to_bitmask(const mask_int8<64>& a)
+{
+    return __mmask64(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_int8<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_int16x8& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_epi8(_mm_packs_epi16(a, _mm_setzero_si128()));
+#else
+    uint16x8 w = make_uint(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    return i_reduce_add(uint16x8(bit_and(a.unmask(), w)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL unsigned i_to_bitmask(const mask_int16x16& a)
+{
+    // the elements are packed within each 128-bit lane
+    unsigned r = _mm256_movemask_epi8(_mm256_packs_epi16(a, _mm256_setzero_si256()));
+    return (r & 0xff) | ((r >> 8) & 0xff00);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL unsigned i_to_bitmask(const mask_int16<32>& a)
+{
+    return __mmask32(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_int16<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_int32x4& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_ps(_mm_castsi128_ps(a));
+#else
+    uint32x4 w = make_uint(0x1, 0x2, 0x4, 0x8);
+    return i_reduce_add(uint32x4(bit_and(a.unmask(), w)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL unsigned i_to_bitmask(const mask_int32x8& a)
+{
+    return _mm256_movemask_ps(_mm256_castsi256_ps(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL unsigned i_to_bitmask(const mask_int32<16>& a)
+{
+    return __mmask16(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_int32<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_int64x2& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_pd(_mm_castsi128_pd(a));
+#else
+    uint64x2 w = make_uint(0x1, 0x2);
+    return unsigned(i_reduce_add(uint64x2(bit_and(a.unmask(), w))));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL unsigned i_to_bitmask(const mask_int64x4& a)
+{
+    return _mm256_movemask_pd(_mm256_castsi256_pd(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL unsigned i_to_bitmask(const mask_int64<8>& a)
+{
+    return __mmask8(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_int64<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_float32x4& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_ps(a);
+#else
+    return i_to_bitmask(mask_int32x4(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL unsigned i_to_bitmask(const mask_float32x8& a)
+{
+    return _mm256_movemask_ps(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL unsigned i_to_bitmask(const mask_float32<16>& a)
+{
+    return __mmask16(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_float32<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL unsigned i_to_bitmask(const mask_float64x2& a)
+{
+#if SIMDPP_USE_SSE2
+    return _mm_movemask_pd(a);
+#else
+    return i_to_bitmask(mask_int64x2(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL unsigned i_to_bitmask(const mask_float64x4& a)
+{
+    return _mm256_movemask_pd(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL unsigned i_to_bitmask(const mask_float64<8>& a)
+{
+    return __mmask8(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64_t i_to_bitmask(const mask_float64<N>& a)
+{
+    uint64_t r = 0;
+    for (unsigned j = 0; j < a.vec_length; ++j) {
+        r |= uint64_t(i_to_bitmask(a.vec(j))) << (j * a.base_length);
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,150 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/detail/vec_extract.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace insn {
+
+/*  Exact conversion to binary16 values, rounding to nearest even. The result
+    is stored in the low 16 bits of each element.
+
+    Results in the normal range are rounded on the integer representation and
+    then the exponent is rebiased. For results in the denormal range, 0.5 is
+    added to the absolute value, which moves the rounding point of the float
+    mantissa to 2^-24, the quantum of binary16 denormals. Values at or above
+    65520 overflow to infinity, NaNs are made quiet keeping the top bits of the
+    payload.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_float16_emul(const float32<N>& a)
+{
+    uint32<N> x = bit_cast<uint32<N>>(a);
+    uint32<N> sign = shift_r<16>(x);
+    sign = bit_and(sign, make_uint<uint32<N>>(0x8000));
+    int32<N> ax = bit_and(x, make_uint<uint32<N>>(0x7fffffff));
+
+    uint32<N> rn, rd, rnan, r;
+    rn = shift_r<13>(ax);
+    rn = bit_and(rn, make_uint<uint32<N>>(1));
+    rn = add(ax, rn);
+    rn = sub(rn, make_uint<uint32<N>>(0x38000000 - 0xfff));
+    rn = shift_r<13>(rn);
+
+    float32<N> fd = bit_cast<float32<N>>(ax);
+    fd = add(fd, make_float<float32<N>>(0.5f));
+    rd = bit_cast<uint32<N>>(fd);
+    rd = sub(rd, make_uint<uint32<N>>(0x3f000000));
+
+    rnan = shift_r<13>(ax);
+    rnan = bit_and(rnan, make_uint<uint32<N>>(0x3ff));
+    rnan = bit_or(rnan, make_uint<uint32<N>>(0x7e00));
+
+    r = blend(rd, rn, cmp_lt(ax, make_int<int32<N>>(0x38800000)));
+    r = blend(make_uint<uint32<N>>(0x7c00), r,
+              cmp_gt(ax, make_int<int32<N>>(0x477fefff)));
+    r = blend(rnan, r, cmp_gt(ax, make_int<int32<N>>(0x7f800000)));
+    return bit_or(r, sign);
+}
+
+SIMDPP_INL float16<8> i_to_float16(const float32<8>& a)
+{
+#if SIMDPP_USE_AVX512
+    __m256i r = _mm512_cvtps_ph(_mm512_castps256_ps512(a), _MM_FROUND_TO_NEAREST_INT);
+    return _mm256_castsi256_si128(r);
+#elif SIMDPP_USE_F16C && SIMDPP_USE_AVX
+    return _mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT);
+#elif SIMDPP_USE_F16C
+    __m128i r1, r2;
+    r1 = _mm_cvtps_ph(a.vec(0), _MM_FROUND_TO_NEAREST_INT);
+    r2 = _mm_cvtps_ph(a.vec(1), _MM_FROUND_TO_NEAREST_INT);
+    return _mm_unpacklo_epi64(r1, r2);
+#elif SIMDPP_USE_NEON64
+    float16x8_t r = vcvt_high_f16_f32(vcvt_f16_f32(a.vec(0)), a.vec(1));
+    return vreinterpretq_u16_f16(r);
+#else
+    uint32<8> b = i_to_float16_emul(a);
+    uint32<4> b1, b2;
+#if SIMDPP_USE_AVX2
+    split(b, b1, b2);
+#else
+    b1 = b.vec(0);
+    b2 = b.vec(1);
+#endif
+#if SIMDPP_USE_NULL
+    float16<8> r;
+    for (unsigned i = 0; i < 4; ++i) {
+        r.el(i) = uint16_t(b1.el(i));
+        r.el(i+4) = uint16_t(b2.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    return _mm_packus_epi32(b1, b2);
+#elif SIMDPP_USE_SSE2
+    // the values fit into 16 bits, thus sign-extending them avoids saturation
+    __m128i s1 = _mm_srai_epi32(_mm_slli_epi32(b1, 16), 16);
+    __m128i s2 = _mm_srai_epi32(_mm_slli_epi32(b2, 16), 16);
+    return _mm_packs_epi32(s1, s2);
+#elif SIMDPP_USE_NEON
+    return vcombine_u16(vmovn_u32(b1), vmovn_u32(b2));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_pack((__vector uint32_t)b1, (__vector uint32_t)b2);
+#endif
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float16<16> i_to_float16(const float32<16>& a)
+{
+    return _mm512_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float16<N> i_to_float16(const float32<N>& a)
+{
+    float16<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_float16(detail::vec_extract<float16<N>::base_length>(a, i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
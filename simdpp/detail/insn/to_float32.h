@@ -13,14 +13,31 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/combine.h>
-#include <simdpp/core/move_l.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/move_r.h>
+#include <simdpp/core/to_int32.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/detail/null/foreach.h>
 #include <simdpp/detail/mem_block.h>
 #include <simdpp/core/detail/vec_extract.h>
+#include <simdpp/core/detail/vec_insert.h>
 
 namespace simdpp {
 #ifndef SIMDPP_DOXYGEN
@@ -84,6 +101,79 @@ float32<N> i_to_float32(const int32<N>& a)
 
 // -----------------------------------------------------------------------------
 
+// Exact conversion using the exponent bias of the float type. The low and high
+// 16 bits of each element are placed into the mantissas of 2^23 and 2^39
+// respectively. The subtraction of the biases is exact, thus the result is
+// rounded only once, in the final addition.
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32_u32_emul(const uint32<N>& a)
+{
+    uint32<N> lo, hi;
+    lo = bit_or(bit_and(a, make_uint<uint32<N>>(0xffff)),
+                make_uint<uint32<N>>(0x4b000000)); // 2^23 + lo
+    hi = bit_or(shift_r<16>(a), make_uint<uint32<N>>(0x53000000)); // 2^39 + hi * 2^16
+    float32<N> fhi = sub(bit_cast<float32<N>>(hi),
+                         make_float<float32<N>>(549755813888.0f + 8388608.0f));
+    return add(fhi, bit_cast<float32<N>>(lo));
+}
+
+SIMDPP_INL float32x4 i_to_float32(const uint32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<float32x4>(a, [](uint32_t x) { return float(x); });
+#elif SIMDPP_USE_AVX512
+    __m512 r = _mm512_cvtepu32_ps(_mm512_castsi128_si512(a));
+    return _mm512_castps512_ps128(r);
+#elif SIMDPP_USE_SSE2
+    return i_to_float32_u32_emul(a);
+#elif SIMDPP_USE_NEON && !SIMDPP_USE_NEON_FLT_SP
+    detail::mem_block<uint32x4> mi(a);
+    detail::mem_block<float32x4> mf;
+    mf[0] = float(mi[0]);
+    mf[1] = float(mi[1]);
+    mf[2] = float(mi[2]);
+    mf[3] = float(mi[3]);
+    return mf;
+#elif SIMDPP_USE_NEON_FLT_SP
+    return vcvtq_f32_u32(a);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_ctf((__vector uint32_t)a, 0);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float32x8 i_to_float32(const uint32x8& a)
+{
+#if SIMDPP_USE_AVX512
+    __m512 r = _mm512_cvtepu32_ps(_mm512_castsi256_si512(a));
+    return _mm512_castps512_ps256(r);
+#elif SIMDPP_USE_AVX2
+    return i_to_float32_u32_emul(a);
+#else
+    return combine(i_to_float32(a.vec(0)), i_to_float32(a.vec(1)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_to_float32(const uint32<16>& a)
+{
+    return _mm512_cvtepu32_ps(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32(const uint32<N>& a)
+{
+    float32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_float32(detail::vec_extract<float32<N>::base_length>(a, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
 SIMDPP_INL float32x4 i_to_float32(const float64x4& a)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
@@ -99,7 +189,7 @@ SIMDPP_INL float32x4 i_to_float32(const float64x4& a)
     float32x4 r1, r2;
     r1 = _mm_cvtpd_ps(a.vec(0));
     r2 = _mm_cvtpd_ps(a.vec(1));
-    r2 = move4_l<2>(r2);
+    r2 = move4_r<2>(r2);
     return bit_or(r1, r2);
 #elif SIMDPP_USE_NEON64
     float32<4> r;
@@ -143,6 +233,121 @@ float32<N> i_to_float32(const float64<N>& a)
     return r;
 }
 
+// -----------------------------------------------------------------------------
+
+// Exact conversion of binary16 values stored in the low 16 bits of each
+// element. Normal values are converted by adjusting the exponent bias,
+// infinities and NaNs by setting the exponent to all ones. The quiet bit of
+// NaNs is set. Denormals are converted from their integer mantissa and then
+// scaled by 2^-24, which is exact.
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32_f16_emul(const uint32<N>& a)
+{
+    uint32<N> sign = bit_and(a, make_uint<uint32<N>>(0x8000));
+    sign = shift_l<16>(sign);
+    int32<N> em = bit_and(a, make_uint<uint32<N>>(0x7fff));
+
+    uint32<N> r, rinf, rd;
+    r = shift_l<13>(em);
+    r = add(r, make_uint<uint32<N>>(0x38000000));
+    rinf = add(r, make_uint<uint32<N>>(0x38000000));
+    r = blend(rinf, r, cmp_gt(em, make_int<int32<N>>(0x7bff)));
+    r = bit_or(r, bit_and(make_uint<uint32<N>>(0x00400000),
+                          cmp_gt(em, make_int<int32<N>>(0x7c00))));
+
+    float32<N> fd = i_to_float32(em);
+    fd = mul(fd, make_float<float32<N>>(5.9604644775390625e-8f)); // 2^-24
+    rd = bit_cast<uint32<N>>(fd);
+    r = blend(rd, r, cmp_lt(em, make_int<int32<N>>(0x0400)));
+    r = bit_or(r, sign);
+    return bit_cast<float32<N>>(r);
+}
+
+SIMDPP_INL float32<8> i_to_float32(const float16<8>& a)
+{
+#if SIMDPP_USE_AVX512
+    __m512 r = _mm512_cvtph_ps(_mm256_castsi128_si256(a));
+    return _mm512_castps512_ps256(r);
+#elif SIMDPP_USE_F16C && SIMDPP_USE_AVX
+    return _mm256_cvtph_ps(a);
+#elif SIMDPP_USE_F16C
+    float32<8> r;
+    r.vec(0) = _mm_cvtph_ps(a);
+    r.vec(1) = _mm_cvtph_ps(_mm_unpackhi_epi64(a, a));
+    return r;
+#elif SIMDPP_USE_NEON64
+    float16x8_t h = vreinterpretq_f16_u16(a);
+    float32<8> r;
+    r.vec(0) = vcvt_f32_f16(vget_low_f16(h));
+    r.vec(1) = vcvt_high_f32_f16(h);
+    return r;
+#else
+    return i_to_float32_f16_emul(to_int32(uint16<8>(a)));
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_to_float32(const float16<16>& a)
+{
+    return _mm512_cvtph_ps(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32(const float16<N>& a)
+{
+    float32<N> r;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        detail::vec_insert(r, i_to_float32(a.vec(i)), i);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+// bfloat16 values are the high halves of binary32 values, thus the conversion
+// is a zero extension followed by a shift.
+SIMDPP_INL float32<8> i_to_float32(const bfloat16<8>& a)
+{
+#if SIMDPP_USE_AVX2
+    __m256i r = _mm256_slli_epi32(_mm256_cvtepu16_epi32(a), 16);
+    return _mm256_castsi256_ps(r);
+#elif SIMDPP_USE_SSE2
+    __m128i z = _mm_setzero_si128();
+    float32<4> r1, r2;
+    r1 = _mm_castsi128_ps(_mm_unpacklo_epi16(z, a));
+    r2 = _mm_castsi128_ps(_mm_unpackhi_epi16(z, a));
+    return combine(r1, r2);
+#elif SIMDPP_USE_NEON
+    float32<4> r1, r2;
+    r1 = vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(a), 16));
+    r2 = vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(a), 16));
+    return combine(r1, r2);
+#else
+    uint32<8> r = to_int32(uint16<8>(a));
+    r = shift_l<16>(r);
+    return bit_cast<float32<8>>(r);
+#endif
+}
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float32<16> i_to_float32(const bfloat16<16>& a)
+{
+    __m512i r = _mm512_slli_epi32(_mm512_cvtepu16_epi32(a), 16);
+    return _mm512_castsi512_ps(r);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32(const bfloat16<N>& a)
+{
+    float32<N> r;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        detail::vec_insert(r, i_to_float32(a.vec(i)), i);
+    }
+    return r;
+}
+
 } // namespace insn
 } // namespace detail
 #ifndef SIMDPP_DOXYGEN
@@ -13,10 +13,21 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cast.h>
 #include <simdpp/core/combine.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
 #include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/foreach.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/sse/extract_half.h>
+#include <simdpp/core/detail/vec_extract.h>
 #include <simdpp/core/detail/vec_insert.h>
 
 namespace simdpp {
@@ -42,7 +53,7 @@ SIMDPP_INL float64x4 i_to_float64(const int32x4& a)
 #elif SIMDPP_USE_SSE2
     float64x2 r1, r2;
     r1 = _mm_cvtepi32_pd(a);
-    r2 = _mm_cvtepi32_pd(move4_r<2>(a).eval());
+    r2 = _mm_cvtepi32_pd(move4_l<2>(a).eval());
     return combine(r1, r2);
 #elif SIMDPP_USE_NEON64
     float64<2> r1, r2;
@@ -107,7 +118,7 @@ SIMDPP_INL float64x4 i_to_float64(const float32x4& a)
 #elif SIMDPP_USE_SSE2
     float64x2 r1, r2;
     r1 = _mm_cvtps_pd(a);
-    r2 = _mm_cvtps_pd(move4_r<2>(a).eval());
+    r2 = _mm_cvtps_pd(move4_l<2>(a).eval());
     return combine(r1, r2);
 #elif SIMDPP_USE_NEON64
     float64<2> r1, r2;
@@ -155,6 +166,152 @@ float64<N> i_to_float64(const float32<N>& a)
     return r;
 }
 
+// -----------------------------------------------------------------------------
+
+// Exact conversion using the exponent bias of the float type. The low and high
+// 32 bits of each element are placed into the mantissas of 2^52 and 2^84
+// respectively. The subtraction of the biases is exact, thus the result is
+// rounded only once, in the final addition. For signed values the sign bit is
+// flipped, which adds 2^63; that offset is included in the subtracted bias.
+template<unsigned N> SIMDPP_INL
+float64<N> i_to_float64_64_emul(const uint64<N>& a, uint64_t hi_bits,
+                                uint64_t bias_bits)
+{
+    uint64<N> lo, hi;
+    lo = bit_or(bit_and(a, make_uint<uint64<N>>(0xffffffff)),
+                make_uint<uint64<N>>(0x4330000000000000)); // 2^52 + lo
+    hi = bit_xor(shift_r<32>(a), make_uint<uint64<N>>(hi_bits));
+    float64<N> fhi = sub(bit_cast<float64<N>>(hi),
+                         bit_cast<float64<N>>(make_uint<uint64<N>>(bias_bits)));
+    return add(fhi, bit_cast<float64<N>>(lo));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_to_float64_u64_emul(const uint64<N>& a)
+{
+    // hi: 2^84 + hi * 2^32, bias: 2^84 + 2^52
+    return i_to_float64_64_emul(a, 0x4530000000000000, 0x4530000000100000);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_to_float64_i64_emul(const uint64<N>& a)
+{
+    // hi: 2^84 + (hi ^ 0x80000000) * 2^32, bias: 2^84 + 2^63 + 2^52
+    return i_to_float64_64_emul(a, 0x4530000080000000, 0x4530000080100000);
+}
+
+SIMDPP_INL float64x2 i_to_float64(const int64x2& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<float64x2>(a, [](int64_t x) { return double(x); });
+#elif SIMDPP_USE_AVX512DQ
+    __m512d r = _mm512_cvtepi64_pd(_mm512_castsi128_si512(a));
+    return _mm512_castpd512_pd128(r);
+#elif SIMDPP_USE_SSE2
+    return i_to_float64_i64_emul(uint64x2(a));
+#elif SIMDPP_USE_NEON64
+    return vcvtq_f64_s64(a);
+#elif SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    detail::mem_block<int64x2> ax(a);
+    float64x2 r;
+    r.el(0) = double(ax[0]);
+    r.el(1) = double(ax[1]);
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float64x4 i_to_float64(const int64x4& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    __m512d r = _mm512_cvtepi64_pd(_mm512_castsi256_si512(a));
+    return _mm512_castpd512_pd256(r);
+#elif SIMDPP_USE_AVX2
+    return i_to_float64_i64_emul(uint64x4(a));
+#else
+    return combine(i_to_float64(a.vec(0)), i_to_float64(a.vec(1)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_to_float64(const int64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvtepi64_pd(a);
+#else
+    return i_to_float64_i64_emul(uint64<8>(a));
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_to_float64(const int64<N>& a)
+{
+    float64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_float64(detail::vec_extract<float64<N>::base_length>(a, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL float64x2 i_to_float64(const uint64x2& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<float64x2>(a, [](uint64_t x) { return double(x); });
+#elif SIMDPP_USE_AVX512DQ
+    __m512d r = _mm512_cvtepu64_pd(_mm512_castsi128_si512(a));
+    return _mm512_castpd512_pd128(r);
+#elif SIMDPP_USE_SSE2
+    return i_to_float64_u64_emul(a);
+#elif SIMDPP_USE_NEON64
+    return vcvtq_f64_u64(a);
+#elif SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    detail::mem_block<uint64x2> ax(a);
+    float64x2 r;
+    r.el(0) = double(ax[0]);
+    r.el(1) = double(ax[1]);
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL float64x4 i_to_float64(const uint64x4& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    __m512d r = _mm512_cvtepu64_pd(_mm512_castsi256_si512(a));
+    return _mm512_castpd512_pd256(r);
+#elif SIMDPP_USE_AVX2
+    return i_to_float64_u64_emul(a);
+#else
+    return combine(i_to_float64(a.vec(0)), i_to_float64(a.vec(1)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL float64<8> i_to_float64(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvtepu64_pd(a);
+#else
+    return i_to_float64_u64_emul(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_to_float64(const uint64<N>& a)
+{
+    float64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_float64(detail::vec_extract<float64<N>::base_length>(a, i));
+    }
+    return r;
+}
+
 
 } // namespace insn
 } // namespace detail
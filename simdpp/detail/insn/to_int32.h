@@ -12,13 +12,23 @@
     #error "This file must be included through simd.h"
 #endif
 
+#include <cmath>
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_ge.h>
 #include <simdpp/core/combine.h>
+#include <simdpp/core/f_nearbyint.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/detail/not_implemented.h>
 #include <simdpp/core/i_shift_r.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
+#include <simdpp/core/detail/vec_extract.h>
 #include <simdpp/detail/null/foreach.h>
 #include <simdpp/core/detail/vec_insert.h>
 
@@ -79,6 +89,18 @@ SIMDPP_INL int32<16> i_to_int32(const int16<16>& a)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int32<32> i_to_int32(const int16<32>& a)
+{
+    int32<16> r0, r1;
+    int16<16> a0, a1;
+    split(a, a0, a1);
+    r0 = _mm512_cvtepi16_epi32(a0);
+    r1 = _mm512_cvtepi16_epi32(a1);
+    return combine(r0, r1);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 int32<N> i_to_int32(const int16<N>& a)
 {
@@ -146,6 +168,75 @@ int32<N> i_to_int32(const float32<N>& a)
 
 // -----------------------------------------------------------------------------
 
+// Values not less than 2^31 are brought into the signed range by subtracting
+// 2^31 before the conversion. The top bit is restored afterwards.
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_uint32_emul(const float32<N>& a)
+{
+    float32<N> bias = make_float<float32<N>>(2147483648.0f);
+    mask_float32<N> big = cmp_ge(a, bias);
+    float32<N> a2 = sub(a, bit_and(bias, big));
+    uint32<N> r = i_to_int32(a2);
+    uint32<N> top = bit_and(bit_cast<uint32<N>>(big.unmask()),
+                            make_uint<uint32<N>>(0x80000000));
+    return bit_xor(r, top);
+}
+
+SIMDPP_INL uint32x4 i_to_uint32(const float32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<uint32x4>(a, [](float x) { return uint32_t(x); });
+#elif SIMDPP_USE_AVX512
+    __m512i r = _mm512_cvttps_epu32(_mm512_castps128_ps512(a));
+    return _mm512_castsi512_si128(r);
+#elif SIMDPP_USE_SSE2
+    return i_to_uint32_emul(a);
+#elif SIMDPP_USE_NEON && !SIMDPP_USE_NEON_FLT_SP
+    detail::mem_block<float32x4> mf(a);
+    detail::mem_block<uint32x4> mi;
+    mi[0] = uint32_t(mf[0]);
+    mi[1] = uint32_t(mf[1]);
+    mi[2] = uint32_t(mf[2]);
+    mi[3] = uint32_t(mf[3]);
+    return mi;
+#elif SIMDPP_USE_NEON_FLT_SP
+    return vcvtq_u32_f32(a);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_ctu((__vector float)a, 0);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL uint32x8 i_to_uint32(const float32x8& a)
+{
+#if SIMDPP_USE_AVX512
+    __m512i r = _mm512_cvttps_epu32(_mm512_castps256_ps512(a));
+    return _mm512_castsi512_si256(r);
+#else
+    return i_to_uint32_emul(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL uint32<16> i_to_uint32(const float32<16>& a)
+{
+    return _mm512_cvttps_epu32(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_uint32(const float32<N>& a)
+{
+    uint32<N> r;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        detail::vec_insert(r, i_to_uint32(a.vec(i)), i);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
 SIMDPP_INL int32x4 i_to_int32(const float64x4& a)
 {
 #if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
@@ -178,6 +269,126 @@ SIMDPP_INL int32x4 i_to_int32(const float64x4& a)
 #if SIMDPP_USE_AVX
 SIMDPP_INL int32<8> i_to_int32(const float64<8>& a)
 {
+#if SIMDPP_USE_AVX512
+    return _mm512_cvttpd_epi32(a);
+#else
+    int32<4> r1, r2;
+    r1 = _mm256_cvttpd_epi32(a.vec(0));
+    r2 = _mm256_cvttpd_epi32(a.vec(1));
+    return combine(r1, r2);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int32<16> i_to_int32(const float64<16>& a)
+{
+    int32<8> r0, r1;
+    r0 = _mm512_cvttpd_epi32(a.vec(0));
+    r1 = _mm512_cvttpd_epi32(a.vec(1));
+    return combine(r0, r1);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32(const float64<N>& a)
+{
+    int32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_to_int32(detail::vec_extract<int32<N>::base_length>(a, i));
+    }
+    return r;
+}
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int32x4 i_to_int32_round(const float32x4& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<int32x4>(a, [](float x) { return int32_t(std::nearbyint(x)); });
+#elif SIMDPP_USE_SSE2
+    return _mm_cvtps_epi32(a);
+#elif SIMDPP_USE_NEON && !SIMDPP_USE_NEON_FLT_SP
+    detail::mem_block<float32x4> mf(a);
+    detail::mem_block<int32x4> mi;
+    mi[0] = int(std::nearbyint(mf[0]));
+    mi[1] = int(std::nearbyint(mf[1]));
+    mi[2] = int(std::nearbyint(mf[2]));
+    mi[3] = int(std::nearbyint(mf[3]));
+    return mi;
+#elif SIMDPP_USE_NEON64
+    return vcvtnq_s32_f32(a);
+#elif SIMDPP_USE_NEON_FLT_SP
+    return vcvtq_s32_f32(i_nearbyint(a));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_cts(vec_round((__vector float)a), 0);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL int32x8 i_to_int32_round(const float32x8& a)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_cvtps_epi32(a);
+#else
+    __m256i r = _mm256_cvtps_epi32(a);
+    uint32<4> r1, r2;
+    r1 = _mm256_castsi256_si128(r);
+    r2 = _mm256_extractf128_si256(r, 1);
+    return combine(r1, r2);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int32<16> i_to_int32_round(const float32<16>& a)
+{
+    return _mm512_cvtps_epi32(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_round(const float32<N>& a)
+{
+    int32<N> r;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        detail::vec_insert(r, i_to_int32_round(a.vec(i)), i);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int32x4 i_to_int32_round(const float64x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    detail::mem_block<int32x4> r;
+    r[0] = int32_t(std::nearbyint(a.vec(0).el(0)));
+    r[1] = int32_t(std::nearbyint(a.vec(0).el(1)));
+    r[2] = int32_t(std::nearbyint(a.vec(1).el(0)));
+    r[3] = int32_t(std::nearbyint(a.vec(1).el(1)));
+    return r;
+#elif SIMDPP_USE_AVX
+    return _mm256_cvtpd_epi32(a);
+#elif SIMDPP_USE_SSE2
+    int32x4 r, r1, r2;
+    float64x2 a1, a2;
+    split(a, a1, a2);
+    r1 = _mm_cvtpd_epi32(a1);
+    r2 = _mm_cvtpd_epi32(a2);
+    r = zip2_lo(int64<2>(r1), int64<2>(r2));
+    return r;
+#elif SIMDPP_USE_NEON64
+    int64<2> r1, r2;
+    r1 = vcvtnq_s64_f64(a.vec(0));
+    r2 = vcvtnq_s64_f64(a.vec(1));
+    int32<4> r = vcombine_s32(vqmovn_s64(r1), vqmovn_s64(r2));
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL int32<8> i_to_int32_round(const float64<8>& a)
+{
 #if SIMDPP_USE_AVX512
     return _mm512_cvtpd_epi32(a);
 #else
@@ -190,7 +401,7 @@ SIMDPP_INL int32<8> i_to_int32(const float64<8>& a)
 #endif
 
 #if SIMDPP_USE_AVX512
-SIMDPP_INL int32<16> i_to_int32(const float64<16>& a)
+SIMDPP_INL int32<16> i_to_int32_round(const float64<16>& a)
 {
     int32<8> r0, r1;
     r0 = _mm512_cvtpd_epi32(a.vec(0));
@@ -200,15 +411,16 @@ SIMDPP_INL int32<16> i_to_int32(const float64<16>& a)
 #endif
 
 template<unsigned N> SIMDPP_INL
-int32<N> i_to_int32(const float64<N>& a)
+int32<N> i_to_int32_round(const float64<N>& a)
 {
     int32<N> r;
     for (unsigned i = 0; i < r.vec_length; ++i) {
-        r.vec(i) = i_to_int32(detail::vec_extract<int32<N>::base_length>(a, i));
+        r.vec(i) = i_to_int32_round(detail::vec_extract<int32<N>::base_length>(a, i));
     }
     return r;
 }
 
+
 } // namespace insn
 } // namespace detail
 #ifndef SIMDPP_DOXYGEN
@@ -13,10 +13,20 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/i_shift_l.h>
 #include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/core/move_l.h>
+#include <simdpp/core/split.h>
 #include <simdpp/core/zip_lo.h>
 #include <simdpp/core/combine.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/foreach.h>
 
 namespace simdpp {
 #ifndef SIMDPP_DOXYGEN
@@ -39,7 +49,7 @@ SIMDPP_INL int64x4 i_to_int64(const int32x4& a)
 #elif SIMDPP_USE_SSE4_1
     uint64x2 r1, r2;
     r1 = _mm_cvtepi32_epi64(a);
-    r2 = _mm_cvtepi32_epi64(move4_r<2>(a).eval());
+    r2 = _mm_cvtepi32_epi64(move4_l<2>(a).eval());
     return combine(r1, r2);
 #elif SIMDPP_USE_SSE2 || SIMDPP_USE_ALTIVEC
     int32x4 u;
@@ -103,7 +113,7 @@ SIMDPP_INL uint64x4 i_to_uint64(const uint32x4& a)
 #elif SIMDPP_USE_SSE4_1
     uint64x2 r1, r2;
     r1 = _mm_cvtepu32_epi64(a);
-    r2 = _mm_cvtepu32_epi64(move4_r<2>(a).eval());
+    r2 = _mm_cvtepu32_epi64(move4_l<2>(a).eval());
     return combine(r1, r2);
 #elif SIMDPP_USE_SSE2 || SIMDPP_USE_ALTIVEC
     return (uint64x4) combine(zip4_lo(a, uint32x4::zero()),
@@ -150,6 +160,82 @@ uint64<N> i_to_uint64(const uint32<N>& a)
     return r;
 }
 
+// -----------------------------------------------------------------------------
+
+// The integer is reconstructed from the bits of the float: the mantissa with
+// the implicit bit moved to bit 63 is shifted right by 63 minus the unbiased
+// exponent. Values with magnitude less than 1 result in shift counts above 63
+// which produce zero on all instruction sets that use this function.
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_emul(const float64<N>& a)
+{
+    uint64<N> bits = bit_cast<uint64<N>>(a);
+    uint64<N> mant, exp, count, mag;
+    int64<N> sign;
+    mant = bit_or(shift_l<11>(bits), make_uint<uint64<N>>(0x8000000000000000));
+    exp = bit_and(shift_r<52>(bits), make_uint<uint64<N>>(0x7ff));
+    count = sub(make_uint<uint64<N>>(1023 + 63), exp);
+    mag = i_shift_r(mant, count);
+    sign = shift_r<63>(int64<N>(bits));
+    return sub(bit_xor(int64<N>(mag), sign), sign);
+}
+
+SIMDPP_INL int64x2 i_to_int64(const float64x2& a)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::foreach<int64x2>(a, [](double x) { return int64_t(x); });
+#elif SIMDPP_USE_AVX512DQ
+    __m512i r = _mm512_cvttpd_epi64(_mm512_castpd128_pd512(a));
+    return _mm512_castsi512_si128(r);
+#elif SIMDPP_USE_SSE2
+    return i_to_int64_emul(a);
+#elif SIMDPP_USE_NEON64
+    return vcvtq_s64_f64(a);
+#elif SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    detail::mem_block<int64x2> r;
+    r[0] = int64_t(a.el(0));
+    r[1] = int64_t(a.el(1));
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+SIMDPP_INL int64x4 i_to_int64(const float64x4& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    __m512i r = _mm512_cvttpd_epi64(_mm512_castpd256_pd512(a));
+    return _mm512_castsi512_si256(r);
+#elif SIMDPP_USE_AVX2
+    return i_to_int64_emul(a);
+#else
+    float64x2 a1, a2;
+    split(a, a1, a2);
+    return combine(i_to_int64(a1), i_to_int64(a2));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512
+SIMDPP_INL int64<8> i_to_int64(const float64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvttpd_epi64(a);
+#else
+    return i_to_int64_emul(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64(const float64<N>& a)
+{
+    int64<N> r;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        detail::vec_insert(r, i_to_int64(a.vec(i)), i);
+    }
+    return r;
+}
+
 
 } // namespace insn
 } // namespace detail
@@ -104,6 +104,15 @@ SIMDPP_INL uint8x32 transpose_inplace(const uint8x32& a)
     return SIMDPP_NOT_IMPLEMENTED1(a);
 #endif
 }
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> transpose_inplace(const uint8<64>& a)
+{
+    uint8<64> idx = make_uint(0, 4, 8, 12, 1, 5, 9, 13,
+                              2, 6, 10,14, 3, 7, 11,15);
+    return permute_bytes16(a, idx);
+}
+#endif
 /// @}
 
 
@@ -142,6 +151,17 @@ SIMDPP_INL void i_transpose2(uint16x16& a0, uint16x16& a1)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_transpose2(uint16<32>& a0, uint16<32>& a1)
+{
+    uint32<16> b0, b1;
+    b0 = zip8_lo(a0, a1);
+    b1 = zip8_hi(a0, a1);
+    a0 = shuffle2<0,2,0,2>(b0, b1);
+    a1 = shuffle2<1,3,1,3>(b0, b1);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_transpose2(uint16<N>& a0, uint16<N>& a1)
 {
@@ -359,6 +379,10 @@ SIMDPP_INL void i_transpose4(uint32x4& a0, uint32x4& a1,
 SIMDPP_INL void i_transpose4(uint32x8& a0, uint32x8& a1,
                              uint32x8& a2, uint32x8& a3);
 #endif
+#if SIMDPP_USE_AVX512
+SIMDPP_INL void i_transpose4(uint32<16>& a0, uint32<16>& a1,
+                             uint32<16>& a2, uint32<16>& a3);
+#endif
 
 SIMDPP_INL void i_transpose4(uint8x16& a0, uint8x16& a1,
                              uint8x16& a2, uint8x16& a3)
@@ -427,6 +451,28 @@ SIMDPP_INL void i_transpose4(uint8x32& a0, uint8x32& a1,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_transpose4(uint8<64>& a0, uint8<64>& a1,
+                             uint8<64>& a2, uint8<64>& a3)
+{
+    uint16<32> b0, b1, b2, b3;
+    b0 = zip16_lo(a0, a1);
+    b1 = zip16_lo(a2, a3);
+    b2 = zip16_hi(a0, a1);
+    b3 = zip16_hi(a2, a3);
+    uint32<16> c0, c1, c2, c3;
+    c0 = zip8_lo(b0, b1);
+    c1 = zip8_hi(b0, b1);
+    c2 = zip8_lo(b2, b3);
+    c3 = zip8_hi(b2, b3);
+    i_transpose4(c0, c1, c2, c3);
+    a0 = c0;
+    a1 = c1;
+    a2 = c2;
+    a3 = c3;
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_transpose4(uint8<N>& a0, uint8<N>& a1, uint8<N>& a2, uint8<N>& a3)
 {
@@ -501,6 +547,29 @@ SIMDPP_INL void i_transpose4(uint16x16& a0, uint16x16& a1,
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_transpose4(uint16<32>& a0, uint16<32>& a1,
+                             uint16<32>& a2, uint16<32>& a3)
+{
+    uint32<16> b0, b1, b2, b3;
+    uint64<8> c0, c1, c2, c3;
+    b0 = zip8_lo(a0, a1);
+    b1 = zip8_hi(a0, a1);
+    b2 = zip8_lo(a2, a3);
+    b3 = zip8_hi(a2, a3);
+
+    c0 = zip4_lo(b0, b2);
+    c1 = zip4_hi(b0, b2);
+    c2 = zip4_lo(b1, b3);
+    c3 = zip4_hi(b1, b3);
+
+    a0 = zip2_lo(c0, c2);
+    a1 = zip2_hi(c0, c2);
+    a2 = zip2_lo(c1, c3);
+    a3 = zip2_hi(c1, c3);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 void i_transpose4(uint16<N>& a0, uint16<N>& a1, uint16<N>& a2, uint16<N>& a3)
 {
@@ -62,6 +62,20 @@ SIMDPP_INL uint8x32 i_unzip16_lo(const uint8x32& ca, const uint8x32& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_unzip16_lo(const uint8<64>& ca, const uint8<64>& cb)
+{
+    uint8<64> a = ca, b = cb;
+    uint16<32> mask, r;
+    mask = uint16<32>::ones();
+    mask = _mm512_srli_epi16(mask, 8);
+    a = bit_and(a, mask);
+    b = bit_and(b, mask);
+    r = _mm512_packus_epi16(a, b);
+    return uint8<64>(r);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint8<N> i_unzip16_lo(const uint8<N>& a, const uint8<N>& b)
 {
@@ -113,6 +127,20 @@ SIMDPP_INL uint16x16 i_unzip8_lo(const uint16x16& ca, const uint16x16& cb)
 }
 #endif
 
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_unzip8_lo(const uint16<32>& ca, const uint16<32>& cb)
+{
+    uint16<32> a = ca, b = cb;
+    uint32<16> mask, r;
+    mask = uint32<16>::ones();
+    mask = _mm512_srli_epi32(mask, 16);
+    a = bit_and(a, mask);
+    b = bit_and(b, mask);
+    r = _mm512_packus_epi32(a, b);
+    return uint16<32>(r);
+}
+#endif
+
 template<unsigned N> SIMDPP_INL
 uint16<N> i_unzip8_lo(const uint16<N>& a, const uint16<N>& b)
 {
@@ -0,0 +1,207 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_APPROX_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_APPROX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+template<unsigned Degree> struct approx_degree {};
+
+/*  Minimax approximations of 2^f for |f| <= 0.5. The maximum relative error
+    of i_approx_exp2, including the rounding during the evaluation, is 3.0e-2,
+    1.8e-3, 7.5e-5, 2.8e-6 and 2.4e-7 for degrees 1 to 5.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2_poly(const float32<N>& f, approx_degree<1>)
+{
+    static const float c[] = { 1.02903008f, 0.686020017f };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2_poly(const float32<N>& f, approx_degree<2>)
+{
+    static const float c[] = { 1.00044310f, 0.703447998f, 0.238428935f };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2_poly(const float32<N>& f, approx_degree<3>)
+{
+    static const float c[] = {
+        0.999928057f, 0.693260968f, 0.242611125f, 0.0551716685f
+    };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2_poly(const float32<N>& f, approx_degree<4>)
+{
+    static const float c[] = {
+        0.999999285f, 0.693121791f, 0.240247443f, 0.0559178591f,
+        0.00957010221f
+    };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2_poly(const float32<N>& f, approx_degree<5>)
+{
+    static const float c[] = {
+        1.00000012f, 0.693146944f, 0.240221202f, 0.0555071309f,
+        0.00967554096f, 0.00132764725f
+    };
+    return i_poly(f, c);
+}
+
+/*  Minimax approximations of log2(1 + f) / f for
+    sqrt(1/2) - 1 <= f < sqrt(2) - 1. The degree refers to the resulting
+    approximation f * P(f) of log2(1 + f). The maximum relative error of
+    i_approx_log2 for arguments between 0.5 and 2 is 1.7e-1, 2.0e-2, 2.6e-3,
+    3.5e-4 and 5.0e-5 for degrees 1 to 5.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_log2_poly(const float32<N>&, approx_degree<1>)
+{
+    return i_splat<float32<N>>(1.41421354f);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_log2_poly(const float32<N>& f, approx_degree<2>)
+{
+    static const float c[] = { 1.47030389f, -0.693107963f };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_log2_poly(const float32<N>& f, approx_degree<3>)
+{
+    static const float c[] = { 1.44417703f, -0.751134813f, 0.449609727f };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_log2_poly(const float32<N>& f, approx_degree<4>)
+{
+    static const float c[] = {
+        1.44227040f, -0.724296927f, 0.511272788f, -0.327770799f
+    };
+    return i_poly(f, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_approx_log2_poly(const float32<N>& f, approx_degree<5>)
+{
+    static const float c[] = {
+        1.44264627f, -0.720554948f, 0.485306531f, -0.390892476f,
+        0.254751891f
+    };
+    return i_poly(f, c);
+}
+
+/*  2^x = 2^n * 2^f where n is the nearest integer and |f| <= 0.5. 2^f is
+    approximated by a polynomial and n is added directly to its exponent bits.
+    The argument is clamped so that the result stays within the range of
+    normal numbers. NaN is passed through.
+*/
+template<unsigned Degree, unsigned N> SIMDPP_INL
+float32<N> i_approx_exp2(const float32<N>& x)
+{
+    float32<N> a = min(max(x, i_splat<float32<N>>(-126.0f)),
+                       i_splat<float32<N>>(127.0f));
+    uint32<N> n;
+    float32<N> f = sub(a, i_round_int(a, n));
+    float32<N> p = i_approx_exp2_poly(f, approx_degree<Degree>());
+
+    // the low-order bits of n contain the integer in two's complement
+    uint32<N> bits = add(bit_cast<uint32<N>>(p), shift_l<23>(n));
+
+    // the clamp above turns NaN into a finite value
+    return blend(float32<N>(bit_cast<float32<N>>(bits)), x, cmp_eq(x, x));
+}
+
+/*  x = 2^e * (1 + f) where sqrt(1/2) <= 1 + f < sqrt(2). e is extracted from
+    the exponent bits and log2(1 + f) is approximated by f * P(f). The
+    argument must be positive, finite and normal.
+*/
+template<unsigned Degree, unsigned N> SIMDPP_INL
+float32<N> i_approx_log2(const float32<N>& x)
+{
+    using T = math_traits<float32<N>>;
+
+    uint32<N> ix = bit_cast<uint32<N>>(x);
+    ix = add(ix, i_splat_bits<float32<N>>(T::one_bits - T::sqrt_half_bits));
+
+    // converts the biased exponent to float using the 2^23 magic number
+    uint32<N> ex = shift_r<23>(ix);
+    ex = bit_or(ex, i_splat_bits<float32<N>>(T::int_magic_bits));
+    float32<N> e = sub(bit_cast<float32<N>>(ex),
+                       i_splat<float32<N>>(T::int_magic + T::exp_bias));
+
+    uint32<N> mx = bit_and(ix, i_splat_bits<float32<N>>(T::mant_mask));
+    mx = add(mx, i_splat_bits<float32<N>>(T::sqrt_half_bits));
+    float32<N> f = sub(bit_cast<float32<N>>(mx), i_splat<float32<N>>(1.0f));
+
+    float32<N> p = i_approx_log2_poly(f, approx_degree<Degree>());
+    return i_fmadd(f, p, e);
+}
+
+template<unsigned Degree, unsigned N> SIMDPP_INL
+float32<N> i_approx_exp(const float32<N>& x)
+{
+    using T = math_traits<float32<N>>;
+    return i_approx_exp2<Degree>(float32<N>(mul(x, i_splat<float32<N>>(T::log2e))));
+}
+
+// 1 / (1 + exp(-x))
+template<unsigned Degree, unsigned N> SIMDPP_INL
+float32<N> i_approx_sigmoid(const float32<N>& x)
+{
+    using T = math_traits<float32<N>>;
+    float32<N> e = i_approx_exp2<Degree>(float32<N>(mul(x, i_splat<float32<N>>(-T::log2e))));
+    float32<N> one = i_splat<float32<N>>(1.0f);
+    return div(one, add(one, e));
+}
+
+/*  tanh(x) = (e - 1) / (e + 1) where e = exp(2*x). The subtraction loses
+    relative accuracy for small |x|, thus the Taylor series is used there.
+*/
+template<unsigned Degree, unsigned N> SIMDPP_INL
+float32<N> i_approx_tanh(const float32<N>& x)
+{
+    using T = math_traits<float32<N>>;
+    float32<N> one = i_splat<float32<N>>(1.0f);
+    float32<N> e = i_approx_exp2<Degree>(float32<N>(mul(x, i_splat<float32<N>>(2 * T::log2e))));
+    float32<N> large = div(sub(e, one), add(e, one));
+
+    static const float c[] = { -1.0f / 3, 2.0f / 15 };
+    float32<N> x2 = mul(x, x);
+    float32<N> small = i_fmadd(float32<N>(mul(x, x2)), i_poly(x2, c), x);
+    return blend(small, large, cmp_lt(abs(x), i_splat<float32<N>>(0.25f)));
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
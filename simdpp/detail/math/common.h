@@ -0,0 +1,242 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_COMMON_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_fmsub.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <limits>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Constants that depend only on the floating-point format. The values that
+    are split into a high and a low part are chosen so that the product of the
+    high part and a small integer is exact.
+*/
+template<class T> struct math_consts;
+
+template<> struct math_consts<float> {
+    static constexpr unsigned mant_bits = 23;
+    static constexpr uint32_t exp_bias = 127;
+    static constexpr uint32_t mant_mask = 0x007fffff;
+    static constexpr uint32_t sign_mask = 0x80000000;
+    static constexpr uint32_t one_bits = 0x3f800000;
+    static constexpr uint32_t sqrt_half_bits = 0x3f3504f3;
+    static constexpr uint32_t int_magic_bits = 0x4b000000; // 2^23
+    static constexpr uint32_t log2_hi_mask = 0xfffff000;
+
+    static constexpr float int_magic = 8388608.0f;      // 2^23
+    static constexpr float round_magic = 12582912.0f;   // 1.5 * 2^23
+    static constexpr float min_normal = 1.17549435e-38f;
+    static constexpr float denorm_scale = 8388608.0f;   // 2^23
+
+    static constexpr float ln2_hi = 0.693145752f;
+    static constexpr float ln2_lo = 1.42860677e-06f;
+    static constexpr float log2e = 1.44269502f;
+    static constexpr float ivln2_hi = 1.44287109f;
+    static constexpr float ivln2_lo = -0.000176052854f;
+    static constexpr float two_over_pi = 0.636619747f;
+    static constexpr float pio2_1 = 1.57080078f;
+    static constexpr float pio2_2 = -4.45358455e-06f;
+    static constexpr float pio2_3 = -8.70551575e-10f;
+
+    static constexpr float exp_min = -104.0f;
+    static constexpr float exp_max = 89.0f;
+    static constexpr float exp2_min = -151.0f;
+    static constexpr float exp2_max = 129.0f;
+    static constexpr float tanh_small = 0.625f;
+    static constexpr float split = 4097.0f;             // 2^12 + 1
+};
+
+template<> struct math_consts<double> {
+    static constexpr unsigned mant_bits = 52;
+    static constexpr uint64_t exp_bias = 1023;
+    static constexpr uint64_t mant_mask = 0x000fffffffffffff;
+    static constexpr uint64_t sign_mask = 0x8000000000000000;
+    static constexpr uint64_t one_bits = 0x3ff0000000000000;
+    static constexpr uint64_t sqrt_half_bits = 0x3fe6a09e667f3bcd;
+    static constexpr uint64_t int_magic_bits = 0x4330000000000000; // 2^52
+    static constexpr uint64_t log2_hi_mask = 0xffffffff00000000;
+
+    static constexpr double int_magic = 4503599627370496.0;     // 2^52
+    static constexpr double round_magic = 6755399441055744.0;   // 1.5 * 2^52
+    static constexpr double min_normal = 2.2250738585072014e-308;
+    static constexpr double denorm_scale = 4503599627370496.0;  // 2^52
+
+    static constexpr double ln2_hi = 0.69314718055989033;
+    static constexpr double ln2_lo = 5.4979230187083712e-14;
+    static constexpr double log2e = 1.4426950408889634;
+    static constexpr double ivln2_hi = 1.4426950407214463;
+    static constexpr double ivln2_lo = 1.6751713164886512e-10;
+    static constexpr double two_over_pi = 0.63661977236758138;
+    static constexpr double pio2_1 = 1.5707963267341256;
+    static constexpr double pio2_2 = 6.077100506303966e-11;
+    static constexpr double pio2_3 = 2.0222662487959506e-21;
+
+    static constexpr double exp_min = -746.0;
+    static constexpr double exp_max = 710.0;
+    static constexpr double exp2_min = -1076.0;
+    static constexpr double exp2_max = 1025.0;
+    static constexpr double tanh_small = 0.625;
+    static constexpr double split = 134217729.0;        // 2^27 + 1
+};
+
+template<class V> struct math_traits;
+
+template<unsigned N> struct math_traits<float32<N>> : math_consts<float> {
+    using uint_vector_type = uint32<N>;
+    using uint_element_type = uint32_t;
+};
+
+template<unsigned N> struct math_traits<float64<N>> : math_consts<double> {
+    using uint_vector_type = uint64<N>;
+    using uint_element_type = uint64_t;
+};
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_splat(typename V::element_type x)
+{
+    return splat<V>(x);
+}
+
+template<class V> SIMDPP_INL
+typename math_traits<V>::uint_vector_type i_splat_bits(typename math_traits<V>::uint_element_type x)
+{
+    return splat<typename math_traits<V>::uint_vector_type>(x);
+}
+
+// Computes a * b + c, fused if the instruction set supports it
+template<class V> SIMDPP_INL
+V i_fmadd(const V& a, const V& b, const V& c)
+{
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+// Evaluates the polynomial c[0] + c[1]*x + ... + c[M-1]*x^(M-1)
+template<class V, unsigned M> SIMDPP_INL
+V i_poly(const V& x, const typename V::element_type (&c)[M])
+{
+    V r = i_splat<V>(c[M-1]);
+    for (unsigned i = M-1; i > 0; --i) {
+        r = i_fmadd(r, x, i_splat<V>(c[i-1]));
+    }
+    return r;
+}
+
+/*  Rounds the elements to the nearest integer. The result is exact only if the
+    magnitude of the elements is less than 2^22 for float32 and 2^51 for
+    float64. If @a bits is given, it receives a value whose low-order bits
+    contain the rounded integer.
+*/
+template<class V> SIMDPP_INL
+V i_round_int(const V& a, typename math_traits<V>::uint_vector_type& bits)
+{
+    using T = math_traits<V>;
+    V t = add(a, i_splat<V>(T::round_magic));
+    bits = bit_cast<typename T::uint_vector_type>(t);
+    return sub(t, i_splat<V>(T::round_magic));
+}
+
+template<class V> SIMDPP_INL
+V i_round_int(const V& a)
+{
+    typename math_traits<V>::uint_vector_type bits;
+    return i_round_int(a, bits);
+}
+
+// Computes 2^n for integral n within the range of normal exponents
+template<class V> SIMDPP_INL
+V i_pow2i(const V& n)
+{
+    using T = math_traits<V>;
+    using U = typename T::uint_vector_type;
+    U bits;
+    i_round_int(n, bits);
+    bits = add(bits, i_splat_bits<V>(T::exp_bias));
+    bits = shift_l<T::mant_bits>(bits);
+    return bit_cast<V>(bits);
+}
+
+/*  Computes a * 2^n for integral n. The scale factor is applied in two steps
+    so that results in the subnormal range and values of n slightly beyond the
+    range of normal exponents are handled.
+*/
+template<class V> SIMDPP_INL
+V i_ldexp(const V& a, const V& n)
+{
+    V n1 = i_round_int(V(mul(n, i_splat<V>(0.5))));
+    V n2 = sub(n, n1);
+    V r = mul(a, i_pow2i(n1));
+    return mul(r, i_pow2i(n2));
+}
+
+// Selects the elements of a where the corresponding bits in mask are set
+template<class V> SIMDPP_INL
+V i_select_bits(const typename math_traits<V>::uint_vector_type& mask,
+                const V& a, const V& b)
+{
+    V m = bit_cast<V>(mask);
+    return bit_or(bit_and(a, m), bit_andnot(b, m));
+}
+
+// Returns a mask of the elements that are integral. a must be non-negative.
+template<class V> SIMDPP_INL
+typename V::mask_vector_type i_is_int(const V& a)
+{
+    using T = math_traits<V>;
+    V t = sub(add(a, i_splat<V>(T::int_magic)), i_splat<V>(T::int_magic));
+    return bit_or(cmp_eq(t, a), cmp_ge(a, i_splat<V>(T::int_magic)));
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,81 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_DD_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_DD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Error-free transformations used to carry intermediate results as unevaluated
+    sums of two values (hi + lo) with roughly twice the precision of the
+    element type.
+*/
+
+// s + e == a + b exactly
+template<class V> SIMDPP_INL
+void i_two_sum(const V& a, const V& b, V& s, V& e)
+{
+    V t = add(a, b);
+    V v = sub(t, a);
+    e = add(sub(a, sub(t, v)), sub(b, v));
+    s = t;
+}
+
+// s + e == a + b exactly, provided that |a| >= |b|
+template<class V> SIMDPP_INL
+void i_fast_two_sum(const V& a, const V& b, V& s, V& e)
+{
+    V t = add(a, b);
+    e = sub(b, sub(t, a));
+    s = t;
+}
+
+// p + e == a * b exactly, provided that no overflow occurs
+template<class V> SIMDPP_INL
+void i_two_prod(const V& a, const V& b, V& p, V& e)
+{
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4
+    p = mul(a, b);
+    e = fmsub(a, b, p);
+#else
+    using T = math_traits<V>;
+    V c = i_splat<V>(T::split);
+    V ta = mul(a, c);
+    V tb = mul(b, c);
+    V ah = sub(ta, sub(ta, a));
+    V bh = sub(tb, sub(tb, b));
+    V al = sub(a, ah);
+    V bl = sub(b, bh);
+    V t = mul(a, b);
+    e = sub(mul(ah, bh), t);
+    e = add(e, mul(ah, bl));
+    e = add(e, mul(al, bh));
+    e = add(e, mul(al, bl));
+    p = t;
+#endif
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,131 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/dd.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Minimax approximations of (exp(r) - 1 - r) / r^2 for |r| <= ln(2)/2. The
+    relative error is 2^-22.9 for float32 and 2^-58.4 for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp_poly(const float32<N>& r)
+{
+    static const float c[] = {
+        0.5f,
+        0.166665778f,
+        0.0416668542f,
+        0.00836314075f,
+        0.00139012851f
+    };
+    return i_poly(r, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp_poly(const float64<N>& r)
+{
+    static const double c[] = {
+        0.5,
+        0.16666666666666671,
+        0.041666666666666616,
+        0.0083333333333261671,
+        0.0013888888888917981,
+        0.00019841269874719823,
+        2.4801587245678807e-05,
+        2.7557255515380465e-06,
+        2.7557349687182349e-07,
+        2.5105173188289076e-08,
+        2.0889349491728281e-09
+    };
+    return i_poly(r, c);
+}
+
+// Computes exp(r) for |r| <= ln(2)/2
+template<class V> SIMDPP_INL
+V i_exp_reduced(const V& r)
+{
+    V r2 = mul(r, r);
+    V y = i_fmadd(r2, i_exp_poly(r), r);
+    return add(y, i_splat<V>(1.0));
+}
+
+/*  The argument is reduced to r = x - n*ln(2) with |r| <= ln(2)/2 so that
+    exp(x) = 2^n * exp(r). ln(2) is split into two parts so that n*ln2_hi is
+    exact.
+*/
+template<class V> SIMDPP_INL
+V i_exp(const V& x)
+{
+    using T = math_traits<V>;
+    V a = min(max(x, i_splat<V>(T::exp_min)), i_splat<V>(T::exp_max));
+    V n = i_round_int(V(mul(a, i_splat<V>(T::log2e))));
+    V r = i_fmadd(n, i_splat<V>(-T::ln2_hi), a);
+    r = i_fmadd(n, i_splat<V>(-T::ln2_lo), r);
+    V y = i_ldexp(i_exp_reduced(r), n);
+    return blend(x, y, isnan(x));
+}
+
+template<class V> SIMDPP_INL
+V i_exp2(const V& x)
+{
+    using T = math_traits<V>;
+    V a = min(max(x, i_splat<V>(T::exp2_min)), i_splat<V>(T::exp2_max));
+    V n = i_round_int(a);
+    V r = sub(a, n);
+    r = i_fmadd(r, i_splat<V>(T::ln2_hi), V(mul(r, i_splat<V>(T::ln2_lo))));
+    V y = i_ldexp(i_exp_reduced(r), n);
+    return blend(x, y, isnan(x));
+}
+
+/*  Computes exp(h + l) where h + l is a double-length value. The reduced
+    argument is kept in double-length form so that the error of the result
+    does not depend on the magnitude of the argument.
+*/
+template<class V> SIMDPP_INL
+V i_exp_dd(const V& h, const V& l)
+{
+    using T = math_traits<V>;
+    V a = min(max(h, i_splat<V>(T::exp_min)), i_splat<V>(T::exp_max));
+    V n = i_round_int(V(mul(a, i_splat<V>(T::log2e))));
+    // exact because n has few significant bits
+    V r = i_fmadd(n, i_splat<V>(-T::ln2_hi), a);
+    V rh, rl;
+    i_two_sum(r, V(mul(n, i_splat<V>(-T::ln2_lo))), rh, rl);
+    rl = add(rl, l);
+
+    // exp(rh + rl) ~= (1 + rh + rh^2 * P(rh)) * (1 + rl)
+    V p = mul(mul(rh, rh), i_exp_poly(rh));
+    V yh, yl;
+    i_fast_two_sum(i_splat<V>(1.0), rh, yh, yl);
+    yl = add(yl, p);
+    yl = i_fmadd(rl, V(add(yh, yl)), yl);
+    V y = i_ldexp(V(add(yh, yl)), n);
+    return blend(h, y, isnan(h));
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
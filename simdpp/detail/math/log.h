@@ -0,0 +1,221 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/dd.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Minimax approximations of (2*atanh(s)/s - 2) / s^2 as a function of
+    z = s^2 for 0 <= z <= (3 - 2*sqrt(2))^2. The relative error is 2^-21.8 for
+    float32 and 2^-51.0 for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_log_poly(const float32<N>& z)
+{
+    static const float c[] = {
+        0.666666865f,
+        0.399887651f,
+        0.295805126f
+    };
+    return i_poly(z, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log_poly(const float64<N>& z)
+{
+    static const double c[] = {
+        0.66666666666666696,
+        0.39999999999899172,
+        0.2857142862610651,
+        0.22222211115791435,
+        0.18182890370722937,
+        0.15331683983971311,
+        0.14616875708841942
+    };
+    return i_poly(z, c);
+}
+
+// The same as above except that the leading 2/3 term is excluded
+template<unsigned N> SIMDPP_INL
+float64<N> i_log_dd_poly(const float64<N>& z)
+{
+    static const double c[] = {
+        0.40000000000000024,
+        0.2857142857133837,
+        0.22222222271153583,
+        0.18181808240570702,
+        0.15385575223465717,
+        0.13285945444709119,
+        0.12913743221135815
+    };
+    return i_poly(z, c);
+}
+
+/*  Splits a positive value into x = 2^e * (1 + f) such that
+    sqrt(1/2) <= 1 + f < sqrt(2). f is computed exactly. Subnormal values are
+    scaled into the normal range first.
+*/
+template<class V> SIMDPP_INL
+void i_log_reduce(const V& x, V& e, V& f)
+{
+    using T = math_traits<V>;
+    using U = typename T::uint_vector_type;
+
+    typename V::mask_vector_type tiny = cmp_lt(x, i_splat<V>(T::min_normal));
+    V a = blend(mul(x, i_splat<V>(T::denorm_scale)), x, tiny);
+    V e_adj = blend(i_splat<V>(-(double)T::mant_bits), V::zero(), tiny);
+
+    // offsetting the bits moves the mantissas above sqrt(2) to the next
+    // exponent
+    U ix = bit_cast<U>(a);
+    ix = add(ix, i_splat_bits<V>(T::one_bits - T::sqrt_half_bits));
+
+    U ex = shift_r<T::mant_bits>(ix);
+    ex = bit_or(ex, i_splat_bits<V>(T::int_magic_bits));
+    e = sub(bit_cast<V>(ex), i_splat<V>(T::int_magic + T::exp_bias));
+    e = add(e, e_adj);
+
+    U mx = bit_and(ix, i_splat_bits<V>(T::mant_mask));
+    mx = add(mx, i_splat_bits<V>(T::sqrt_half_bits));
+    f = sub(bit_cast<V>(mx), i_splat<V>(1.0));
+}
+
+// Handles zero, negative, infinite and NaN arguments
+template<class V> SIMDPP_INL
+V i_log_special(const V& x, const V& r)
+{
+    using E = typename V::element_type;
+    V inf = i_splat<V>(std::numeric_limits<E>::infinity());
+    V res = blend(x, r, bit_or(cmp_eq(x, inf), isnan(x)));
+    res = blend(i_splat<V>(-std::numeric_limits<E>::infinity()), res,
+                cmp_eq(x, V::zero()));
+    res = blend(i_splat<V>(std::numeric_limits<E>::quiet_NaN()), res,
+                cmp_lt(x, V::zero()));
+    return res;
+}
+
+/*  log(1 + f) = 2*atanh(s) where s = f / (2 + f). The result is assembled as
+    f - (hfsq - s*(hfsq + R)) so that the leading term is exact.
+*/
+template<class V> SIMDPP_INL
+V i_log(const V& x)
+{
+    using T = math_traits<V>;
+    V e, f;
+    i_log_reduce(x, e, f);
+
+    V s = div(f, add(f, i_splat<V>(2.0)));
+    V z = mul(s, s);
+    V R = mul(z, i_log_poly(z));
+    V hfsq = mul(mul(f, f), i_splat<V>(0.5));
+
+    V r = mul(e, i_splat<V>(T::ln2_lo));
+    r = i_fmadd(s, V(add(hfsq, R)), r);
+    r = sub(sub(hfsq, r), f);
+    r = sub(mul(e, i_splat<V>(T::ln2_hi)), r);
+    return i_log_special(x, r);
+}
+
+/*  The same as above, except that log(1 + f) is split into high and low parts
+    before the multiplication by 1/ln(2) to avoid the rounding error of the
+    product.
+*/
+template<class V> SIMDPP_INL
+V i_log2(const V& x)
+{
+    using T = math_traits<V>;
+    V e, f;
+    i_log_reduce(x, e, f);
+
+    V s = div(f, add(f, i_splat<V>(2.0)));
+    V z = mul(s, s);
+    V R = mul(z, i_log_poly(z));
+    V hfsq = mul(mul(f, f), i_splat<V>(0.5));
+
+    V hi = sub(f, hfsq);
+    hi = bit_and(hi, bit_cast<V>(i_splat_bits<V>(T::log2_hi_mask)));
+    V lo = sub(sub(f, hi), hfsq);
+    lo = i_fmadd(s, V(add(hfsq, R)), lo);
+
+    V val_hi = mul(hi, i_splat<V>(T::ivln2_hi));
+    V val_lo = mul(add(lo, hi), i_splat<V>(T::ivln2_lo));
+    val_lo = i_fmadd(lo, i_splat<V>(T::ivln2_hi), val_lo);
+
+    V w = add(e, val_hi);
+    val_lo = add(val_lo, add(sub(e, w), val_hi));
+    return i_log_special(x, V(add(val_lo, w)));
+}
+
+/*  Computes log(x) as a double-length value h + l. x must be positive and
+    finite.
+*/
+template<unsigned N> SIMDPP_INL
+void i_log_dd(const float64<N>& x, float64<N>& h, float64<N>& l)
+{
+    using V = float64<N>;
+    using T = math_traits<V>;
+    V e, f;
+    i_log_reduce(x, e, f);
+
+    // s = f / (2 + f) as a double-length value
+    V dh, dl, sh, sl, p, pe;
+    i_fast_two_sum(i_splat<V>(2.0), f, dh, dl);
+    sh = div(f, dh);
+    i_two_prod(sh, dh, p, pe);
+    sl = sub(sub(sub(f, p), pe), mul(sh, dl));
+    sl = div(sl, dh);
+
+    // z = s^2, c = s^3
+    V zh, zl, ch, cl;
+    i_two_prod(sh, sh, zh, zl);
+    zl = i_fmadd(V(add(sh, sh)), sl, zl);
+    i_two_prod(zh, sh, ch, cl);
+    cl = i_fmadd(zh, sl, cl);
+    cl = i_fmadd(zl, sh, cl);
+
+    // t = 2/3 * s^3
+    const double c23_hi = 0.66666666666666663;
+    const double c23_lo = 3.7007434154171883e-17;
+    V th, tl;
+    i_two_prod(ch, i_splat<V>(c23_hi), th, tl);
+    tl = i_fmadd(ch, i_splat<V>(c23_lo), tl);
+    tl = i_fmadd(cl, i_splat<V>(c23_hi), tl);
+
+    // the remaining terms of the series
+    V w = mul(mul(ch, zh), i_log_dd_poly(zh));
+
+    V rh, rl, t;
+    i_two_sum(V(mul(e, i_splat<V>(T::ln2_hi))), V(add(sh, sh)), rh, rl);
+    rl = add(rl, add(sl, sl));
+    i_two_sum(rh, th, rh, t);
+    rl = add(rl, add(t, tl));
+    rl = add(rl, i_fmadd(e, i_splat<V>(T::ln2_lo), w));
+    i_fast_two_sum(rh, rl, h, l);
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
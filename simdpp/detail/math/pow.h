@@ -0,0 +1,109 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_POW_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/core/to_float64.h>
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/dd.h>
+#include <simdpp/detail/math/exp.h>
+#include <simdpp/detail/math/log.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Given r = exp(y * log(|x|)), applies the sign of the result and handles the
+    special cases as specified by C99 pow().
+*/
+template<class V> SIMDPP_INL
+V i_pow_special(const V& x, const V& y, const V& r)
+{
+    using T = math_traits<V>;
+    using E = typename V::element_type;
+    using M = typename V::mask_vector_type;
+    V ax = abs(x);
+    V ay = abs(y);
+    V one = i_splat<V>(1.0);
+    V inf = i_splat<V>(std::numeric_limits<E>::infinity());
+
+    M y_int = i_is_int(ay);
+    M y_odd = bit_andnot(y_int, i_is_int(V(mul(ay, i_splat<V>(0.5)))));
+
+    // negative x (including -0.0) raised to an odd integer power
+    V sign = bit_and(x, bit_cast<V>(i_splat_bits<V>(T::sign_mask)));
+    V res = bit_xor(r, blend(sign, V::zero(), y_odd));
+
+    // finite negative x raised to a non-integer power
+    M nan = bit_and(cmp_lt(x, V::zero()), cmp_gt(x, i_splat<V>(-std::numeric_limits<E>::infinity())));
+    nan = bit_andnot(nan, y_int);
+    res = blend(i_splat<V>(std::numeric_limits<E>::quiet_NaN()), res, nan);
+
+    // y == 0, x == 1 and |x| == 1 with infinite y result in 1 even for NaN
+    M is_one = bit_or(cmp_eq(y, V::zero()), cmp_eq(x, one));
+    is_one = bit_or(is_one, bit_and(cmp_eq(ax, one), cmp_eq(ay, inf)));
+    return blend(one, res, is_one);
+}
+
+/*  The float32 version is computed in double precision, which makes the error
+    of y * log(x) negligible.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_pow(const float32<N>& x, const float32<N>& y)
+{
+    float64<N> x64 = to_float64(x);
+    float64<N> y64 = to_float64(y);
+    float64<N> l = i_log(float64<N>(abs(x64)));
+    float64<N> r = i_exp(float64<N>(mul(y64, l)));
+    r = i_pow_special(x64, y64, r);
+    return to_float32(r);
+}
+
+/*  The float64 version computes log(|x|) and the product y * log(|x|) as
+    double-length values. Otherwise the error of the result would grow with
+    the magnitude of y * log(|x|).
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> i_pow(const float64<N>& x, const float64<N>& y)
+{
+    using V = float64<N>;
+    V ax = abs(x);
+    V lh, ll;
+    i_log_dd(ax, lh, ll);
+    lh = i_log_special(ax, lh);
+
+    V ph, pl;
+    i_two_prod(y, lh, ph, pl);
+    pl = i_fmadd(y, ll, pl);
+    // the low part is meaningless if the product overflows or is not finite.
+    // Without FMA the low part is NaN if the splitting of y overflows.
+    mask_float64<N> pl_valid = bit_and(cmp_lt(abs(ph), i_splat<V>(1024.0)),
+                                     cmp_lt(abs(pl), i_splat<V>(1.0)));
+    pl = blend(pl, V::zero(), pl_valid);
+
+    V r = i_exp_dd(ph, pl);
+    return i_pow_special(x, y, r);
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
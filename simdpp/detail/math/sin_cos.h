@@ -0,0 +1,170 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_SIN_COS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Minimax approximations of (sin(r) - r) / r^3 and
+    (cos(r) - 1 + r^2/2) / r^4 as functions of z = r^2 for |r| <= pi/4. The
+    relative errors are 2^-23.0 and 2^-24.3 for float32 and 2^-52.8 and
+    2^-54.8 for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_sin_poly(const float32<N>& z)
+{
+    static const float c[] = {
+        -0.166666642f,
+        0.00833274517f,
+        -0.00019587361f
+    };
+    return i_poly(z, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_sin_poly(const float64<N>& z)
+{
+    static const double c[] = {
+        -0.16666666666666666,
+        0.0083333333333309254,
+        -0.00019841269836727804,
+        2.7557316088604758e-06,
+        -2.5051129263536817e-08,
+        1.5917962032331975e-10
+    };
+    return i_poly(z, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_cos_poly(const float32<N>& z)
+{
+    static const float c[] = {
+        0.0416666642f,
+        -0.00138883013f,
+        2.45476076e-05f
+    };
+    return i_poly(z, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_cos_poly(const float64<N>& z)
+{
+    static const double c[] = {
+        0.041666666666666664,
+        -0.0013888888888887387,
+        2.4801587298753231e-05,
+        -2.7557317266080083e-07,
+        2.0876145222333358e-09,
+        -1.1382564626224392e-11
+    };
+    return i_poly(z, c);
+}
+
+/*  Reduces the argument to r = x - q*pi/2 with |r| <= pi/4. pi/2 is split
+    into three parts so that the products q*pio2_1 and q*pio2_2 are exact as
+    long as q has no more than 12 significant bits for float32 and 20 for
+    float64. The low-order bits of q are returned in @a q.
+*/
+template<class V> SIMDPP_INL
+V i_sin_cos_reduce(const V& x, typename math_traits<V>::uint_vector_type& q)
+{
+    using T = math_traits<V>;
+    V n = i_round_int(V(mul(x, i_splat<V>(T::two_over_pi))), q);
+    V r = i_fmadd(n, i_splat<V>(-T::pio2_1), x);
+    r = i_fmadd(n, i_splat<V>(-T::pio2_2), r);
+    r = i_fmadd(n, i_splat<V>(-T::pio2_3), r);
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V i_sin_reduced(const V& r, const V& z)
+{
+    return i_fmadd(V(mul(r, z)), i_sin_poly(z), r);
+}
+
+template<class V> SIMDPP_INL
+V i_cos_reduced(const V& z)
+{
+    V w = i_fmadd(z, i_splat<V>(-0.5), i_splat<V>(1.0));
+    return i_fmadd(V(mul(z, z)), i_cos_poly(z), w);
+}
+
+/*  Picks sin(r) or cos(r) depending on the quadrant q and applies the sign:
+    sin(r + q*pi/2) is sin(r), cos(r), -sin(r), -cos(r) for q = 0, 1, 2, 3.
+*/
+template<class V> SIMDPP_INL
+V i_sin_quadrant(const typename math_traits<V>::uint_vector_type& q,
+                 const V& s, const V& c)
+{
+    using T = math_traits<V>;
+    using U = typename T::uint_vector_type;
+    U odd = sub(U::zero(), bit_and(q, i_splat_bits<V>(1)));
+    U sign = bit_and(q, i_splat_bits<V>(2));
+    sign = shift_l<sizeof(typename V::element_type)*8 - 2>(sign);
+    V r = i_select_bits(odd, c, s);
+    return bit_xor(r, bit_cast<V>(sign));
+}
+
+template<class V> SIMDPP_INL
+V i_sin(const V& x)
+{
+    using U = typename math_traits<V>::uint_vector_type;
+    U q;
+    V r = i_sin_cos_reduce(x, q);
+    V z = mul(r, r);
+    V res = i_sin_quadrant(q, i_sin_reduced(r, z), i_cos_reduced(z));
+    // the argument reduction loses the sign of -0.0
+    return blend(x, res, cmp_eq(x, V::zero()));
+}
+
+template<class V> SIMDPP_INL
+V i_cos(const V& x)
+{
+    using U = typename math_traits<V>::uint_vector_type;
+    U q;
+    V r = i_sin_cos_reduce(x, q);
+    V z = mul(r, r);
+    q = add(q, i_splat_bits<V>(1));
+    return i_sin_quadrant(q, i_sin_reduced(r, z), i_cos_reduced(z));
+}
+
+template<class V> SIMDPP_INL
+void i_sincos(const V& x, V& s, V& c)
+{
+    using U = typename math_traits<V>::uint_vector_type;
+    U q;
+    V r = i_sin_cos_reduce(x, q);
+    V z = mul(r, r);
+    V ps = i_sin_reduced(r, z);
+    V pc = i_cos_reduced(z);
+    s = i_sin_quadrant(q, ps, pc);
+    s = blend(x, s, cmp_eq(x, V::zero()));
+    q = add(q, i_splat_bits<V>(1));
+    c = i_sin_quadrant(q, ps, pc);
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,89 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/common.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace detail {
+namespace math {
+
+/*  Minimax approximations of (tanh(x) - x) / x^3 as a function of z = x^2
+    for |x| <= 0.625. The relative error is 2^-22.9 for float32 and 2^-51.5
+    for float64.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh_poly(const float32<N>& z)
+{
+    static const float c[] = {
+        -0.333333284f,
+        0.133327708f,
+        -0.0538509525f,
+        0.0209973585f,
+        -0.00609694188f
+    };
+    return i_poly(z, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_tanh_poly(const float64<N>& z)
+{
+    static const double c[] = {
+        -0.3333333333333332,
+        0.13333333333326663,
+        -0.053968253961399933,
+        0.021869488260701772,
+        -0.0088632298333006926,
+        0.0035920590002018033,
+        -0.0014553094299760256,
+        0.00058743776364925744,
+        -0.00023077720354713958,
+        7.9600812939271953e-05,
+        -1.7245518125670652e-05
+    };
+    return i_poly(z, c);
+}
+
+/*  Small arguments use the polynomial, the rest use
+    tanh(|x|) = 1 - 2 / (exp(2*|x|) + 1), which saturates to 1 for large |x|.
+    The result is computed for |x| and the sign of x is applied afterwards.
+*/
+template<class V> SIMDPP_INL
+V i_tanh(const V& x)
+{
+    using T = math_traits<V>;
+    V ax = abs(x);
+    V z = mul(x, x);
+    V small = i_fmadd(V(mul(ax, z)), i_tanh_poly(z), ax);
+
+    V e = i_exp(V(add(ax, ax)));
+    V large = div(i_splat<V>(2.0), add(e, i_splat<V>(1.0)));
+    large = sub(i_splat<V>(1.0), large);
+
+    V r = blend(small, large, cmp_lt(ax, i_splat<V>(T::tanh_small)));
+    return bit_or(r, bit_and(x, bit_cast<V>(i_splat_bits<V>(T::sign_mask))));
+}
+
+} // namespace math
+} // namespace detail
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -46,6 +46,21 @@ struct vec256_impl {
     using f64 = float64x4;
 };
 
+#if SIMDPP_USE_AVX512BW
+struct vec512_impl {
+    using i8  =  int8<64>;
+    using u8  = uint8<64>;
+    using i16 =  int16<32>;
+    using u16 = uint16<32>;
+    using i32 = int32<16>;
+    using u32 = uint32<16>;
+    using i64 = int64<8>;
+    using u64 = uint64<8>;
+    using f32 = float32<16>;
+    using f64 = float64<8>;
+};
+#endif
+
 template<class T> struct same_width;
 template<> struct same_width<int8x16  > : vec128_impl {};
 template<> struct same_width<uint8x16 > : vec128_impl {};
@@ -69,6 +84,19 @@ template<> struct same_width<uint64x4 > : vec256_impl {};
 template<> struct same_width<float32x8> : vec256_impl {};
 template<> struct same_width<float64x4> : vec256_impl {};
 
+#if SIMDPP_USE_AVX512BW
+template<> struct same_width< int8<64> > : vec512_impl {};
+template<> struct same_width<uint8<64> > : vec512_impl {};
+template<> struct same_width< int16<32>> : vec512_impl {};
+template<> struct same_width<uint16<32>> : vec512_impl {};
+template<> struct same_width< int32<16>> : vec512_impl {};
+template<> struct same_width<uint32<16>> : vec512_impl {};
+template<> struct same_width< int64<8> > : vec512_impl {};
+template<> struct same_width<uint64<8> > : vec512_impl {};
+template<> struct same_width<float32<16>> : vec512_impl {};
+template<> struct same_width<float64<8> > : vec512_impl {};
+#endif
+
 } // namespace detail
 #ifndef SIMDPP_DOXYGEN
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -37,18 +37,32 @@ enum class Arch : std::uint32_t {
     X86_SSSE3 = 1 << 3,
     /// Indicates x86 SSE4.1 support
     X86_SSE4_1 = 1 << 4,
+    /// Indicates x86 SSE4.2 support
+    X86_SSE4_2 = 1 << 5,
     /// Indicates x86 AVX support
-    X86_AVX = 1 << 5,
+    X86_AVX = 1 << 6,
+    /// Indicates x86 F16C (half-precision conversion) support
+    X86_F16C = 1 << 7,
     /// Indicates x86 AVX2 support
-    X86_AVX2 = 1 << 6,
+    X86_AVX2 = 1 << 8,
     /// Indicates x86 FMA3 (Intel) support
-    X86_FMA3 = 1 << 7,
+    X86_FMA3 = 1 << 9,
     /// Indicates x86 FMA4 (AMD) support
-    X86_FMA4 = 1 << 8,
+    X86_FMA4 = 1 << 10,
     /// Indicates x86 XOP (AMD) support
-    X86_XOP = 1 << 9,
-    /// Indicates x86 AVX-512F suppotr
-    X86_AVX512F = 1 << 10,
+    X86_XOP = 1 << 11,
+    /// Indicates x86 AVX-512F support
+    X86_AVX512F = 1 << 12,
+    /// Indicates x86 AVX-512CD support
+    X86_AVX512CD = 1 << 13,
+    /// Indicates x86 AVX-512BW support
+    X86_AVX512BW = 1 << 14,
+    /// Indicates x86 AVX-512DQ support
+    X86_AVX512DQ = 1 << 15,
+    /// Indicates x86 AVX-512VL support
+    X86_AVX512VL = 1 << 16,
+    /// Indicates x86 AVX-512 BF16 support
+    X86_AVX512BF16 = 1 << 17,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
@@ -56,6 +70,18 @@ enum class Arch : std::uint32_t {
     /// Indicates ARM NEON support (SP floating-point math is executed on NEON,
     /// DP floating-point math is executed on VFP)
     ARM_NEON_FLT_SP = 1 << 1,
+    /// Indicates ARM 64-bit NEON support (AArch64 Advanced SIMD). SP and DP
+    /// floating-point math, including fused multiply-add, is executed on
+    /// NEON. Implies ARM_NEON and ARM_NEON_FLT_SP.
+    ARM_NEON64 = 1 << 2,
+    /// Indicates ARM NEON half-precision floating-point arithmetic support
+    /// (ARMv8.2-A FP16 extension). Only reported by the runtime detection
+    /// functions; there's no corresponding compile-time architecture.
+    ARM_NEON_FP16 = 1 << 3,
+    /// Indicates ARM NEON 8-bit integer dot product support (ARMv8.2-A
+    /// DotProd extension). Only reported by the runtime detection functions;
+    /// there's no corresponding compile-time architecture.
+    ARM_NEON_DOTPROD = 1 << 4,
 
     /// Indicates POWER ALTIVEC support.
     POWER_ALTIVEC = 1 << 0
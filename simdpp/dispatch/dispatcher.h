@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <functional>
 #include <vector>
@@ -50,6 +51,38 @@ s
     implementations of CPU features detection.
 */
 
+/** @def SIMDPP_DISPATCH_USE_IFUNC
+    If defined, @c SIMDPP_MAKE_DISPATCHER_* macros emit the dispatched function
+    as a GNU indirect function (IFUNC). The dynamic loader then invokes a
+    resolver once when the containing executable or shared library is loaded
+    and binds the best version directly, so that a call to the dispatched
+    function costs the same as a call to any other function located in a
+    shared library. The version is selected in the same way as in the default
+    mode.
+
+    The mode is available only when compiling with GCC or clang for Linux ELF
+    targets, the C library must support IFUNC (e.g. glibc). On other targets
+    the macro is ignored and the default dispatch mechanism is used. The
+    macro must be defined consistently for all objects that contain versions
+    of the same function.
+
+    Since the resolver runs before any static objects are initialized, the
+    function identified by @c SIMDPP_USER_ARCH_INFO is called directly from
+    the resolver and must not depend on any dynamic initialization or on the
+    C++ runtime. @c get_arch_raw_cpuid and
+    @c get_arch_gcc_builtin_cpu_supports are suitable; @c
+    get_arch_linux_cpuinfo is not. The dispatched function may be overloaded,
+    but its parameter and return types must be spelled identically in all
+    expansions of @c SIMDPP_MAKE_DISPATCHER_* for the same overload, because
+    the overloads are told apart by the stringized types.
+*/
+#if defined(SIMDPP_DISPATCH_USE_IFUNC) && defined(__ELF__) && \
+    defined(__linux__) && (__GNUC__ || defined(__clang__))
+#define SIMDPP_DISPATCH_IFUNC 1
+#else
+#define SIMDPP_DISPATCH_IFUNC 0
+#endif
+
 /// @} -- end defgroup
 
 namespace detail {
@@ -75,28 +108,38 @@ struct FnVersion {
     VoidFunPtr fun_ptr;
 };
 
+/*  Returns the version with the largest @a needed_arch out of the versions
+    in the range [first, last) that can run on @a arch, or @a last if there's
+    no such version. The comparison of the architecture flags matches the
+    ordering established by @c Arch.
+*/
+template<class It>
+It select_best_version(It first, It last, Arch arch)
+{
+    It best = last;
+    for (; first != last; ++first) {
+        if (!test_arch_subset(arch, first->needed_arch)) {
+            continue;
+        }
+        if (best == last || first->needed_arch > best->needed_arch) {
+            best = first;
+        }
+    }
+    return best;
+}
+
 inline unsigned select_version_any(std::vector<FnVersion>& versions,
                                    const GetArchCb& get_info_cb)
 {
     // No need to try to be very efficient here.
     Arch arch = get_info_cb();
-    std::sort(versions.begin(), versions.end(),
-              [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
-              });
-
-    unsigned i;
-    for (i = 0; i < versions.size(); ++i) {
-        if (test_arch_subset(arch, versions[i].needed_arch)) {
-            break;
-        }
-    }
-    if (i == versions.size()) {
+    auto it = select_best_version(versions.begin(), versions.end(), arch);
+    if (it == versions.end()) {
         // The user didn't provide the NONE_NULL version and no SIMD
         // architecture is supported. We can't do anything except to abort
         std::abort();
     }
-    return i;
+    return it - versions.begin();
 }
 
 #if __GNUC__ && !defined(__clang__)
@@ -205,6 +248,86 @@ public:
     }
 };
 
+#if SIMDPP_DISPATCH_IFUNC
+/*  A statically initialized record that describes a version of a function
+    dispatched via IFUNC. The records of all versions of a particular function
+    are put into a dedicated section. The section is named after the function
+    so that the linker defines __start_<section> and __stop_<section> symbols
+    delimiting the records. This way the resolver can find all versions
+    without relying on the registration from static constructors.
+
+    The overloads of a function share the section, thus each record also
+    identifies the signature of the function as spelled in the
+    @c SIMDPP_MAKE_DISPATCHER_* macro. The layout of the record doesn't depend
+    on @a FunPtr.
+
+    The records are accessed as an array, thus there must be no padding
+    between the records coming from different objects. The compilers may
+    increase the alignment of large objects beyond that of their type, so the
+    alignment is fixed explicitly to a value that is not less than the size.
+*/
+template<class FunPtr>
+struct alignas(32) IfuncVersion {
+    Arch needed_arch;
+    FunPtr fun_ptr;
+    const char* signature;
+};
+
+// strcmp may itself be an IFUNC that is not yet resolved
+inline bool ifunc_signature_equal(const char* a, const char* b)
+{
+    for (; *a == *b; ++a, ++b) {
+        if (*a == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*  Selects the version of a function to bind the IFUNC symbol to. The records
+    within [first, last) whose signature differs from @a signature belong to
+    other overloads and are skipped. This function is called from the IFUNC
+    resolver, thus it must not use anything that depends on dynamic
+    initialization.
+*/
+template<class FunPtr, class GetArch>
+FunPtr select_version_ifunc(const char* first, const char* last,
+                            const char* signature, GetArch get_arch)
+{
+#if __i386__ || __amd64__
+    // __builtin_cpu_supports() needs explicit initialization in resolvers
+#if defined(__clang__)
+#if __has_builtin(__builtin_cpu_init)
+    __builtin_cpu_init();
+#endif
+#else
+    __builtin_cpu_init();
+#endif
+#endif
+    Arch arch = get_arch();
+    const IfuncVersion<FunPtr>* it =
+            reinterpret_cast<const IfuncVersion<FunPtr>*>(first);
+    const IfuncVersion<FunPtr>* end =
+            reinterpret_cast<const IfuncVersion<FunPtr>*>(last);
+    const IfuncVersion<FunPtr>* best = nullptr;
+
+    // the same selection as in select_best_version
+    for (; it != end; ++it) {
+        if (!ifunc_signature_equal(it->signature, signature) ||
+            !test_arch_subset(arch, it->needed_arch)) {
+            continue;
+        }
+        if (best == nullptr || it->needed_arch > best->needed_arch) {
+            best = it;
+        }
+    }
+    if (best == nullptr) {
+        std::abort();
+    }
+    return best->fun_ptr;
+}
+#endif
+
 } // namespace detail
 } // namespace simdpp
 
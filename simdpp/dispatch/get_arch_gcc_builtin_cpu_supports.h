@@ -17,41 +17,63 @@ namespace simdpp {
 */
 inline Arch get_arch_gcc_builtin_cpu_supports()
 {
-    Arch arch_info;
-#if (__GNUC__ >= 4) && (__GNUC_MINOR__ >= 8)
+    Arch arch_info = Arch::NONE_NULL;
+
+#if (__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8) || defined(__clang__)
 #if __i386__ || __amd64__
-    if (__builtin_cpu_supports("avx2")) {
-        arch_info |= Arch::X86_SSE2;
-        arch_info |= Arch::X86_SSE3;
-        arch_info |= Arch::X86_SSSE3;
-        arch_info |= Arch::X86_SSE4_1;
-        arch_info |= Arch::X86_AVX;
-        arch_info |= Arch::X86_AVX2;
-    } else if (__builtin_cpu_supports("avx")) {
-        arch_info |= Arch::X86_SSE2;
-        arch_info |= Arch::X86_SSE3;
-        arch_info |= Arch::X86_SSSE3;
-        arch_info |= Arch::X86_SSE4_1;
-        arch_info |= Arch::X86_AVX;
-    } else if (__builtin_cpu_supports("sse4.1")) {
-        arch_info |= Arch::X86_SSE2;
-        arch_info |= Arch::X86_SSE3;
-        arch_info |= Arch::X86_SSSE3;
-        arch_info |= Arch::X86_SSE4_1;
-    } else if (__builtin_cpu_supports("ssse3")) {
-        arch_info |= Arch::X86_SSE2;
-        arch_info |= Arch::X86_SSE3;
-        arch_info |= Arch::X86_SSSE3;
-    } else if (__builtin_cpu_supports("sse3")) {
-        arch_info |= Arch::X86_SSE3;
-        arch_info |= Arch::X86_SSE2;
-    } else if (__builtin_cpu_supports("sse2")) {
-        arch_info |= Arch::X86_SSE2;
+    Arch a_sse2 = Arch::X86_SSE2;
+    Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
+    Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
+    Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
+    Arch a_avx = a_sse4_2 | Arch::X86_AVX;
+    Arch a_avx2 = a_avx | Arch::X86_AVX2;
+
+    if (__builtin_cpu_supports("sse2"))
+        arch_info |= a_sse2;
+    if (__builtin_cpu_supports("sse3"))
+        arch_info |= a_sse3;
+    if (__builtin_cpu_supports("ssse3"))
+        arch_info |= a_ssse3;
+    if (__builtin_cpu_supports("sse4.1"))
+        arch_info |= a_sse4_1;
+    if (__builtin_cpu_supports("sse4.2"))
+        arch_info |= a_sse4_2;
+    if (__builtin_cpu_supports("avx"))
+        arch_info |= a_avx;
+    if (__builtin_cpu_supports("avx2"))
+        arch_info |= a_avx2;
+#if (__GNUC__ >= 11) && !defined(__clang__)
+    if (__builtin_cpu_supports("f16c"))
+        arch_info |= a_sse3 | Arch::X86_F16C;
+#endif
+
+#if (__GNUC__ >= 6) || defined(__clang__)
+    // __builtin_cpu_supports checks whether the OS preserves the AVX-512
+    // state
+    Arch a_avx512f = a_avx2 | Arch::X86_FMA3 | Arch::X86_AVX512F;
+
+    if (__builtin_cpu_supports("avx512f")) {
+        arch_info |= a_avx512f;
+        if (__builtin_cpu_supports("avx512cd"))
+            arch_info |= Arch::X86_AVX512CD;
+        if (__builtin_cpu_supports("avx512bw"))
+            arch_info |= Arch::X86_AVX512BW;
+        if (__builtin_cpu_supports("avx512dq"))
+            arch_info |= Arch::X86_AVX512DQ;
+        if (__builtin_cpu_supports("avx512vl"))
+            arch_info |= Arch::X86_AVX512VL;
+#if (__GNUC__ >= 11) && !defined(__clang__)
+        if (__builtin_cpu_supports("avx512bf16"))
+            arch_info |= Arch::X86_AVX512BF16;
+#endif
     }
 #endif
+#endif
 #endif
     return arch_info;
 }
+
 } // namespace simdpp
 
 #endif
@@ -22,7 +22,7 @@ namespace simdpp {
 /** @ingroup simdpp_dispatcher
     Retrieves supported architecture from Linux /proc/cpuinfo file.
 
-    Works on X86 and ARM.
+    Works on X86, ARM and AArch64.
 */
 inline Arch get_arch_linux_cpuinfo()
 {
@@ -35,27 +35,51 @@ inline Arch get_arch_linux_cpuinfo()
     ident = "Features\t";
     features["neon"] = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
 
+#elif defined(__aarch64__)
+    Arch a_neon64 = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP | Arch::ARM_NEON64;
+
+    ident = "Features\t";
+    features["asimd"] = a_neon64;
+    features["asimdhp"] = a_neon64 | Arch::ARM_NEON_FP16;
+    features["asimddp"] = a_neon64 | Arch::ARM_NEON_DOTPROD;
+
 #elif defined(__i386__) || defined(__amd64__)
     Arch a_sse2 = Arch::X86_SSE2;
     Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
     Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
     Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
-    Arch a_avx = a_sse4_1 | Arch::X86_AVX;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
+    Arch a_avx = a_sse4_2 | Arch::X86_AVX;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_f16c = a_sse3 | Arch::X86_F16C;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
+    Arch a_avx512f = a_avx2 | Arch::X86_FMA3 | Arch::X86_AVX512F;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
+    Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
+    Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
+    Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512bf16 = a_avx512f | Arch::X86_AVX512BF16;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
     features["pni"] = a_sse3;
     features["ssse3"] = a_ssse3;
     features["sse4_1"] = a_sse4_1;
+    features["sse4_2"] = a_sse4_2;
     features["avx"] = a_avx;
     features["avx2"] = a_avx2;
+    features["f16c"] = a_f16c;
     features["fma"] = a_fma3;
     features["fma4"] = a_fma4;
     features["xop"] = a_xop;
+    features["avx512f"] = a_avx512f;
+    features["avx512cd"] = a_avx512cd;
+    features["avx512bw"] = a_avx512bw;
+    features["avx512dq"] = a_avx512dq;
+    features["avx512vl"] = a_avx512vl;
+    features["avx512_bf16"] = a_avx512bf16;
 #else
     return res;
 #endif
@@ -0,0 +1,62 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_GET_ARCH_LINUX_HWCAP_H
+#define LIBSIMDPP_DISPATCH_GET_ARCH_LINUX_HWCAP_H
+
+#include <simdpp/dispatch/arch.h>
+
+#if defined(__linux__) && (defined(__arm__) || defined(__aarch64__))
+#include <sys/auxv.h>
+#endif
+
+namespace simdpp {
+
+/** @ingroup simdpp_dispatcher
+    Retrieves supported architecture from the hardware capability bits that
+    the Linux kernel passes to the process via the auxiliary vector
+    (@c getauxval(AT_HWCAP)). Unlike @c get_arch_linux_cpuinfo, does not
+    access the filesystem.
+
+    Works on ARM and AArch64. Requires glibc 2.16 or newer.
+*/
+inline Arch get_arch_linux_hwcap()
+{
+    Arch res = Arch::NONE_NULL;
+
+#if defined(__linux__) && defined(__arm__)
+    // HWCAP_NEON from asm/hwcap.h
+    const unsigned long hwcap_neon = 1 << 12;
+
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    if (hwcap & hwcap_neon) {
+        res |= Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
+    }
+
+#elif defined(__linux__) && defined(__aarch64__)
+    // HWCAP_ASIMD, HWCAP_ASIMDHP and HWCAP_ASIMDDP from asm/hwcap.h
+    const unsigned long hwcap_asimd = 1 << 1;
+    const unsigned long hwcap_asimdhp = 1 << 10;
+    const unsigned long hwcap_asimddp = 1 << 20;
+
+    unsigned long hwcap = getauxval(AT_HWCAP);
+    if (hwcap & hwcap_asimd) {
+        res |= Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP | Arch::ARM_NEON64;
+        if (hwcap & hwcap_asimdhp) {
+            res |= Arch::ARM_NEON_FP16;
+        }
+        if (hwcap & hwcap_asimddp) {
+            res |= Arch::ARM_NEON_DOTPROD;
+        }
+    }
+#endif
+    return res;
+}
+
+} // namespace simdpp
+
+#endif
@@ -18,14 +18,14 @@
 namespace simdpp {
 namespace detail {
 
-inline void get_cpuid(unsigned level, unsigned* eax, unsigned* ebx,
-                      unsigned* ecx, unsigned* edx)
+inline void get_cpuid(unsigned level, unsigned subleaf, unsigned* eax,
+                      unsigned* ebx, unsigned* ecx, unsigned* edx)
 {
 #if __GNUC__ || defined(__clang__)
-    __get_cpuid(level, eax, ebx, ecx, edx);
+    __cpuid_count(level, subleaf, *eax, *ebx, *ecx, *edx);
 #elif _MSC_VER
     uint32_t regs[4];
-    __cpuid((int*) regs, level);
+    __cpuidex((int*) regs, level, subleaf);
     *eax = regs[0];
     *ebx = regs[1];
     *ecx = regs[2];
@@ -60,13 +60,15 @@ inline Arch get_arch_raw_cpuid()
 
     uint32_t eax, ebx, ecx, edx;
     unsigned max_cpuid_level;
+    unsigned max_ext_cpuid_level;
     bool xsave_xrstore_avail = false;
+    bool avx512_state_avail = false;
 
-    detail::get_cpuid(0, &eax, &ebx, &ecx, &edx);
+    ::simdpp::detail::get_cpuid(0, 0, &eax, &ebx, &ecx, &edx);
     max_cpuid_level = eax;
 
     if (max_cpuid_level >= 0x00000001) {
-        detail::get_cpuid(0x00000001, &eax, &ebx, &ecx, &edx);
+        ::simdpp::detail::get_cpuid(0x00000001, 0, &eax, &ebx, &ecx, &edx);
 
         if (edx & (1 << 26))
             arch_info |= Arch::X86_SSE2;
@@ -76,32 +78,58 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_SSSE3;
         if (ecx & (1 << 19))
             arch_info |= Arch::X86_SSE4_1;
-        if (ecx & (1 << 12))
-            arch_info |= Arch::X86_FMA3;
+        if (ecx & (1 << 20))
+            arch_info |= Arch::X86_SSE4_2;
         if (ecx & (1 << 27)) {
             // XSAVE/XRSTORE available on hardware, now check OS support
-            uint64_t xcr = detail::get_xcr(0);
+            uint64_t xcr = ::simdpp::detail::get_xcr(0);
             if ((xcr & 6) == 6)
                 xsave_xrstore_avail = true;
+            // the OS must also preserve the opmask and ZMM registers
+            if ((xcr & 0xe6) == 0xe6)
+                avx512_state_avail = true;
         }
 
         if (ecx & (1 << 28) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX;
+        if (ecx & (1 << 12) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_FMA3;
+        if (ecx & (1 << 29) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_F16C;
     }
-    if (max_cpuid_level >= 0x80000001) {
-        detail::get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx);
-        if (ecx & (1 << 16))
+
+    ::simdpp::detail::get_cpuid(0x80000000, 0, &eax, &ebx, &ecx, &edx);
+    max_ext_cpuid_level = eax;
+
+    if (max_ext_cpuid_level >= 0x80000001) {
+        ::simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
+        if (ecx & (1 << 16) && xsave_xrstore_avail)
             arch_info |= Arch::X86_FMA4;
-        if (ecx & (1 << 11))
+        if (ecx & (1 << 11) && xsave_xrstore_avail)
             arch_info |= Arch::X86_XOP;
     }
 
     if (max_cpuid_level >= 0x00000007) {
-        detail::get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
-        if (ecx & (1 << 5) && xsave_xrstore_avail)
+        ::simdpp::detail::get_cpuid(0x00000007, 0, &eax, &ebx, &ecx, &edx);
+        unsigned max_subleaf = eax;
+        if (ebx & (1 << 5) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX2;
-        if (ecx & (1 << 16) && xsave_xrstore_avail)
+        if (ebx & (1 << 16) && avx512_state_avail) {
             arch_info |= Arch::X86_AVX512F;
+            if (ebx & (1 << 28))
+                arch_info |= Arch::X86_AVX512CD;
+            if (ebx & (1 << 30))
+                arch_info |= Arch::X86_AVX512BW;
+            if (ebx & (1 << 17))
+                arch_info |= Arch::X86_AVX512DQ;
+            if (ebx & (1u << 31))
+                arch_info |= Arch::X86_AVX512VL;
+            if (max_subleaf >= 1) {
+                ::simdpp::detail::get_cpuid(0x00000007, 1, &eax, &ebx, &ecx, &edx);
+                if (eax & (1 << 5))
+                    arch_info |= Arch::X86_AVX512BF16;
+            }
+        }
     }
 
     return arch_info;
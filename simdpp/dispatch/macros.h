@@ -40,14 +40,1111 @@
     dispatched function, and that namespace must be @c SIMDPP_ARCH_NAMESPACE
 
     @a R, T1, T2, ..., T# must be exactly the same as those of the function
-    to be dispatched. The dispatched function may be overloaded.
+    to be dispatched. The dispatched function may be overloaded. The macros
+    for different overloads must be used on different lines. In the
+    @c SIMDPP_DISPATCH_USE_IFUNC mode the macros for the same overload must
+    also spell the types identically in all architectures.
 
     The macro defines a function with the same signature as the dispatched
     function in the namespace the macro is used. The body of that function
     implements the dispatch mechanism. The function must not be called before
-    main() starts.
+    main() starts, unless @c SIMDPP_DISPATCH_USE_IFUNC is in effect.
 */
 /// @{
+#define SIMDPP_DISPATCH_CAT2(a, b) a ## b
+#define SIMDPP_DISPATCH_CAT(a, b) SIMDPP_DISPATCH_CAT2(a, b)
+#define SIMDPP_DISPATCH_STRINGIFY2(x) #x
+#define SIMDPP_DISPATCH_STRINGIFY(x) SIMDPP_DISPATCH_STRINGIFY2(x)
+
+#if SIMDPP_DISPATCH_IFUNC
+#ifdef SIMDPP_USE_NULL
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID0(NAME)                                    \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())()                         \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)()>(                 \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" ")", SIMDPP_USER_ARCH_INFO);                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME()                                                                   \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)()>(&NAME),                                        \
+        "void" "(" ")"                                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID1(NAME,T1)                                 \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1)                       \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1)>(               \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 ")", SIMDPP_USER_ARCH_INFO);                           \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1)                                                              \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1)>(&NAME),                                      \
+        "void" "(" #T1 ")"                                                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID2(NAME,T1,T2)                              \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2)                    \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2)>(            \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 ")", SIMDPP_USER_ARCH_INFO);                   \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2)                                                        \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2)>(&NAME),                                   \
+        "void" "(" #T1 "," #T2 ")"                                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID3(NAME,T1,T2,T3)                           \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3)                 \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3)>(         \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 ")", SIMDPP_USER_ARCH_INFO);           \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3)                                                  \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3)>(&NAME),                                \
+        "void" "(" #T1 "," #T2 "," #T3 ")"                                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID4(NAME,T1,T2,T3,T4)                        \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4)              \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4)>(      \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 ")", SIMDPP_USER_ARCH_INFO);   \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4)                                            \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME),                             \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 ")"                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID5(NAME,T1,T2,T3,T4,T5)                     \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4,T5)           \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4,T5)>(   \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)                                      \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME),                          \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")"                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID6(NAME,T1,T2,T3,T4,T5,T6)                  \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6)        \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4,T5,T6)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)                                \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME),                       \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")"            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID7(NAME,T1,T2,T3,T4,T5,T6,T7)               \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7)     \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4,T5,T6,T7)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)                          \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME),                    \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")"    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID8(NAME,T1,T2,T3,T4,T5,T6,T7,T8)            \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7,T8)  \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8)                    \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME),                 \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID9(NAME,T1,T2,T3,T4,T5,T6,T7,T8,T9)         \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static void(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7,T8,T9)\
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+void NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8,T9 a9)              \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME),              \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET0(NAME,R)                                   \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())()                         \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)()>(                    \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" ")", SIMDPP_USER_ARCH_INFO);                                   \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME()                                                                      \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)()>(&NAME),                                           \
+        #R "(" ")"                                                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET1(NAME,R,T1)                                \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1)                       \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1)>(                  \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 ")", SIMDPP_USER_ARCH_INFO);                               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1)                                                                 \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1)>(&NAME),                                         \
+        #R "(" #T1 ")"                                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET2(NAME,R,T1,T2)                             \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2)                    \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2)>(               \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 ")", SIMDPP_USER_ARCH_INFO);                       \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2)                                                           \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2)>(&NAME),                                      \
+        #R "(" #T1 "," #T2 ")"                                                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET3(NAME,R,T1,T2,T3)                          \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3)                 \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3)>(            \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 ")", SIMDPP_USER_ARCH_INFO);               \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3)                                                     \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3)>(&NAME),                                   \
+        #R "(" #T1 "," #T2 "," #T3 ")"                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET4(NAME,R,T1,T2,T3,T4)                       \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4)              \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4)>(         \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 ")", SIMDPP_USER_ARCH_INFO);       \
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4)                                               \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME),                                \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 ")"                                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET5(NAME,R,T1,T2,T3,T4,T5)                    \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4,T5)           \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4,T5)>(      \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5)                                         \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME),                             \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")"                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET6(NAME,R,T1,T2,T3,T4,T5,T6)                 \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6)        \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4,T5,T6)>(   \
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6)                                   \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME),                          \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")"                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET7(NAME,R,T1,T2,T3,T4,T5,T6,T7)              \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7)     \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4,T5,T6,T7)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7)                             \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME),                       \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")"        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET8(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8)           \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7,T8)  \
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8)                       \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME),                    \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET9(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8,T9)        \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+extern "C" {                                                                  \
+extern const char __start_simdpp_dispatch_ ## NAME []                         \
+    __attribute__((visibility("hidden")));                                    \
+extern const char __stop_simdpp_dispatch_ ## NAME []                          \
+    __attribute__((visibility("hidden")));                                    \
+                                                                              \
+static R(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,                   \
+                                       __LINE__)())(T1,T2,T3,T4,T5,T6,T7,T8,T9)\
+{                                                                             \
+    return ::simdpp::detail::select_version_ifunc<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(\
+        __start_simdpp_dispatch_ ## NAME,                                     \
+        __stop_simdpp_dispatch_ ## NAME,                                      \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")", SIMDPP_USER_ARCH_INFO);\
+}                                                                             \
+} /* extern "C" */                                                            \
+                                                                              \
+R NAME(T1 a1,T2 a2,T3 a3,T4 a4,T5 a5,T6 a6,T7 a7,T8 a8,T9 a9)                 \
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                          \
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));              \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME),                 \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#else
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID0(NAME)                                    \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)()>                        \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)()>(&NAME),                                        \
+        "void" "(" ")"                                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID1(NAME,T1)                                 \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1)>                      \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1)>(&NAME),                                      \
+        "void" "(" #T1 ")"                                                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID2(NAME,T1,T2)                              \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2)>                   \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2)>(&NAME),                                   \
+        "void" "(" #T1 "," #T2 ")"                                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID3(NAME,T1,T2,T3)                           \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3)>                \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3)>(&NAME),                                \
+        "void" "(" #T1 "," #T2 "," #T3 ")"                                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID4(NAME,T1,T2,T3,T4)                        \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4)>             \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4)>(&NAME),                             \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 ")"                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID5(NAME,T1,T2,T3,T4,T5)                     \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5)>          \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME),                          \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")"                    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID6(NAME,T1,T2,T3,T4,T5,T6)                  \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6)>       \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME),                       \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")"            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID7(NAME,T1,T2,T3,T4,T5,T6,T7)               \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7)>    \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME),                    \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")"    \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID8(NAME,T1,T2,T3,T4,T5,T6,T7,T8)            \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)> \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME),                 \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_VOID9(NAME,T1,T2,T3,T4,T5,T6,T7,T8,T9)         \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>\
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME),              \
+        "void" "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET0(NAME,R)                                   \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)()>                           \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)()>(&NAME),                                           \
+        #R "(" ")"                                                            \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET1(NAME,R,T1)                                \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1)>                         \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1)>(&NAME),                                         \
+        #R "(" #T1 ")"                                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET2(NAME,R,T1,T2)                             \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2)>                      \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2)>(&NAME),                                      \
+        #R "(" #T1 "," #T2 ")"                                                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET3(NAME,R,T1,T2,T3)                          \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3)>                   \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3)>(&NAME),                                   \
+        #R "(" #T1 "," #T2 "," #T3 ")"                                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET4(NAME,R,T1,T2,T3,T4)                       \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4)>                \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4)>(&NAME),                                \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 ")"                                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET5(NAME,R,T1,T2,T3,T4,T5)                    \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5)>             \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME),                             \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 ")"                        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET6(NAME,R,T1,T2,T3,T4,T5,T6)                 \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6)>          \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME),                          \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 ")"                \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET7(NAME,R,T1,T2,T3,T4,T5,T6,T7)              \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7)>       \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME),                       \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 ")"        \
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET8(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8)           \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>    \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME),                    \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#define SIMDPP_MAKE_DISPATCHER_RET9(NAME,R,T1,T2,T3,T4,T5,T6,T7,T8,T9)        \
+struct simdpp_ ## NAME ## _tag;                                               \
+                                                                              \
+namespace SIMDPP_ARCH_NAMESPACE {                                             \
+                                                                              \
+static const ::simdpp::detail::IfuncVersion<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)> \
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)      \
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {              \
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::        \
+                                     detail::this_compile_arch_bits),         \
+        static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME),                 \
+        #R "(" #T1 "," #T2 "," #T3 "," #T4 "," #T5 "," #T6 "," #T7 "," #T8 "," #T9 ")"\
+};                                                                            \
+                                                                              \
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+
+
+#endif
+#else
 #ifdef SIMDPP_USE_NULL
 
 
@@ -67,7 +1164,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)()                                     \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)()>(&NAME));                                       \
                                                                               \
@@ -90,7 +1187,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1)                                   \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1)>(&NAME));                                     \
                                                                               \
@@ -113,7 +1210,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2)                                \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2)>(&NAME));                                  \
                                                                               \
@@ -136,7 +1233,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3)                             \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3)>(&NAME));                               \
                                                                               \
@@ -159,7 +1256,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4)                          \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4)>(&NAME));                            \
                                                                               \
@@ -182,7 +1279,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5)                       \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME));                         \
                                                                               \
@@ -205,7 +1302,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6)                    \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                      \
                                                                               \
@@ -228,7 +1325,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7)                 \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                   \
                                                                               \
@@ -251,7 +1348,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8)              \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                \
                                                                               \
@@ -274,7 +1371,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)           \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));             \
                                                                               \
@@ -297,7 +1394,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)()                                        \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)()>(&NAME));                                          \
                                                                               \
@@ -320,7 +1417,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1)                                      \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1)>(&NAME));                                        \
                                                                               \
@@ -343,7 +1440,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2)                                   \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2)>(&NAME));                                     \
                                                                               \
@@ -366,7 +1463,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3)                                \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3)>(&NAME));                                  \
                                                                               \
@@ -389,7 +1486,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4)                             \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4)>(&NAME));                               \
                                                                               \
@@ -412,7 +1509,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5)                          \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME));                            \
                                                                               \
@@ -435,7 +1532,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6)                       \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                         \
                                                                               \
@@ -458,7 +1555,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7)                    \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                      \
                                                                               \
@@ -481,7 +1578,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8)                 \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                   \
                                                                               \
@@ -504,7 +1601,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)              \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));                \
                                                                               \
@@ -521,7 +1618,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)()                                     \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)()>(&NAME));                                       \
                                                                               \
@@ -535,7 +1632,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1)                                   \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1)>(&NAME));                                     \
                                                                               \
@@ -549,7 +1646,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2)                                \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2)>(&NAME));                                  \
                                                                               \
@@ -563,7 +1660,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3)                             \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3)>(&NAME));                               \
                                                                               \
@@ -577,7 +1674,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4)                          \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4)>(&NAME));                            \
                                                                               \
@@ -591,7 +1688,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5)                       \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5)>(&NAME));                         \
                                                                               \
@@ -605,7 +1702,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6)                    \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                      \
                                                                               \
@@ -619,7 +1716,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7)                 \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                   \
                                                                               \
@@ -633,7 +1730,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8)              \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                \
                                                                               \
@@ -647,7 +1744,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)           \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<void(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));             \
                                                                               \
@@ -661,7 +1758,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)()                                        \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)()>(&NAME));                                          \
                                                                               \
@@ -675,7 +1772,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1)                                      \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1)>(&NAME));                                        \
                                                                               \
@@ -689,7 +1786,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2)                                   \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2)>(&NAME));                                     \
                                                                               \
@@ -703,7 +1800,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3)                                \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3)>(&NAME));                                  \
                                                                               \
@@ -717,7 +1814,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4)                             \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4)>(&NAME));                               \
                                                                               \
@@ -731,7 +1828,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5)                          \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5)>(&NAME));                            \
                                                                               \
@@ -745,7 +1842,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6)                       \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6)>(&NAME));                         \
                                                                               \
@@ -759,7 +1856,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7)                    \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7)>(&NAME));                      \
                                                                               \
@@ -773,7 +1870,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8)                 \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8)>(&NAME));                   \
                                                                               \
@@ -787,13 +1884,14 @@ namespace SIMDPP_ARCH_NAMESPACE {                                             \
                                                                               \
 static ::simdpp::detail::DispatchRegistrator<                                 \
         simdpp_ ## NAME ## _tag,R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)              \
-> simdpp_dispatch_registrator_ ## NAME (                                      \
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) (  \
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),                 \
         static_cast<R(*)(T1,T2,T3,T4,T5,T6,T7,T8,T9)>(&NAME));                \
                                                                               \
 } /* namespace SIMDPP_ARCH_NAMESPACE */
 
 
+#endif
 #endif
 /// @}
 
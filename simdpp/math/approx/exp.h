@@ -0,0 +1,51 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_APPROX_EXP_H
+#define LIBSIMDPP_SIMDPP_MATH_APPROX_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/approx.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace approx {
+
+/** Computes an approximation of the base-e exponential of the elements of a
+    floating-point vector.
+
+    @code
+    r0 = approx(exp(a0))
+    ...
+    rN = approx(exp(aN))
+    @endcode
+
+    Computed as approx::exp2<Degree>(a * log2(e)). The maximum relative error
+    is that of @a approx::exp2 plus about |a| * 6e-8 due to the rounding of
+    the product. Results beyond the range of normal numbers are inaccurate.
+    NaN arguments produce NaN.
+*/
+template<unsigned Degree = 3, unsigned N, class E> SIMDPP_INL
+float32<N> exp(const float32<N,E>& a)
+{
+    static_assert(Degree >= 1 && Degree <= 5, "Degree must be between 1 and 5");
+    return detail::math::i_approx_exp<Degree>(a.eval());
+}
+
+} // namespace approx
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
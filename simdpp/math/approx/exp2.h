@@ -0,0 +1,52 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_APPROX_EXP2_H
+#define LIBSIMDPP_SIMDPP_MATH_APPROX_EXP2_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/approx.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace approx {
+
+/** Computes an approximation of the base-2 exponential of the elements of a
+    floating-point vector.
+
+    @code
+    r0 = approx(exp2(a0))
+    ...
+    rN = approx(exp2(aN))
+    @endcode
+
+    @a Degree selects the degree of the polynomial used to approximate the
+    fractional part. The maximum relative error is 3.0e-2, 1.8e-3, 7.5e-5,
+    2.8e-6 and 2.4e-7 for degrees 1 to 5. The arguments are clamped to
+    [-126, 127]; results below the smallest normal number are inaccurate.
+    NaN arguments produce NaN.
+*/
+template<unsigned Degree = 3, unsigned N, class E> SIMDPP_INL
+float32<N> exp2(const float32<N,E>& a)
+{
+    static_assert(Degree >= 1 && Degree <= 5, "Degree must be between 1 and 5");
+    return detail::math::i_approx_exp2<Degree>(a.eval());
+}
+
+} // namespace approx
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
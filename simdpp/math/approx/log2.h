@@ -0,0 +1,53 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_APPROX_LOG2_H
+#define LIBSIMDPP_SIMDPP_MATH_APPROX_LOG2_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/approx.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace approx {
+
+/** Computes an approximation of the base-2 logarithm of the elements of a
+    floating-point vector.
+
+    @code
+    r0 = approx(log2(a0))
+    ...
+    rN = approx(log2(aN))
+    @endcode
+
+    @a Degree selects the degree of the polynomial used to approximate the
+    logarithm of the mantissa. The maximum absolute error is 8.6e-2, 9.9e-3,
+    1.3e-3, 1.8e-4 and 2.9e-5 for degrees 1 to 5. The maximum relative error
+    for arguments between 0.5 and 2 is 1.7e-1, 2.0e-2, 2.6e-3, 3.5e-4 and
+    5.0e-5. The arguments must be positive, finite and normal, otherwise the
+    result is unspecified.
+*/
+template<unsigned Degree = 3, unsigned N, class E> SIMDPP_INL
+float32<N> log2(const float32<N,E>& a)
+{
+    static_assert(Degree >= 1 && Degree <= 5, "Degree must be between 1 and 5");
+    return detail::math::i_approx_log2<Degree>(a.eval());
+}
+
+} // namespace approx
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,49 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_APPROX_SIGMOID_H
+#define LIBSIMDPP_SIMDPP_MATH_APPROX_SIGMOID_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/approx.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace approx {
+
+/** Computes an approximation of the logistic sigmoid function of the
+    elements of a floating-point vector.
+
+    @code
+    r0 = approx(1 / (1 + exp(-a0)))
+    ...
+    rN = approx(1 / (1 + exp(-aN)))
+    @endcode
+
+    The maximum relative error is that of @a approx::exp for the same
+    @a Degree. NaN arguments produce NaN.
+*/
+template<unsigned Degree = 3, unsigned N, class E> SIMDPP_INL
+float32<N> sigmoid(const float32<N,E>& a)
+{
+    static_assert(Degree >= 1 && Degree <= 5, "Degree must be between 1 and 5");
+    return detail::math::i_approx_sigmoid<Degree>(a.eval());
+}
+
+} // namespace approx
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,51 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_APPROX_TANH_H
+#define LIBSIMDPP_SIMDPP_MATH_APPROX_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/approx.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+namespace approx {
+
+/** Computes an approximation of the hyperbolic tangent of the elements of a
+    floating-point vector.
+
+    @code
+    r0 = approx(tanh(a0))
+    ...
+    rN = approx(tanh(aN))
+    @endcode
+
+    The maximum relative error is 4.4e-2, 3.4e-3, 1.3e-4, 1.4e-5 and 1.4e-5
+    for degrees 1 to 5. Arguments with magnitude less than 0.25 are computed
+    using a fixed polynomial regardless of @a Degree. NaN arguments produce
+    NaN.
+*/
+template<unsigned Degree = 3, unsigned N, class E> SIMDPP_INL
+float32<N> tanh(const float32<N,E>& a)
+{
+    static_assert(Degree >= 1 && Degree <= 5, "Degree must be between 1 and 5");
+    return detail::math::i_approx_tanh<Degree>(a.eval());
+}
+
+} // namespace approx
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
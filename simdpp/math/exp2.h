@@ -0,0 +1,54 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_EXP2_H
+#define LIBSIMDPP_SIMDPP_MATH_EXP2_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/exp.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the base-2 exponential of the elements of a floating-point
+    vector.
+
+    @code
+    r0 = exp2(a0)
+    ...
+    rN = exp2(aN)
+    @endcode
+
+    The maximum error is 1 ULP, including subnormal results. Results that
+    overflow saturate to infinity.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> exp2(const float32<N,E>& a)
+{
+    return detail::math::i_exp2(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> exp2(const float64<N,E>& a)
+{
+    return detail::math::i_exp2(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,53 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_LOG_H
+#define LIBSIMDPP_SIMDPP_MATH_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/log.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the natural logarithm of the elements of a floating-point vector.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP. Subnormal arguments are supported. Negative
+    arguments produce NaN, zero produces negative infinity.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> log(const float32<N,E>& a)
+{
+    return detail::math::i_log(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> log(const float64<N,E>& a)
+{
+    return detail::math::i_log(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,54 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_POW_H
+#define LIBSIMDPP_SIMDPP_MATH_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/pow.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Raises the elements of a floating-point vector to the powers given by the
+    elements of another vector.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The maximum error is 1 ULP. The float32 version is computed in double
+    precision. Special values are handled as specified by C99 pow().
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N> pow(const float32<N,E1>& a, const float32<N,E2>& b)
+{
+    return detail::math::i_pow(a.eval(), b.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N> pow(const float64<N,E1>& a, const float64<N,E2>& b)
+{
+    return detail::math::i_pow(a.eval(), b.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,53 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_SIN_H
+#define LIBSIMDPP_SIMDPP_MATH_SIN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/sin_cos.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the sine of the elements of a floating-point vector.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2 ULP for |a| < 6400 (float32) and |a| < 1.6e6
+    (float64). The error is unspecified for larger arguments.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> sin(const float32<N,E>& a)
+{
+    return detail::math::i_sin(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> sin(const float64<N,E>& a)
+{
+    return detail::math::i_sin(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,56 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_SINCOS_H
+#define LIBSIMDPP_SIMDPP_MATH_SINCOS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/sin_cos.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the sine and the cosine of the elements of a floating-point
+    vector. The argument reduction and the polynomial evaluation are shared,
+    thus this is faster than calling @a sin and @a cos separately.
+
+    @code
+    s0 = sin(a0)
+    c0 = cos(a0)
+    ...
+    sN = sin(aN)
+    cN = cos(aN)
+    @endcode
+
+    The accuracy is the same as that of @a sin and @a cos.
+*/
+template<unsigned N, class E> SIMDPP_INL
+void sincos(const float32<N,E>& a, float32<N>& s, float32<N>& c)
+{
+    detail::math::i_sincos(a.eval(), s, c);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+void sincos(const float64<N,E>& a, float64<N>& s, float64<N>& c)
+{
+    detail::math::i_sincos(a.eval(), s, c);
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
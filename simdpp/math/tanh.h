@@ -0,0 +1,52 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_MATH_TANH_H
+#define LIBSIMDPP_SIMDPP_MATH_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/math/tanh.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @{
+/** Computes the hyperbolic tangent of the elements of a floating-point vector.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N> tanh(const float32<N,E>& a)
+{
+    return detail::math::i_tanh(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N> tanh(const float64<N,E>& a)
+{
+    return detail::math::i_tanh(a.eval());
+}
+/// @}
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -62,6 +62,27 @@
     #endif
 #endif
 
+#ifdef SIMDPP_ARCH_X86_SSE4_2
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
 #ifdef SIMDPP_ARCH_X86_AVX
     #ifndef SIMDPP_USE_SSE2
         #define SIMDPP_USE_SSE2 1
@@ -75,6 +96,9 @@
     #ifndef SIMDPP_USE_SSE4_1
         #define SIMDPP_USE_SSE4_1 1
     #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
     #ifndef SIMDPP_USE_AVX
         #define SIMDPP_USE_AVX 1
     #endif
@@ -96,6 +120,9 @@
     #ifndef SIMDPP_USE_SSE4_1
         #define SIMDPP_USE_SSE4_1 1
     #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
     #ifndef SIMDPP_USE_AVX
         #define SIMDPP_USE_AVX 1
     #endif
@@ -107,6 +134,21 @@
     #endif
 #endif
 
+#ifdef SIMDPP_ARCH_X86_F16C
+    #ifndef SIMDPP_USE_F16C
+        #define SIMDPP_USE_F16C 1
+    #endif
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
 #ifdef SIMDPP_ARCH_X86_FMA3
     #ifndef SIMDPP_USE_FMA3
         #define SIMDPP_USE_FMA3 1
@@ -165,6 +207,78 @@
     #ifndef SIMDPP_USE_SSE4_1
         #define SIMDPP_USE_SSE4_1 1
     #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
+    #ifndef SIMDPP_USE_AVX
+        #define SIMDPP_USE_AVX 1
+    #endif
+    #ifndef SIMDPP_USE_AVX2
+        #define SIMDPP_USE_AVX2 1
+    #endif
+    #ifndef SIMDPP_USE_FMA3
+        #define SIMDPP_USE_FMA3 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512
+        #define SIMDPP_USE_AVX512 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_AVX512BW
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
+    #ifndef SIMDPP_USE_AVX
+        #define SIMDPP_USE_AVX 1
+    #endif
+    #ifndef SIMDPP_USE_AVX2
+        #define SIMDPP_USE_AVX2 1
+    #endif
+    #ifndef SIMDPP_USE_FMA3
+        #define SIMDPP_USE_FMA3 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512
+        #define SIMDPP_USE_AVX512 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512BW
+        #define SIMDPP_USE_AVX512BW 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_AVX512DQ
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
     #ifndef SIMDPP_USE_AVX
         #define SIMDPP_USE_AVX 1
     #endif
@@ -177,6 +291,45 @@
     #ifndef SIMDPP_USE_AVX512
         #define SIMDPP_USE_AVX512 1
     #endif
+    #ifndef SIMDPP_USE_AVX512DQ
+        #define SIMDPP_USE_AVX512DQ 1
+    #endif
+    #ifndef SIMDPP_ARCH_NOT_NULL
+        #define SIMDPP_ARCH_NOT_NULL
+    #endif
+#endif
+
+#ifdef SIMDPP_ARCH_X86_AVX512BF16
+    #ifndef SIMDPP_USE_SSE2
+        #define SIMDPP_USE_SSE2 1
+    #endif
+    #ifndef SIMDPP_USE_SSE3
+        #define SIMDPP_USE_SSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSSE3
+        #define SIMDPP_USE_SSSE3 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_1
+        #define SIMDPP_USE_SSE4_1 1
+    #endif
+    #ifndef SIMDPP_USE_SSE4_2
+        #define SIMDPP_USE_SSE4_2 1
+    #endif
+    #ifndef SIMDPP_USE_AVX
+        #define SIMDPP_USE_AVX 1
+    #endif
+    #ifndef SIMDPP_USE_AVX2
+        #define SIMDPP_USE_AVX2 1
+    #endif
+    #ifndef SIMDPP_USE_FMA3
+        #define SIMDPP_USE_FMA3 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512
+        #define SIMDPP_USE_AVX512 1
+    #endif
+    #ifndef SIMDPP_USE_AVX512BF16
+        #define SIMDPP_USE_AVX512BF16 1
+    #endif
     #ifndef SIMDPP_ARCH_NOT_NULL
         #define SIMDPP_ARCH_NOT_NULL
     #endif
@@ -248,6 +401,13 @@
     #define SIMDPP_PP_SSE4_1
 #endif
 
+#ifdef SIMDPP_USE_SSE4_2
+    #define SIMDPP_PP_SSE4_2 _sse4p2
+    #include <nmmintrin.h>
+#else
+    #define SIMDPP_PP_SSE4_2
+#endif
+
 #ifdef SIMDPP_USE_AVX
     #define SIMDPP_PP_AVX _avx
     #include <immintrin.h>
@@ -262,6 +422,13 @@
     #define SIMDPP_PP_AVX2
 #endif
 
+#ifdef SIMDPP_USE_F16C
+    #define SIMDPP_PP_F16C _f16c
+    #include <immintrin.h>
+#else
+    #define SIMDPP_PP_F16C
+#endif
+
 #ifdef SIMDPP_USE_FMA3
     #define SIMDPP_PP_FMA3 _fma3
     #include <immintrin.h>
@@ -293,6 +460,24 @@
     #define SIMDPP_PP_AVX512
 #endif
 
+#ifdef SIMDPP_USE_AVX512BW
+    #define SIMDPP_PP_AVX512BW _avx512bw
+#else
+    #define SIMDPP_PP_AVX512BW
+#endif
+
+#ifdef SIMDPP_USE_AVX512DQ
+    #define SIMDPP_PP_AVX512DQ _avx512dq
+#else
+    #define SIMDPP_PP_AVX512DQ
+#endif
+
+#ifdef SIMDPP_USE_AVX512BF16
+    #define SIMDPP_PP_AVX512BF16 _avx512bf16
+#else
+    #define SIMDPP_PP_AVX512BF16
+#endif
+
 #ifdef SIMDPP_USE_NEON
     #define SIMDPP_PP_NEON _neon
     #include <arm_neon.h>
@@ -355,17 +540,22 @@
 #define SIMDPP_PP_ARCH_CONCAT2  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT1, SIMDPP_PP_SSE3)
 #define SIMDPP_PP_ARCH_CONCAT3  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT2, SIMDPP_PP_SSSE3)
 #define SIMDPP_PP_ARCH_CONCAT4  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT3, SIMDPP_PP_SSE4_1)
-#define SIMDPP_PP_ARCH_CONCAT5  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT4, SIMDPP_PP_AVX)
-#define SIMDPP_PP_ARCH_CONCAT6  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT5, SIMDPP_PP_AVX2)
-#define SIMDPP_PP_ARCH_CONCAT7  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT6, SIMDPP_PP_FMA3)
-#define SIMDPP_PP_ARCH_CONCAT8  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT7, SIMDPP_PP_FMA4)
-#define SIMDPP_PP_ARCH_CONCAT9  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT8, SIMDPP_PP_XOP)
-#define SIMDPP_PP_ARCH_CONCAT10 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT9, SIMDPP_PP_AVX512)
-#define SIMDPP_PP_ARCH_CONCAT11 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT10, SIMDPP_PP_NEON)
-#define SIMDPP_PP_ARCH_CONCAT12 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT11, SIMDPP_PP_NEON_FLT_SP)
-#define SIMDPP_PP_ARCH_CONCAT13 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT12, SIMDPP_PP_ALTIVEC)
-
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_ARCH_CONCAT13
+#define SIMDPP_PP_ARCH_CONCAT5  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT4, SIMDPP_PP_SSE4_2)
+#define SIMDPP_PP_ARCH_CONCAT6  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT5, SIMDPP_PP_AVX)
+#define SIMDPP_PP_ARCH_CONCAT7  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT6, SIMDPP_PP_AVX2)
+#define SIMDPP_PP_ARCH_CONCAT8  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT7, SIMDPP_PP_F16C)
+#define SIMDPP_PP_ARCH_CONCAT9  SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT8, SIMDPP_PP_FMA3)
+#define SIMDPP_PP_ARCH_CONCAT10 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT9, SIMDPP_PP_FMA4)
+#define SIMDPP_PP_ARCH_CONCAT11 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT10, SIMDPP_PP_XOP)
+#define SIMDPP_PP_ARCH_CONCAT12 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT11, SIMDPP_PP_AVX512)
+#define SIMDPP_PP_ARCH_CONCAT13 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT12, SIMDPP_PP_AVX512BW)
+#define SIMDPP_PP_ARCH_CONCAT14 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT13, SIMDPP_PP_AVX512DQ)
+#define SIMDPP_PP_ARCH_CONCAT15 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT14, SIMDPP_PP_AVX512BF16)
+#define SIMDPP_PP_ARCH_CONCAT16 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT15, SIMDPP_PP_NEON)
+#define SIMDPP_PP_ARCH_CONCAT17 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT16, SIMDPP_PP_NEON_FLT_SP)
+#define SIMDPP_PP_ARCH_CONCAT18 SIMDPP_CONCAT(SIMDPP_PP_ARCH_CONCAT17, SIMDPP_PP_ALTIVEC)
+
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_ARCH_CONCAT18
 
 
 
@@ -36,11 +36,15 @@
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/expand_load.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/f_abs.h>
 #include <simdpp/core/f_add.h>
 #include <simdpp/core/f_ceil.h>
 #include <simdpp/core/f_div.h>
+#include <simdpp/core/f_dot_bf16.h>
 #include <simdpp/core/f_floor.h>
 #include <simdpp/core/f_fmadd.h>
 #include <simdpp/core/f_fmsub.h>
@@ -49,20 +53,25 @@
 #include <simdpp/core/f_max.h>
 #include <simdpp/core/f_min.h>
 #include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_nearbyint.h>
 #include <simdpp/core/f_neg.h>
 #include <simdpp/core/f_rcp_e.h>
 #include <simdpp/core/f_rcp_rh.h>
+#include <simdpp/core/f_round.h>
 #include <simdpp/core/f_rsqrt_e.h>
 #include <simdpp/core/f_rsqrt_rh.h>
 #include <simdpp/core/f_sign.h>
 #include <simdpp/core/f_sqrt.h>
 #include <simdpp/core/f_sub.h>
 #include <simdpp/core/f_trunc.h>
+#include <simdpp/core/from_bitmask.h>
+#include <simdpp/core/gather.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
+#include <simdpp/core/i_div.h>
 #include <simdpp/core/i_div_p.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
@@ -90,6 +99,13 @@
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/reduce_add.h>
+#include <simdpp/core/reduce_and.h>
+#include <simdpp/core/reduce_max.h>
+#include <simdpp/core/reduce_min.h>
+#include <simdpp/core/reduce_mul.h>
+#include <simdpp/core/reduce_or.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
@@ -104,6 +120,9 @@
 #include <simdpp/core/store_packed3.h>
 #include <simdpp/core/store_packed4.h>
 #include <simdpp/core/stream.h>
+#include <simdpp/core/to_bitmask.h>
+#include <simdpp/core/to_bfloat16.h>
+#include <simdpp/core/to_float16.h>
 #include <simdpp/core/to_float32.h>
 #include <simdpp/core/to_float64.h>
 #include <simdpp/core/to_int16.h>
@@ -185,6 +204,21 @@
 #include <simdpp/operators/i_shift_r.h>
 #include <simdpp/operators/i_sub.h>
 
+#include <simdpp/math/approx/exp.h>
+#include <simdpp/math/approx/exp2.h>
+#include <simdpp/math/approx/log2.h>
+#include <simdpp/math/approx/sigmoid.h>
+#include <simdpp/math/approx/tanh.h>
+#include <simdpp/math/cos.h>
+#include <simdpp/math/exp.h>
+#include <simdpp/math/exp2.h>
+#include <simdpp/math/log.h>
+#include <simdpp/math/log2.h>
+#include <simdpp/math/pow.h>
+#include <simdpp/math/sin.h>
+#include <simdpp/math/sincos.h>
+#include <simdpp/math/tanh.h>
+
 /** @def SIMDPP_NO_DISPATCHER
     Disables internal dispatching functionality. If the internal dispathcher
     mechanism is not needed, the user can define the @c SIMDPP_NO_DISPATCHER.
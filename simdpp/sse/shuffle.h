@@ -63,6 +63,15 @@ uint16x16 permute_lo(const uint16x16& a)
     return {permute_lo<s0,s1,s2,s3>(a.vec(0)), permute_lo<s0,s1,s2,s3>(a.vec(1))};
 #endif
 }
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
+uint16<32> permute_lo(const uint16<32>& a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_shufflelo_epi16(a, _MM_SHUFFLE(s3, s2, s1, s0));
+}
+#endif
 /// @}
 
 
@@ -107,6 +116,15 @@ uint16x16 permute_hi(const uint16x16& a)
     return {permute_hi<s0,s1,s2,s3>(a.vec(0)), permute_hi<s0,s1,s2,s3>(a.vec(1))};
 #endif
 }
+
+#if SIMDPP_USE_AVX512BW
+template<unsigned s0, unsigned s1, unsigned s2, unsigned s3> SIMDPP_INL
+uint16<32> permute_hi(const uint16<32>& a)
+{
+    static_assert(s0 < 4 && s1 < 4 && s2 < 4 && s3 < 4, "Selector out of range");
+    return _mm512_shufflehi_epi16(a, _MM_SHUFFLE(s3, s2, s1, s0));
+}
+#endif
 /// @}
 
 } // namespace sse
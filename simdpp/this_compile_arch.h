@@ -24,49 +24,78 @@ namespace SIMDPP_ARCH_NAMESPACE {
     @{
 */
 
-/** Returns the instruction set flags that will be required by the currently
-    compiled code
+namespace detail {
+
+/*  The same as this_compile_arch(), but usable in constant expressions. The
+    IFUNC dispatcher uses this to initialize the version records statically,
+    because the resolvers run before any dynamic initialization.
 */
-inline Arch this_compile_arch()
-{
-    Arch res = Arch::NONE_NULL;
+static const std::uint32_t this_compile_arch_bits =
+        static_cast<std::uint32_t>(Arch::NONE_NULL)
 #if SIMDPP_USE_SSE2
-    res |= Arch::X86_SSE2;
+        | static_cast<std::uint32_t>(Arch::X86_SSE2)
 #endif
 #if SIMDPP_USE_SSE3
-    res |= Arch::X86_SSE3;
+        | static_cast<std::uint32_t>(Arch::X86_SSE3)
 #endif
 #if SIMDPP_USE_SSSE3
-    res |= Arch::X86_SSSE3;
+        | static_cast<std::uint32_t>(Arch::X86_SSSE3)
 #endif
 #if SIMDPP_USE_SSE4_1
-    res |= Arch::X86_SSE4_1;
+        | static_cast<std::uint32_t>(Arch::X86_SSE4_1)
+#endif
+#if SIMDPP_USE_SSE4_2
+        | static_cast<std::uint32_t>(Arch::X86_SSE4_2)
 #endif
 #if SIMDPP_USE_AVX
-    res |= Arch::X86_AVX;
+        | static_cast<std::uint32_t>(Arch::X86_AVX)
 #endif
 #if SIMDPP_USE_AVX2
-    res |= Arch::X86_AVX2;
+        | static_cast<std::uint32_t>(Arch::X86_AVX2)
+#endif
+#if SIMDPP_USE_F16C
+        | static_cast<std::uint32_t>(Arch::X86_F16C)
 #endif
 #if SIMDPP_USE_FMA3
-    res |= Arch::X86_FMA3;
+        | static_cast<std::uint32_t>(Arch::X86_FMA3)
 #endif
 #if SIMDPP_USE_FMA4
-    res |= Arch::X86_FMA4;
+        | static_cast<std::uint32_t>(Arch::X86_FMA4)
 #endif
 #if SIMDPP_USE_XOP
-    res |= Arch::X86_XOP;
+        | static_cast<std::uint32_t>(Arch::X86_XOP)
+#endif
+#if SIMDPP_USE_AVX512
+        | static_cast<std::uint32_t>(Arch::X86_AVX512F)
+#endif
+#if SIMDPP_USE_AVX512BW
+        | static_cast<std::uint32_t>(Arch::X86_AVX512BW)
 #endif
-#if SIMDPP_USE_AVX512F
-    res |= Arch::X86_AVX512F;
+#if SIMDPP_USE_AVX512DQ
+        | static_cast<std::uint32_t>(Arch::X86_AVX512DQ)
+#endif
+#if SIMDPP_USE_AVX512BF16
+        | static_cast<std::uint32_t>(Arch::X86_AVX512BF16)
 #endif
 #if SIMDPP_USE_NEON
-    res |= Arch::ARM_NEON;
+        | static_cast<std::uint32_t>(Arch::ARM_NEON)
 #endif
 #if SIMDPP_USE_NEON_FLT_SP
-    res |= Arch::ARM_NEON_FLT_SP;
+        | static_cast<std::uint32_t>(Arch::ARM_NEON_FLT_SP)
+#endif
+#if SIMDPP_USE_NEON64
+        | static_cast<std::uint32_t>(Arch::ARM_NEON64)
 #endif
-    return res;
+        ;
+
+} // namespace detail
+
+/** Returns the instruction set flags that will be required by the currently
+    compiled code
+*/
+inline Arch this_compile_arch()
+{
+    return static_cast<Arch>(detail::this_compile_arch_bits);
 }
 
 /// @} -- end defgroup
@@ -18,8 +18,10 @@
 #include <simdpp/types/any.h>
 #include <simdpp/types/int8x16.h>
 #include <simdpp/types/int8x32.h>
+#include <simdpp/types/int8x64.h>
 #include <simdpp/types/int16x8.h>
 #include <simdpp/types/int16x16.h>
+#include <simdpp/types/int16x32.h>
 #include <simdpp/types/int32x4.h>
 #include <simdpp/types/int32x8.h>
 #include <simdpp/types/int32x16.h>
@@ -32,12 +34,18 @@
 #include <simdpp/types/float64x2.h>
 #include <simdpp/types/float64x4.h>
 #include <simdpp/types/float64x8.h>
+#include <simdpp/types/float16x8.h>
+#include <simdpp/types/float16x16.h>
+#include <simdpp/types/bfloat16x8.h>
+#include <simdpp/types/bfloat16x16.h>
 #include <simdpp/types/int8.h>
 #include <simdpp/types/int16.h>
 #include <simdpp/types/int32.h>
 #include <simdpp/types/int64.h>
 #include <simdpp/types/float32.h>
 #include <simdpp/types/float64.h>
+#include <simdpp/types/float16.h>
+#include <simdpp/types/bfloat16.h>
 #include <simdpp/types/generic.h>
 
 // Used by all types in zero() and ones() as expr_vec_make_const<uint64_t,1>
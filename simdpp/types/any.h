@@ -85,6 +85,41 @@ struct any_float64 : any_vec64<N, V>
     static const uint_element_type all_bits = 0xffffffffffffffff;
 };
 
+/*  Half-precision vectors are storage-only: they can be loaded, stored and
+    converted to and from float32 vectors. The elements are accessed as raw
+    IEEE 754 binary16 bit patterns.
+*/
+template<unsigned N, class V>
+struct any_float16 : any_vec16<N, V>
+{
+    static const unsigned length = N;
+    static const unsigned base_length = SIMDPP_FAST_FLOAT16_SIZE;
+    static const unsigned vec_length = (N + SIMDPP_FAST_FLOAT16_SIZE - 1) / SIMDPP_FAST_FLOAT16_SIZE;
+    using element_type = uint16_t;
+    using uint_element_type = uint16_t;
+    using int_vector_type = int16<N>;
+    using uint_vector_type = uint16<N>;
+    static const unsigned num_bits = 16;
+    static const uint_element_type all_bits = 0xffff;
+};
+
+/*  bfloat16 vectors are storage-only as well. Each element holds the upper 16
+    bits of the corresponding IEEE 754 binary32 value.
+*/
+template<unsigned N, class V>
+struct any_bfloat16 : any_vec16<N, V>
+{
+    static const unsigned length = N;
+    static const unsigned base_length = SIMDPP_FAST_BFLOAT16_SIZE;
+    static const unsigned vec_length = (N + SIMDPP_FAST_BFLOAT16_SIZE - 1) / SIMDPP_FAST_BFLOAT16_SIZE;
+    using element_type = uint16_t;
+    using uint_element_type = uint16_t;
+    using int_vector_type = int16<N>;
+    using uint_vector_type = uint16<N>;
+    static const unsigned num_bits = 16;
+    static const uint_element_type all_bits = 0xffff;
+};
+
 template<unsigned N, class V>
 struct any_int8 : any_vec8<N, V>
 {
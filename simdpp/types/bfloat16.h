@@ -0,0 +1,82 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_BFLOAT16_H
+#define LIBSIMDPP_SIMDPP_TYPES_BFLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/types/any.h>
+#include <simdpp/types/tag.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/types/bfloat16x8.h>
+#include <simdpp/types/bfloat16x16.h>
+#include <simdpp/detail/construct_eval.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @ingroup simd_vec_fp
+/// @{
+
+/** Class representing a @a bfloat16 vector of arbitrary length. The vector
+    always contains at least one native vector. The vector is storage-only: no
+    arithmetic is defined on it.
+*/
+template<unsigned N>
+class bfloat16<N, void> : public any_bfloat16<N, bfloat16<N,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using expr_type = void;
+    using base_vector_type = bfloat16v;
+
+    bfloat16<N>() = default;
+    bfloat16<N>(const bfloat16<N>&) = default;
+    bfloat16<N>& operator=(const bfloat16<N>&) = default;
+
+    template<class V> SIMDPP_INL explicit bfloat16<N>(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<bfloat16<N>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL bfloat16<N>& operator=(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<bfloat16<N>>(d.wrapped().eval()); return *this;
+    }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL bfloat16<N>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL bfloat16<N>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    const bfloat16v& vec(unsigned i) const { return d_[i]; }
+    bfloat16v& vec(unsigned i)             { return d_[i]; }
+
+    bfloat16<N> eval() const { return *this; }
+
+private:
+    bfloat16v d_[bfloat16::vec_length];
+};
+
+/// @} -- end ingroup
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
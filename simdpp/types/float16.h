@@ -0,0 +1,82 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/types/any.h>
+#include <simdpp/types/tag.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/types/float16x8.h>
+#include <simdpp/types/float16x16.h>
+#include <simdpp/detail/construct_eval.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @ingroup simd_vec_fp
+/// @{
+
+/** Class representing a @a float16 vector of arbitrary length. The vector
+    always contains at least one native vector. The vector is storage-only: no
+    arithmetic is defined on it.
+*/
+template<unsigned N>
+class float16<N, void> : public any_float16<N, float16<N,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using expr_type = void;
+    using base_vector_type = float16v;
+
+    float16<N>() = default;
+    float16<N>(const float16<N>&) = default;
+    float16<N>& operator=(const float16<N>&) = default;
+
+    template<class V> SIMDPP_INL explicit float16<N>(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<float16<N>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL float16<N>& operator=(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<float16<N>>(d.wrapped().eval()); return *this;
+    }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL float16<N>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL float16<N>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    const float16v& vec(unsigned i) const { return d_[i]; }
+    float16v& vec(unsigned i)             { return d_[i]; }
+
+    float16<N> eval() const { return *this; }
+
+private:
+    float16v d_[float16::vec_length];
+};
+
+/// @} -- end ingroup
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
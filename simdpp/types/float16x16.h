@@ -0,0 +1,99 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT16X16_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT16X16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/construct_eval.h>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512 || SIMDPP_DOXYGEN
+
+/// @ingroup simd_vec_fp
+/// @{
+
+/** Class representing float16x16 vector. The vector is storage-only: no
+    arithmetic is defined on it.
+*/
+template<>
+class float16<16, void> : public any_float16<16, float16<16,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using base_vector_type = float16<16,void>;
+    using expr_type = void;
+
+#if SIMDPP_USE_AVX512
+    using native_type = __m256i;
+#endif
+
+    float16<16>() = default;
+    float16<16>(const float16<16> &) = default;
+    float16<16> &operator=(const float16<16> &) = default;
+
+    template<class V> SIMDPP_INL explicit float16<16>(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<float16<16>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL float16<16>& operator=(const any_vec<32,V>& d)
+    {
+        *this = bit_cast<float16<16>>(d.wrapped().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    float16<16>(const native_type& d) : d_(d) {}
+    float16<16>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL float16<16>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL float16<16>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const float16<16>& vec(unsigned) const { return *this; }
+          float16<16>& vec(unsigned)       { return *this; }
+    /// @}
+
+    float16<16> eval() const { return *this; }
+
+private:
+    native_type d_;
+};
+
+/// @} -- end ingroup
+
+#endif // SIMDPP_USE_AVX512 || SIMDPP_DOXYGEN
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
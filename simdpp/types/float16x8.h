@@ -0,0 +1,110 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT16X8_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT16X8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/construct_eval.h>
+#include <simdpp/detail/array.h>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+/// @ingroup simd_vec_fp
+/// @{
+
+/** Class representing float16x8 vector. The vector is storage-only: no
+    arithmetic is defined on it. Use to_float32() and to_float16() to convert
+    to and from float32 vectors.
+*/
+template<>
+class float16<8, void> : public any_float16<8, float16<8,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_FLOAT;
+    using base_vector_type = float16<8,void>;
+    using expr_type = void;
+
+#if SIMDPP_USE_SSE2
+    using native_type = __m128i;
+#elif SIMDPP_USE_NEON
+    using native_type = uint16x8_t;
+#elif SIMDPP_USE_ALTIVEC
+    using native_type = __vector uint16_t;
+#else
+    using native_type = detail::array<uint16_t, 8>;
+#endif
+
+    float16<8>() = default;
+    float16<8>(const float16<8> &) = default;
+    float16<8> &operator=(const float16<8> &) = default;
+
+    template<class V> SIMDPP_INL explicit float16<8>(const any_vec<16,V>& d)
+    {
+        *this = bit_cast<float16<8>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL float16<8>& operator=(const any_vec<16,V>& d)
+    {
+        *this = bit_cast<float16<8>>(d.wrapped().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    float16<8>(const native_type& d) : d_(d) {}
+    float16<8>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL float16<8>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL float16<8>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const float16<8>& vec(unsigned) const { return *this; }
+          float16<8>& vec(unsigned)       { return *this; }
+    /// @}
+
+    float16<8> eval() const { return *this; }
+
+#if SIMDPP_USE_NULL && !SIMDPP_DOXYGEN
+    /// For internal use only
+    const uint16_t& el(unsigned i) const  { return d_[i]; }
+          uint16_t& el(unsigned i)        { return d_[i]; }
+#endif
+
+private:
+    native_type d_;
+};
+
+/// @} -- end ingroup
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
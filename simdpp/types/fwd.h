@@ -43,6 +43,16 @@ using float64x4 = float64<4>;
 using mask_float64x2 = mask_float64<2>;
 using mask_float64x4 = mask_float64<4>;
 
+template<unsigned N, class E = void> class float16;
+
+using float16x8 = float16<8>;
+using float16x16 = float16<16>;
+
+template<unsigned N, class E = void> class bfloat16;
+
+using bfloat16x8 = bfloat16<8>;
+using bfloat16x16 = bfloat16<16>;
+
 template<unsigned N, class E = void> class int8;
 template<unsigned N, class E = void> class uint8;
 template<unsigned N, class E = void> class mask_int8;
@@ -99,6 +109,19 @@ using mask_int64x4 = mask_int64<4>;
 #endif
 
 #if SIMDPP_USE_AVX512
+#define SIMDPP_FAST_FLOAT16_SIZE 16
+#define SIMDPP_FAST_BFLOAT16_SIZE 16
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_NULL
+#define SIMDPP_FAST_FLOAT16_SIZE 8
+#define SIMDPP_FAST_BFLOAT16_SIZE 8
+#endif
+
+#if SIMDPP_USE_AVX512BW
+#define SIMDPP_FAST_INT8_SIZE 64
+#define SIMDPP_FAST_INT16_SIZE 32
+#define SIMDPP_FAST_INT32_SIZE 16
+#define SIMDPP_FAST_INT64_SIZE 8
+#elif SIMDPP_USE_AVX512
 #define SIMDPP_FAST_INT8_SIZE 32
 #define SIMDPP_FAST_INT16_SIZE 16
 #define SIMDPP_FAST_INT32_SIZE 16
@@ -119,6 +142,8 @@ using float32v =           float32<SIMDPP_FAST_FLOAT32_SIZE>;
 using mask_float32v = mask_float32<SIMDPP_FAST_FLOAT32_SIZE>;
 using float64v =           float64<SIMDPP_FAST_FLOAT64_SIZE>;
 using mask_float64v = mask_float64<SIMDPP_FAST_FLOAT64_SIZE>;
+using float16v =           float16<SIMDPP_FAST_FLOAT16_SIZE>;
+using bfloat16v =         bfloat16<SIMDPP_FAST_BFLOAT16_SIZE>;
 
 using int8v =           int8<SIMDPP_FAST_INT8_SIZE>;
 using uint8v =         uint8<SIMDPP_FAST_INT8_SIZE>;
@@ -139,6 +164,8 @@ using mask_int64v = mask_int64<SIMDPP_FAST_INT64_SIZE>;
 using mask_float32v2 = mask_float32<SIMDPP_FAST_FLOAT32_SIZE*2>;
 using float64v2 =           float64<SIMDPP_FAST_FLOAT64_SIZE*2>;
 using mask_float64v2 = mask_float64<SIMDPP_FAST_FLOAT64_SIZE*2>;
+using float16v2 =           float16<SIMDPP_FAST_FLOAT16_SIZE*2>;
+using bfloat16v2 =         bfloat16<SIMDPP_FAST_BFLOAT16_SIZE*2>;
 
 using int8v2 =           int8<SIMDPP_FAST_INT8_SIZE*2>;
 using uint8v2 =         uint8<SIMDPP_FAST_INT8_SIZE*2>;
@@ -161,6 +188,8 @@ using float32v4 =           float32<SIMDPP_FAST_FLOAT32_SIZE*4>;
 using mask_float32v4 = mask_float32<SIMDPP_FAST_FLOAT32_SIZE*4>;
 using float64v4 =           float64<SIMDPP_FAST_FLOAT64_SIZE*4>;
 using mask_float64v4 = mask_float64<SIMDPP_FAST_FLOAT64_SIZE*4>;
+using float16v4 =           float16<SIMDPP_FAST_FLOAT16_SIZE*4>;
+using bfloat16v4 =         bfloat16<SIMDPP_FAST_BFLOAT16_SIZE*4>;
 
 using int8v4 =           int8<SIMDPP_FAST_INT8_SIZE*4>;
 using uint8v4 =         uint8<SIMDPP_FAST_INT8_SIZE*4>;
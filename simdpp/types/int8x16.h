@@ -187,7 +187,7 @@ template<>
 class mask_int8<16, void> : public any_int8<16, mask_int8<16,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
-    using base_vector_type = mask_int16v;
+    using base_vector_type = mask_int8<16,void>;
     using expr_type = void;
 
 #if SIMDPP_USE_SSE2
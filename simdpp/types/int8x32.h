@@ -162,7 +162,7 @@ template<>
 class mask_int8<32, void> : public any_int8<32, mask_int8<32,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
-    using base_vector_type = mask_int16v;
+    using base_vector_type = mask_int8<32,void>;
     using expr_type = void;
 
 #if SIMDPP_USE_AVX2
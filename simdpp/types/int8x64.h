@@ -0,0 +1,206 @@
+/*  Copyright (C) 2012-2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_INT8X64_H
+#define LIBSIMDPP_SIMDPP_TYPES_INT8X64_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/detail/construct_eval.h>
+#include <cstdint>
+
+namespace simdpp {
+#ifndef SIMDPP_DOXYGEN
+namespace SIMDPP_ARCH_NAMESPACE {
+#endif
+
+#if SIMDPP_USE_AVX512BW || SIMDPP_DOXYGEN
+
+/// @ingroup simd_vec_int
+/// @{
+
+/** Class representing 64x 8-bit signed integer vector
+*/
+template<>
+class int8<64, void> : public any_int8<64, int8<64,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_INT;
+    using element_type = int8_t;
+    using base_vector_type = int8<64>;
+    using expr_type = void;
+
+#if SIMDPP_USE_AVX512BW
+    using native_type = __m512i;
+#endif
+
+    int8<64>() = default;
+    int8<64>(const int8<64> &) = default;
+    int8<64> &operator=(const int8<64> &) = default;
+
+    template<class E> SIMDPP_INL int8<64>(const int8<64,E>& d) { *this = d.eval(); }
+    template<class E> SIMDPP_INL int8<64>(const uint8<64,E>& d) { *this = d.eval(); }
+    template<class V> SIMDPP_INL explicit int8<64>(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<int8<64>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL int8<64>& operator=(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<int8<64>>(d.wrapped().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    int8<64>(const native_type& d) : d_(d) {}
+    int8<64>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL int8<64>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL int8<64>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const int8<64>& vec(unsigned) const { return *this; }
+          int8<64>& vec(unsigned)       { return *this; }
+    /// @}
+
+    int8<64> eval() const { return *this; }
+
+    static int8<64> zero() { return detail::make_zero(); }
+    static int8<64> ones() { return detail::make_ones(); }
+
+private:
+    native_type d_;
+};
+
+/** Class representing 64x 8-bit unsigned integer vector
+*/
+template<>
+class uint8<64, void> : public any_int8<64, uint8<64,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_UINT;
+    using element_type = uint8_t;
+    using base_vector_type = uint8<64>;
+    using expr_type = void;
+
+#if SIMDPP_USE_AVX512BW
+    using native_type = __m512i;
+#endif
+
+    uint8<64>() = default;
+    uint8<64>(const uint8<64> &) = default;
+    uint8<64> &operator=(const uint8<64> &) = default;
+
+    template<class E> SIMDPP_INL uint8<64>(const uint8<64,E>& d) { *this = d.eval(); }
+    template<class E> SIMDPP_INL uint8<64>(const int8<64,E>& d) { *this = d.eval(); }
+    template<class V> SIMDPP_INL explicit uint8<64>(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<uint8<64>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL uint8<64>& operator=(const any_vec<64,V>& d)
+    {
+        *this = bit_cast<uint8<64>>(d.wrapped().eval()); return *this;
+    }
+
+    /// @{
+    /// Construct from the underlying vector type
+    uint8<64>(const native_type& d) : d_(d) {}
+    uint8<64>& operator=(const native_type& d) { d_ = d; return *this; }
+    /// @}
+
+    /// Convert to the underlying vector type
+    operator native_type() const { return d_; }
+
+#ifndef SIMDPP_DOXYGEN
+    template<class E> SIMDPP_INL uint8<64>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL uint8<64>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+#endif
+
+    /// @{
+    /// Access base vectors
+    const uint8<64>& vec(unsigned) const { return *this; }
+          uint8<64>& vec(unsigned)       { return *this; }
+    /// @}
+
+    uint8<64> eval() const { return *this; }
+
+    static uint8<64> zero() { return detail::make_zero(); }
+    static uint8<64> ones() { return detail::make_ones(); }
+
+private:
+    native_type d_;
+};
+
+/// Class representing possibly optimized mask data for 64x 8-bit integer
+/// vector
+template<>
+class mask_int8<64, void> : public any_int8<64, mask_int8<64,void>> {
+public:
+    static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
+    using base_vector_type = mask_int8<64,void>;
+    using expr_type = void;
+
+#if SIMDPP_USE_AVX512BW
+    using native_type = __mmask64;
+#endif
+
+    mask_int8<64>() = default;
+    mask_int8<64>(const mask_int8<64> &) = default;
+    mask_int8<64> &operator=(const mask_int8<64> &) = default;
+
+    mask_int8<64>(const native_type& d) : d_(d) {}
+
+    operator native_type() const { return d_; }
+
+    /// Access the underlying type
+    uint8<64> unmask() const
+    {
+    #if SIMDPP_USE_AVX512BW
+        return _mm512_maskz_set1_epi8(d_, 0xff);
+    #endif
+    }
+
+    const mask_int8<64>& vec(unsigned) const { return *this; }
+          mask_int8<64>& vec(unsigned)       { return *this; }
+
+    mask_int8<64> eval() const { return *this; }
+
+private:
+    native_type d_;
+};
+
+/// @} -- end ingroup
+
+#endif // SIMDPP_USE_AVX512BW || SIMDPP_DOXYGEN
+
+#ifndef SIMDPP_DOXYGEN
+} // namespace SIMDPP_ARCH_NAMESPACE
+#endif
+} // namespace simdpp
+
+#endif
@@ -25,6 +25,8 @@ struct is_vector : std::false_type {};
 
 template<unsigned N, class E> struct is_vector<float32<N,E>>   : std::true_type {};
 template<unsigned N, class E> struct is_vector<float64<N,E>>   : std::true_type {};
+template<unsigned N, class E> struct is_vector<float16<N,E>>   : std::true_type {};
+template<unsigned N, class E> struct is_vector<bfloat16<N,E>>  : std::true_type {};
 template<unsigned N, class E> struct is_vector<int8<N,E>>      : std::true_type {};
 template<unsigned N, class E> struct is_vector<int16<N,E>>     : std::true_type {};
 template<unsigned N, class E> struct is_vector<int32<N,E>>     : std::true_type {};
@@ -46,6 +48,8 @@ struct is_value_vector : std::false_type {};
 
 template<unsigned N> struct is_value_vector<float32<N>>         : std::true_type {};
 template<unsigned N> struct is_value_vector<float64<N>>         : std::true_type {};
+template<unsigned N> struct is_value_vector<float16<N>>         : std::true_type {};
+template<unsigned N> struct is_value_vector<bfloat16<N>>        : std::true_type {};
 template<unsigned N> struct is_value_vector<int8<N>>            : std::true_type {};
 template<unsigned N> struct is_value_vector<int16<N>>           : std::true_type {};
 template<unsigned N> struct is_value_vector<int32<N>>           : std::true_type {};
@@ -30,6 +30,8 @@ void test_compare_n(TestSuite& tc)
     using int16_n = int16<B/2>;
     using uint32_n = uint32<B/4>;
     using int32_n = int32<B/4>;
+    using uint64_n = uint64<B/8>;
+    using int64_n = int64<B/8>;
     using float32_n = float32<B/4>;
     using float64_n = float64<B/8>;
 
@@ -84,7 +86,36 @@ void test_compare_n(TestSuite& tc)
         TEST_COMPARE_TESTER_HELPER(tc, uint32_n, sl, sr);
     }
 
-    //int64_n not available
+    //int64_n
+    {
+        uint64_n sl[] = {
+            (uint64_n) make_uint(0x1111111111111111, 0x2222222222222222),
+            (uint64_n) make_uint(0x3333333333333333, 0x2222222222222223),
+            (uint64_n) make_uint(0xdddddddddddddddd, 0xffffffffffffffff),
+            (uint64_n) make_uint(0x0000000100000000, 0x00000000ffffffff),
+            (uint64_n) make_uint(0x8000000000000000, 0x7fffffffffffffff),
+            (uint64_n) make_uint(0x0000000000000000, 0x0000000000000001),
+            (uint64_n) make_uint(0x2222222211111111, 0x1111111122222222),
+            (uint64_n) make_uint(0xffffffff00000000, 0x00000000ffffffff),
+        };
+        uint64_n sr[] = {
+            (uint64_n) make_uint(0x2222222222222222, 0x2222222222222222),
+            (uint64_n) make_uint(0x2222222222222222, 0x2222222222222222),
+            (uint64_n) make_uint(0xeeeeeeeeeeeeeeee, 0xeeeeeeeeeeeeeeee),
+            (uint64_n) make_uint(0x00000000ffffffff, 0x0000000100000000),
+            (uint64_n) make_uint(0x7fffffffffffffff, 0x8000000000000000),
+            (uint64_n) make_uint(0xffffffffffffffff, 0xffffffffffffffff),
+            (uint64_n) make_uint(0x1111111122222222, 0x2222222211111111),
+            (uint64_n) make_uint(0x00000000ffffffff, 0xffffffff00000000),
+        };
+
+        TEST_COMPARE_TESTER_HELPER(tc, int64_n, sl, sr);
+        TEST_COMPARE_TESTER_HELPER(tc, uint64_n, sl, sr);
+        TEST_ARRAY_HELPER2(tc, int64_n, cmp_le, sl, sr);
+        TEST_ARRAY_HELPER2(tc, int64_n, cmp_ge, sl, sr);
+        TEST_ARRAY_HELPER2(tc, uint64_n, cmp_le, sl, sr);
+        TEST_ARRAY_HELPER2(tc, uint64_n, cmp_ge, sl, sr);
+    }
 
     float nanf = std::numeric_limits<float>::quiet_NaN();
     double nan = std::numeric_limits<double>::quiet_NaN();
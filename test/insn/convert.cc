@@ -26,13 +26,15 @@ void test_convert_n(TestSuite& ts)
     using  int32_n = int32<B/4>;
     //using uint32_2n = uint32<B/2>;
     using  int32_2n = int32<B/2>;
-    //using uint64_n = uint64<B/8>;
-    //using  int64_n = int64<B/8>;
+    using uint64_n = uint64<B/8>;
+    using  int64_n = int64<B/8>;
     //using uint64_2n = uint64<B/4>;
     using  int64_2n = int64<B/4>;
     using float32_n =  float32<B/4>;
-    //using float32_2n = float32<B/2>;
-    //using float64_n =  float64<B/8>;
+    using float32_2n = float32<B/2>;
+    using float16_2n = float16<B/2>;
+    using bfloat16_2n = bfloat16<B/2>;
+    using float64_n =  float64<B/8>;
     using float64_2n = float64<B/4>;
 
     //int8
@@ -78,6 +80,29 @@ void test_convert_n(TestSuite& ts)
 
     TEST_ARRAY_HELPER1_T(ts, float32_n,  int32_n, to_float32, sf);
     TEST_ARRAY_HELPER1_T(ts, float64_2n, int32_n, to_float64, sf);
+
+    uint32_n su[] = {
+        make_uint(0, 1, 100, 0xffff),
+        make_uint(0x10000, 0x7fffffff, 0x80000000, 0x80000001),
+        make_uint(0xfffffffe, 0xffffffff, 0xffffff7f, 0xffffff80),
+        make_uint(16777217, 16777219, 0x87654321, 0x12345678),
+    };
+    TEST_ARRAY_HELPER1_T(ts, float32_n, uint32_n, to_float32, su);
+    }
+
+    //int64
+    {
+    int64_n s[] = {
+        make_int(0, 1),
+        make_int(-1, -100),
+        make_int(9007199254740993, -9007199254740993),
+        make_int(0x7fffffffffffffff, 0x8000000000000000),
+        make_int(0x123456789abcdef0, -0x123456789abcdef0),
+        make_int(0x0000000080000001, -0x0000000080000001),
+        make_int(0x7ffffffffffffdff, 0x7ffffffffffffe00),
+    };
+    TEST_ARRAY_HELPER1_T(ts, float64_n,  int64_n, to_float64, s);
+    TEST_ARRAY_HELPER1_T(ts, float64_n, uint64_n, to_float64, s);
     }
 
     //float32
@@ -95,6 +120,68 @@ void test_convert_n(TestSuite& ts)
     };
 
     TEST_ARRAY_HELPER1_T(ts, int32_n, float32_n, to_int32, sf);
+
+    float32_n sr[] = {
+        make_float(0.5, -0.5, 1.5, -1.5),
+        make_float(2.5, -2.5, 1.7, -1.7),
+        make_float(63100001.0, -63100003.0, 0.49999997, -0.49999997),
+    };
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float32_n, to_int32, sr);
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float32_n, to_int32_round, sr);
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float32_n, to_int32_round, sf);
+
+    float32_n su[] = {
+        make_float(0.0, 0.5, 1.0, 1.9),
+        make_float(100.0, 2147483520.0, 2147483648.0, 2147483904.0),
+        make_float(4294967040.0, 3000000000.5, 63100000.0, 63100003.0),
+    };
+    TEST_ARRAY_HELPER1_T(ts, uint32_n, float32_n, to_uint32, su);
+    }
+
+    //float16
+    {
+    uint16_n sh[] = {
+        make_uint(0x0000, 0x8000, 0x3c00, 0xbc00),  // 0.0, -0.0, 1.0, -1.0
+        make_uint(0x3555, 0x7bff, 0xfbff, 0x0400),  // 0.333, max, -max, min normal
+        make_uint(0x0001, 0x03ff, 0x8001, 0x83ff),  // denormals
+        make_uint(0x7c00, 0xfc00, 0x7e00, 0x7c01),  // inf, -inf, qnan, snan
+        make_uint(0xfe00, 0x7fff, 0x4248, 0xc248),
+    };
+    TEST_ARRAY_HELPER1_T(ts, float32_2n, float16_2n, to_float32, sh);
+
+    float32_2n sf[] = {
+        make_float(1.0, -1.0, 0.1, -0.1),
+        make_float(65504.0, 65519.0, 65520.0, -1e10),
+        make_float(6.1035156e-05, 6.0975552e-05, 5.9604645e-08, 2.9802322e-08),
+        make_float(1.00048828125, 1.00146484375, -2.00390625, 3.0517578e-05),
+    };
+    ts.reset_seq();
+    for (unsigned i = 0; i < sizeof(sf) / sizeof(float32_2n); ++i) {
+        TEST_PUSH(ts, uint16_n, to_float16(sf[i]));
+    }
+    }
+
+    //bfloat16
+    {
+    uint16_n sh[] = {
+        make_uint(0x0000, 0x8000, 0x3f80, 0xbf80),  // 0.0, -0.0, 1.0, -1.0
+        make_uint(0x7f7f, 0xff7f, 0x0080, 0x0001),  // max, -max, min normal, denormal
+        make_uint(0x7f80, 0xff80, 0x7fc0, 0x7f81),  // inf, -inf, qnan, snan
+    };
+    TEST_ARRAY_HELPER1_T(ts, float32_2n, bfloat16_2n, to_float32, sh);
+
+    // denormal results are avoided as they are flushed on some architectures
+    float32_2n sf[] = {
+        make_float(1.0, -1.0, 0.1, -0.1),
+        make_float(1.00390625, 1.01171875, 1.005859375, -3.0e38),
+        make_float(3.4e38, 3.3961776e38, 1.1754944e-38, -1e10),
+        make_float(1.0078125, 1.0038909912109375, -2.0234375, 3.0517578e-05),
+    };
+    ts.reset_seq();
+    for (unsigned i = 0; i < sizeof(sf) / sizeof(float32_2n); ++i) {
+        TEST_PUSH(ts, uint16_n, to_bfloat16(sf[i]));
+        TEST_PUSH(ts, uint16_n, to_bfloat16_trunc(sf[i]));
+    }
     }
 
     //float64
@@ -112,15 +199,83 @@ void test_convert_n(TestSuite& ts)
     };
 
     TEST_ARRAY_HELPER1_T(ts, int32_n, float64_2n, to_int32, sf);
+
+    float64_2n sr[] = {
+        make_float(0.5, -0.5),
+        make_float(1.5, -1.5),
+        make_float(2.5, -2.5),
+        make_float(1.7, -1.7),
+        make_float(2147483646.5, -2147483647.5),
+    };
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float64_2n, to_int32, sr);
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float64_2n, to_int32_round, sr);
+    TEST_ARRAY_HELPER1_T(ts, int32_n, float64_2n, to_int32_round, sf);
+
+    float64_n sl[] = {
+        make_float(0.0, -0.0),
+        make_float(0.5, -0.5),
+        make_float(1.0, -1.9),
+        make_float(4294967295.5, -4294967296.5),
+        make_float(9007199254740991.0, -9007199254740992.0),
+        make_float(1e18, -1e18),
+        make_float(9223372036854774784.0, -9223372036854775808.0),
+    };
+    TEST_ARRAY_HELPER1_T(ts, int64_n, float64_n, to_int64, sl);
+    }
+}
+
+/*  The masks are created from a set of bit patterns and converted back. The
+    patterns are truncated to the number of elements in the vector.
+*/
+template<class V>
+void test_bitmask_type(TestSuite& ts)
+{
+    using namespace simdpp;
+    using M = typename V::mask_vector_type;
+    using E = typename V::element_type;
+
+    const uint64_t patterns[] = {
+        0, 1, 0x5555555555555555, 0xaaaaaaaaaaaaaaaa,
+        0x8000000000000001, 0x0123456789abcdef, 0xffffffffffffffff
+    };
+    SIMDPP_ALIGN(64) E mdata[V::length];
+
+    for (uint64_t bits : patterns) {
+        M m = from_bitmask<M>(bits);
+        TEST_PUSH(ts, V, V(m.unmask()));
+        TEST_PUSH(ts, uint64_t, to_bitmask(m));
+
+        // masks produced by comparisons
+        for (unsigned i = 0; i < V::length; ++i) {
+            mdata[i] = ((bits >> i) & 1) ? E(1) : E(0);
+        }
+        V v = load(mdata);
+        TEST_PUSH(ts, uint64_t, to_bitmask(cmp_eq(v, (V) splat(1))));
     }
 }
 
+template<unsigned B>
+void test_bitmask_n(TestSuite& ts)
+{
+    using namespace simdpp;
+
+    test_bitmask_type<uint8<B>>(ts);
+    test_bitmask_type<uint16<B/2>>(ts);
+    test_bitmask_type<uint32<B/4>>(ts);
+    test_bitmask_type<uint64<B/8>>(ts);
+    test_bitmask_type<float32<B/4>>(ts);
+    test_bitmask_type<float64<B/8>>(ts);
+}
+
 void test_convert(TestResults& res)
 {
     TestSuite& ts = NEW_TEST_SUITE(res, "convert");
     test_convert_n<16>(ts);
     test_convert_n<32>(ts);
     test_convert_n<64>(ts);
+    test_bitmask_n<16>(ts);
+    test_bitmask_n<32>(ts);
+    test_bitmask_n<64>(ts);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -14,3 +14,5 @@ int test_dispatcher1(int arg);
 int test_dispatcher2(int arg, int arg2);
 int test_dispatcher3(int arg, int arg2, int arg3);
 int test_dispatcher4(int arg, int arg2, int arg3, int arg4);
+int test_dispatcher_overload(int arg);
+float test_dispatcher_overload(float arg);
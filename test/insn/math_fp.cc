@@ -67,7 +67,35 @@ void test_math_fp_n(TestSuite& tc, TestSuite& ts_fma)
         TEST_ALL_COMB_HELPER2(tc, float32_n, min, snan, 4);
         TEST_ALL_COMB_HELPER2(tc, float32_n, max, snan, 4);
 
-
+        float32_n sr[] = {
+            (float32_n) make_float(0.0f, -0.0f, 0.3f, -0.3f),
+            (float32_n) make_float(0.5f, -0.5f, 1.5f, -1.5f),
+            (float32_n) make_float(2.5f, -2.5f, 0.49999997f, -0.49999997f),
+            (float32_n) make_float(1.7f, -1.7f, 100.25f, -100.75f),
+            (float32_n) make_float(4194304.5f, -4194304.5f, 8388607.5f, -8388607.5f),
+            (float32_n) make_float(67500001.0f, -67500002.0f, 1e20f, -1e20f),
+            (float32_n) make_float(nanf, -nanf, inff, -inff),
+        };
+        TEST_ARRAY_HELPER1(tc, float32_n, trunc, sr);
+        TEST_ARRAY_HELPER1(tc, float32_n, round, sr);
+        TEST_ARRAY_HELPER1(tc, float32_n, nearbyint, sr);
+
+        // bfloat16 pairs; denormals are avoided as they are flushed on some
+        // architectures
+        uint16<B/2> sb[] = {
+            make_uint(0x3f80, 0x4000, 0xbf80, 0x4040),  // 1, 2, -1, 3
+            make_uint(0x3fc0, 0xc2c8, 0x4b00, 0x3eab),  // 1.5, -100, 2^23, 0.334
+            make_uint(0x0000, 0x8000, 0x3f81, 0xbf81),
+            make_uint(0x7f80, 0x3f80, 0x7fc0, 0xff80),  // inf, 1, nan, -inf
+        };
+        tc.reset_seq();
+        for (unsigned i = 0; i < sizeof(sb) / sizeof(sb[0]); ++i) {
+            for (unsigned j = 0; j < sizeof(sb) / sizeof(sb[0]); ++j) {
+                TEST_PUSH(tc, float32_n, dot_bf16(bfloat16<B/2>(sb[i]),
+                                                  bfloat16<B/2>(sb[j]),
+                                                  s[(i + j) % 8]));
+            }
+        }
     }
 
     // Vectors with 64-bit floating-point elements
@@ -115,6 +143,23 @@ void test_math_fp_n(TestSuite& tc, TestSuite& ts_fma)
         };
         TEST_ALL_COMB_HELPER2(tc, float64_n, min, snan, 8);
         TEST_ALL_COMB_HELPER2(tc, float64_n, max, snan, 8);
+
+        float64_n sr[] = {
+            (float64_n) make_float(0.0, -0.0),
+            (float64_n) make_float(0.3, -0.3),
+            (float64_n) make_float(0.5, -0.5),
+            (float64_n) make_float(1.5, -1.5),
+            (float64_n) make_float(2.5, -2.5),
+            (float64_n) make_float(0.49999999999999994, -0.49999999999999994),
+            (float64_n) make_float(1.7, -100.75),
+            (float64_n) make_float(2251799813685248.5, -2251799813685248.5),
+            (float64_n) make_float(4503599627370495.5, -4503599627370495.5),
+            (float64_n) make_float(9007199254740993.0, -1e300),
+            (float64_n) make_float(nan, -inf),
+        };
+        TEST_ARRAY_HELPER1(tc, float64_n, trunc, sr);
+        TEST_ARRAY_HELPER1(tc, float64_n, round, sr);
+        TEST_ARRAY_HELPER1(tc, float64_n, nearbyint, sr);
     }
 }
 
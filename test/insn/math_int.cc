@@ -180,17 +180,116 @@ void test_math_int_n(TestSuite& tc)
         TEST_ALL_COMB_HELPER2(tc, uint64_n, add, s, 2);
         TEST_ALL_COMB_HELPER2(tc, uint64_n, sub, s, 2);
 
+        TEST_ALL_COMB_HELPER2(tc, int64_n, min, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, int64_n, max, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, uint64_n, min, s, 2);
+        TEST_ALL_COMB_HELPER2(tc, uint64_n, max, s, 2);
+
         TEST_ARRAY_HELPER1(tc, int64_n, neg, s);
         TEST_ARRAY_HELPER1(tc, int64_n, abs, s);
     }
 }
 
+/*  Checks the results of the division by @a d against the scalar division.
+    Two's complement wraparound is assumed for the quotient of the most
+    negative number divided by -1.
+*/
+template<class V>
+void test_divider_check(TestSuite& tc, unsigned line, const V& a,
+                        typename V::element_type d, const V& q, const V& r)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using W = typename std::conditional<std::is_signed<E>::value,
+                                        int64_t, uint64_t>::type;
+    // signed vectors wider than the native vector can't be stored directly
+    using U = typename std::conditional<sizeof(E) == 2, uint16<V::length>,
+                                        uint32<V::length>>::type;
+    SIMDPP_ALIGN(64) E adata[V::length];
+    SIMDPP_ALIGN(64) E qdata[V::length];
+    SIMDPP_ALIGN(64) E rdata[V::length];
+    store(adata, U(a));
+    store(qdata, U(q));
+    store(rdata, U(r));
+    for (unsigned i = 0; i < V::length; ++i) {
+        W wq = W(adata[i]) / W(d);
+        W wr = W(adata[i]) % W(d);
+        tc.add_check(qdata[i] == E(wq) && rdata[i] == E(wr), line);
+    }
+}
+
+template<class V>
+void test_divider_type(TestSuite& tc, const typename V::element_type* divisors,
+                       unsigned count)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    V s[] = {
+        (V) make_uint(0, 1, 2, 3),
+        (V) make_uint(6, 7, 8, 9),
+        (V) make_uint(99, 100, 101, 641),
+        (V) make_int(-1, -2, -7, -100),
+        (V) make_uint(0x7ffe, 0x7fff, 0x8000, 0xffff),
+        (V) make_uint(0x7ffffffe, 0x7fffffff, 0x80000000, 0x80000001),
+        (V) make_uint(0xfffffffd, 0xfffffffe, 0xffffffff, 0x12345678),
+        (V) make_int(INT32_MIN, INT32_MIN + 1, INT32_MAX, -641),
+    };
+
+    for (unsigned i = 0; i < count; ++i) {
+        divider<E> d(divisors[i]);
+        for (const V& a : s) {
+            V q, r;
+            TEST_PUSH(tc, V, div(a, d));
+            TEST_PUSH(tc, V, mod(a, d));
+            divmod(a, d, q, r);
+            TEST_PUSH(tc, V, q);
+            TEST_PUSH(tc, V, r);
+            test_divider_check(tc, __LINE__, a, divisors[i], q, r);
+            test_divider_check(tc, __LINE__, a, divisors[i],
+                               V(div(a, d)), V(mod(a, d)));
+        }
+    }
+}
+
+template<unsigned B>
+void test_divider_n(TestSuite& tc)
+{
+    using namespace simdpp;
+
+    const uint16_t d16[] = { 1, 2, 3, 4, 7, 10, 256, 641, 0x7fff, 0x8000,
+                             0x8001, 0xffff };
+    test_divider_type<uint16<B/2>>(tc, d16, sizeof(d16) / sizeof(d16[0]));
+
+    const uint32_t d32[] = { 1, 2, 3, 4, 7, 8, 10, 641, 0x10000, 0x7fffffff,
+                             0x80000000, 0x80000001, 0xfffffffe, 0xffffffff };
+    test_divider_type<uint32<B/4>>(tc, d32, sizeof(d32) / sizeof(d32[0]));
+
+    const int32_t ds32[] = { 1, -1, 2, -2, 3, -3, 4, -4, 7, -7, 8, -8, 10,
+                             641, -641, 0x10000, -0x10000, 0x7fffffff,
+                             -0x7fffffff, 0x40000000, -0x40000000,
+                             INT32_MIN };
+    test_divider_type<int32<B/4>>(tc, ds32, sizeof(ds32) / sizeof(ds32[0]));
+
+    uint32<B/4> a = make_uint(0, 6, 7, 0xffffffff);
+    TEST_PUSH(tc, uint32<B/4>, div<7>(a));
+    TEST_PUSH(tc, uint32<B/4>, div<16>(a));
+    int32<B/4> b = make_int(0, -6, -7, 0x7fffffff);
+    TEST_PUSH(tc, int32<B/4>, div<-7>(b));
+    TEST_PUSH(tc, int32<B/4>, div<16>(b));
+    uint16<B/2> c = make_uint(0, 6, 7, 0xffff);
+    TEST_PUSH(tc, uint16<B/2>, div<7>(c));
+}
+
 void test_math_int(TestResults& res)
 {
     TestSuite& tc = NEW_TEST_SUITE(res, "math_int");
     test_math_int_n<16>(tc);
     test_math_int_n<32>(tc);
     test_math_int_n<64>(tc);
+    test_divider_n<16>(tc);
+    test_divider_n<32>(tc);
+    test_divider_n<64>(tc);
 
     using namespace simdpp;
     { // uint16
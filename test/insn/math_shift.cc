@@ -36,6 +36,49 @@ struct Test_shift_r {
     }
 };
 
+/*  Tests the shifts by a different count for each element. U is the unsigned
+    vector type of the counts. The results are also checked against the
+    scalar shifts.
+*/
+template<class V, class U>
+void test_shift_v(TestSuite& tc, const V* v, unsigned vnum)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using UE = typename U::element_type;
+    const unsigned bits = sizeof(E) * 8;
+
+    U counts[] = {
+        (U) make_uint(0, 1, 2, 3),
+        (U) make_uint(bits - 1, bits / 2, 5, 0),
+        (U) make_uint(bits - 2, 7, bits - 1, bits / 2 + 1),
+    };
+
+    for (unsigned i = 0; i < vnum; ++i) {
+        for (const U& c : counts) {
+            V l = shift_l(v[i], c);
+            V r = shift_r(v[i], c);
+            TEST_PUSH(tc, V, l);
+            TEST_PUSH(tc, V, r);
+
+            SIMDPP_ALIGN(64) UE adata[U::length];
+            SIMDPP_ALIGN(64) UE cdata[U::length];
+            SIMDPP_ALIGN(64) UE ldata[U::length];
+            SIMDPP_ALIGN(64) UE rdata[U::length];
+            store(adata, U(v[i]));
+            store(cdata, c);
+            store(ldata, U(l));
+            store(rdata, U(r));
+            for (unsigned j = 0; j < U::length; ++j) {
+                UE el = UE(uint64_t(adata[j]) << cdata[j]);
+                UE er = std::is_signed<E>::value ? UE(E(adata[j]) >> cdata[j])
+                                                 : UE(adata[j] >> cdata[j]);
+                tc.add_check(ldata[j] == el && rdata[j] == er, __LINE__);
+            }
+        }
+    }
+}
+
 template<unsigned B>
 void test_math_shift_n(TestSuite& tc)
 {
@@ -55,12 +98,16 @@ void test_math_shift_n(TestSuite& tc)
     TemplateTestArrayHelper<Test_shift_l, int16<B/2>>::run(tc, v.i16, vnum);
     TemplateTestArrayHelper<Test_shift_r, uint16<B/2>>::run(tc, v.u16, vnum);
     TemplateTestArrayHelper<Test_shift_r, int16<B/2>>::run(tc, v.i16, vnum);
+    test_shift_v<uint16<B/2>, uint16<B/2>>(tc, v.u16, vnum);
+    test_shift_v<int16<B/2>, uint16<B/2>>(tc, v.i16, vnum);
 
     // Vectors with 32-bit integer elements
     TemplateTestArrayHelper<Test_shift_l, uint32<B/4>>::run(tc, v.u32, vnum);
     TemplateTestArrayHelper<Test_shift_l, int32<B/4>>::run(tc, v.i32, vnum);
     TemplateTestArrayHelper<Test_shift_r, uint32<B/4>>::run(tc, v.u32, vnum);
     TemplateTestArrayHelper<Test_shift_r, int32<B/4>>::run(tc, v.i32, vnum);
+    test_shift_v<uint32<B/4>, uint32<B/4>>(tc, v.u32, vnum);
+    test_shift_v<int32<B/4>, uint32<B/4>>(tc, v.i32, vnum);
 
 #if !(SIMDPP_USE_ALTIVEC)
     // Vectors with 64-bit integer elements
@@ -68,6 +115,8 @@ void test_math_shift_n(TestSuite& tc)
     TemplateTestArrayHelper<Test_shift_l, int64<B/8>>::run(tc, v.i64, vnum);
     TemplateTestArrayHelper<Test_shift_r, uint64<B/8>>::run(tc, v.u64, vnum);
     TemplateTestArrayHelper<Test_shift_r, int64<B/8>>::run(tc, v.i64, vnum);
+    test_shift_v<uint64<B/8>, uint64<B/8>>(tc, v.u64, vnum);
+    test_shift_v<int64<B/8>, uint64<B/8>>(tc, v.i64, vnum);
 #endif
 }
 
@@ -0,0 +1,269 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class E>
+uint64_t test_ulp_diff(E a, E b)
+{
+    using I = typename std::conditional<sizeof(E) == 4, int32_t, int64_t>::type;
+    if (std::isnan(a) || std::isnan(b)) {
+        return (std::isnan(a) && std::isnan(b)) ? 0 : ~uint64_t(0);
+    }
+    I ia, ib;
+    std::memcpy(&ia, &a, sizeof(E));
+    std::memcpy(&ib, &b, sizeof(E));
+    // map the sign-magnitude representation to a monotonic integer sequence
+    if (ia < 0) ia = std::numeric_limits<I>::min() - ia;
+    if (ib < 0) ib = std::numeric_limits<I>::min() - ib;
+    return ia > ib ? uint64_t(ia) - uint64_t(ib) : uint64_t(ib) - uint64_t(ia);
+}
+
+/*  Compares the result against the reference computed by the standard library
+    in long double precision and records a check failure for the elements that
+    are not within @a ulp of the reference. The elements that are within the
+    bound are then replaced with the reference, so that the pushed vectors
+    compare equal between the architectures.
+
+    If @a in is given, the results for the finite arguments with magnitude
+    not less than @a max_arg are unspecified and thus are not checked.
+*/
+template<class V>
+void test_push_checked(TestSuite& tc, unsigned line, unsigned ulp, V r,
+                       const typename V::element_type* ref,
+                       const typename V::element_type* in = nullptr,
+                       typename V::element_type max_arg = 0)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E rdata[V::length];
+    store(rdata, r);
+    for (unsigned i = 0; i < V::length; ++i) {
+        bool ok = test_ulp_diff(rdata[i], ref[i]) <= ulp;
+        if (in && std::isfinite(in[i]) && std::abs(in[i]) >= max_arg) {
+            ok = true;
+        }
+        tc.add_check(ok, line);
+        if (ok) {
+            rdata[i] = ref[i];
+        }
+    }
+    tc.set_precision(ulp);
+    test_push_internal(tc, V(load(rdata)), line);
+    tc.unset_precision();
+}
+
+#define TEST_MATH1(TC, ULP, V, OP, A, FN)                                   \
+{                                                                           \
+    SIMDPP_ALIGN(64) E ref[V::length];                                      \
+    for (unsigned j = 0; j < V::length; ++j) {                              \
+        ref[j] = E(FN((long double)(A)[j]));                                \
+    }                                                                       \
+    test_push_checked(TC, __LINE__, ULP, V(OP(V(load(A)))), ref);           \
+}
+
+// Same as TEST_MATH1, but the arguments not less than MAX are not checked
+#define TEST_MATH1_RANGE(TC, ULP, V, OP, A, FN, MAX)                        \
+{                                                                           \
+    SIMDPP_ALIGN(64) E ref[V::length];                                      \
+    for (unsigned j = 0; j < V::length; ++j) {                              \
+        ref[j] = E(FN((long double)(A)[j]));                                \
+    }                                                                       \
+    test_push_checked(TC, __LINE__, ULP, V(OP(V(load(A)))), ref, A, MAX);   \
+}
+
+template<class V>
+void test_math_transcendental_type(TestSuite& tc, const typename V::element_type* in,
+                                   unsigned num_in)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const E* end = in + num_in - V::length + 1;
+    // see the documentation of sin and cos
+    const E trig_max = sizeof(E) == 4 ? E(6400) : E(1.6e6);
+
+    for (const E* a = in; a < end; a += V::length) {
+        TEST_MATH1(tc, 1, V, exp, a, std::exp);
+        TEST_MATH1(tc, 1, V, exp2, a, std::exp2);
+        TEST_MATH1(tc, 1, V, log, a, std::log);
+        TEST_MATH1(tc, 1, V, log2, a, std::log2);
+        TEST_MATH1_RANGE(tc, 2, V, sin, a, std::sin, trig_max);
+        TEST_MATH1_RANGE(tc, 2, V, cos, a, std::cos, trig_max);
+        TEST_MATH1(tc, 1, V, tanh, a, std::tanh);
+
+        V s, c;
+        sincos(V(load(a)), s, c);
+        SIMDPP_ALIGN(64) E sref[V::length];
+        SIMDPP_ALIGN(64) E cref[V::length];
+        for (unsigned j = 0; j < V::length; ++j) {
+            sref[j] = E(std::sin((long double)a[j]));
+            cref[j] = E(std::cos((long double)a[j]));
+        }
+        test_push_checked(tc, __LINE__, 2, s, sref, a, trig_max);
+        test_push_checked(tc, __LINE__, 2, c, cref, a, trig_max);
+
+        // pow with the elements rotated by one as the exponent
+        SIMDPP_ALIGN(64) E b[V::length];
+        SIMDPP_ALIGN(64) E ref[V::length];
+        for (unsigned j = 0; j < V::length; ++j) {
+            b[j] = a[(j + 1) % V::length] * E(0.25);
+            ref[j] = E(std::pow((long double)a[j], (long double)b[j]));
+        }
+        test_push_checked(tc, __LINE__, 1, V(pow(V(load(a)), V(load(b)))), ref);
+    }
+}
+
+template<unsigned B>
+void test_math_transcendental_n(TestSuite& tc)
+{
+    using namespace simdpp;
+    const float inff = std::numeric_limits<float>::infinity();
+    const float nanf = std::numeric_limits<float>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    SIMDPP_ALIGN(64) float sf[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.5f, -0.5f,
+        0.1f, -0.1f, 0.7f, -0.7f, 3.0f, -3.0f, 10.5f, -10.5f,
+        1e-5f, -1e-5f, 1e-20f, 1e-40f, 1.17549435e-38f, 3.4e38f, inff, -inff,
+        nanf, 86.5f, -86.5f, 88.7f, -103.0f, 127.5f, -149.0f, 200.0f,
+        3.14159265f, -3.14159265f, 1.57079633f, 0.78539816f, 100.0f, -100.0f, 6000.0f, -6000.0f,
+    };
+    SIMDPP_ALIGN(64) double sd[] = {
+        0.0, -0.0, 1.0, -1.0, 2.0, -2.0, 0.5, -0.5,
+        0.1, -0.1, 0.7, -0.7, 3.0, -3.0, 10.5, -10.5,
+        1e-5, -1e-5, 1e-200, 1e-310, 2.2250738585072014e-308, 1.7e308, inf, -inf,
+        nan, 708.5, -708.5, 709.7, -745.0, 1023.5, -1074.0, 2000.0,
+        3.14159265358979, -3.14159265358979, 1.5707963267949, 0.78539816339745, 1e5, -1e5, 1.5e6, -1.5e6,
+    };
+
+    test_math_transcendental_type<float32<B/4>>(tc, sf, sizeof(sf) / sizeof(sf[0]));
+    test_math_transcendental_type<float64<B/8>>(tc, sd, sizeof(sd) / sizeof(sd[0]));
+}
+
+/*  Same as test_push_checked, except that the elements are compared using the
+    given relative error bound. If @a abs_err is set, the bound is absolute.
+    The reference values are not rounded to the element type.
+*/
+template<class V>
+void test_push_checked_err(TestSuite& tc, unsigned line, double err, bool abs_err,
+                           V r, const double* ref)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E rdata[V::length];
+    store(rdata, r);
+    for (unsigned i = 0; i < V::length; ++i) {
+        bool ok;
+        if (std::isnan(ref[i])) {
+            ok = std::isnan(rdata[i]);
+        } else {
+            double bound = abs_err ? err : err * std::abs(ref[i]);
+            ok = std::abs(double(rdata[i]) - ref[i]) <= bound;
+        }
+        tc.add_check(ok, line);
+        if (ok) {
+            rdata[i] = E(ref[i]);
+        }
+    }
+    test_push_internal(tc, V(load(rdata)), line);
+}
+
+long double test_sigmoid(long double x) { return 1 / (1 + std::exp(-x)); }
+
+#define TEST_MATH_APPROX1(TC, ERR, ABS, D, OP, A, FN)                       \
+{                                                                           \
+    double ref[V::length];                                                  \
+    for (unsigned j = 0; j < V::length; ++j) {                              \
+        ref[j] = double(FN((long double)(A)[j]));                           \
+    }                                                                       \
+    test_push_checked_err(TC, __LINE__, ERR, ABS,                           \
+                          V(approx::OP<D>(V(load(A)))), ref);               \
+}
+
+template<unsigned D, class V>
+void test_math_approx_degree(TestSuite& tc, const float* in, unsigned num_in,
+                             const double* rel_exp2, const double* abs_log2,
+                             const double* rel_tanh)
+{
+    using namespace simdpp;
+    const float* end = in + num_in - V::length + 1;
+
+    // the inputs are within [-20, 20]; see the documentation of approx::exp
+    double rel_exp = rel_exp2[D-1] + 20 * 6e-8;
+    // log2 is evaluated on the absolute values
+    SIMDPP_ALIGN(64) float l[V::length];
+
+    for (const float* a = in; a < end; a += V::length) {
+        for (unsigned j = 0; j < V::length; ++j) {
+            l[j] = std::abs(a[j]);
+        }
+        TEST_MATH_APPROX1(tc, rel_exp2[D-1], false, D, exp2, a, std::exp2);
+        TEST_MATH_APPROX1(tc, rel_exp, false, D, exp, a, std::exp);
+        TEST_MATH_APPROX1(tc, abs_log2[D-1], true, D, log2, l, std::log2);
+        TEST_MATH_APPROX1(tc, rel_exp, false, D, sigmoid, a, test_sigmoid);
+        TEST_MATH_APPROX1(tc, rel_tanh[D-1], false, D, tanh, a, std::tanh);
+    }
+}
+
+template<unsigned B>
+void test_math_approx_n(TestSuite& tc)
+{
+    using namespace simdpp;
+    using V = float32<B/4>;
+
+    SIMDPP_ALIGN(64) float s[] = {
+        1.0f, -1.0f, 2.0f, -2.0f, 0.5f, -0.5f, 0.1f, -0.1f,
+        0.7f, -0.7f, 3.0f, -3.0f, 10.5f, -10.5f, 19.9f, -19.9f,
+        1e-3f, -1e-3f, 0.25f, -0.25f, 0.3f, -0.3f, 1.5f, -1.5f,
+        0.70710678f, 1.41421356f, 0.70710677f, 1.41421354f, 4.75f, -4.75f, 7.3f, -7.3f,
+    };
+
+    // the documented error bounds
+    static const double rel_exp2[] = { 3.0e-2, 1.8e-3, 7.5e-5, 2.8e-6, 2.4e-7 };
+    static const double abs_log2[] = { 8.6e-2, 9.9e-3, 1.3e-3, 1.8e-4, 2.9e-5 };
+    static const double rel_tanh[] = { 4.4e-2, 3.4e-3, 1.3e-4, 1.4e-5, 1.4e-5 };
+
+    unsigned num = sizeof(s) / sizeof(s[0]);
+    test_math_approx_degree<1, V>(tc, s, num, rel_exp2, abs_log2, rel_tanh);
+    test_math_approx_degree<2, V>(tc, s, num, rel_exp2, abs_log2, rel_tanh);
+    test_math_approx_degree<3, V>(tc, s, num, rel_exp2, abs_log2, rel_tanh);
+    test_math_approx_degree<4, V>(tc, s, num, rel_exp2, abs_log2, rel_tanh);
+    test_math_approx_degree<5, V>(tc, s, num, rel_exp2, abs_log2, rel_tanh);
+
+    // NaN is passed through
+    SIMDPP_ALIGN(64) float n[V::length];
+    for (unsigned j = 0; j < V::length; ++j) {
+        n[j] = std::numeric_limits<float>::quiet_NaN();
+    }
+    TEST_MATH_APPROX1(tc, 0, false, 3, exp2, n, std::exp2);
+    TEST_MATH_APPROX1(tc, 0, false, 3, exp, n, std::exp);
+    TEST_MATH_APPROX1(tc, 0, false, 3, sigmoid, n, test_sigmoid);
+    TEST_MATH_APPROX1(tc, 0, false, 3, tanh, n, std::tanh);
+}
+
+void test_math_transcendental(TestResults& res)
+{
+    TestSuite& ts = NEW_TEST_SUITE(res, "math_transcendental");
+    test_math_transcendental_n<16>(ts);
+    test_math_transcendental_n<32>(ts);
+    test_math_transcendental_n<64>(ts);
+
+    TestSuite& ta = NEW_TEST_SUITE(res, "math_approx");
+    test_math_approx_n<16>(ta);
+    test_math_approx_n<32>(ta);
+    test_math_approx_n<64>(ta);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
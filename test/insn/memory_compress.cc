@@ -0,0 +1,92 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  The selected elements are stored to a buffer twice as long as the vector.
+    The number of stored elements is recorded in the last element of the
+    buffer so that both the contents and the count are checked.
+*/
+template<class V>
+void test_compress_type(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned size = V::length * 2;
+
+    union {
+        SIMDPP_ALIGN(64) E buf[size];
+        V vbuf[2];
+    };
+    SIMDPP_ALIGN(64) E adata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+
+    for (unsigned seed = 0; seed < 6; ++seed) {
+        for (unsigned i = 0; i < V::length; ++i) {
+            adata[i] = E(i * 3 + 1);
+            // include the cases where no and all elements are selected
+            if (seed == 0) {
+                mdata[i] = 1;
+            } else if (seed == 1) {
+                mdata[i] = 0;
+            } else {
+                mdata[i] = E((i * 7 + seed) % seed == 0 ? 0 : 1);
+            }
+        }
+        V a = load(adata);
+        V m = load(mdata);
+
+        V r = compress(a, cmp_eq(m, V::zero()));
+        TEST_PUSH(tc, V, r);
+
+        for (unsigned i = 0; i < size; ++i) {
+            buf[i] = E(2);
+        }
+        unsigned n = compress_store(buf, a, cmp_eq(m, V::zero()));
+        buf[size - 1] = E(n);
+        TEST_ARRAY_PUSH(tc, V, vbuf);
+
+        for (unsigned i = 0; i < size; ++i) {
+            buf[i] = E(i + 5);
+        }
+        r = expand_load(buf, cmp_eq(m, V::zero()));
+        TEST_PUSH(tc, V, r);
+    }
+}
+
+template<unsigned B>
+void test_memory_compress_n(TestSuite& tc)
+{
+    using namespace simdpp;
+
+    test_compress_type<uint8<B>>(tc);
+    test_compress_type<int8<B>>(tc);
+    test_compress_type<uint16<B/2>>(tc);
+    test_compress_type<int16<B/2>>(tc);
+    test_compress_type<uint32<B/4>>(tc);
+    test_compress_type<int32<B/4>>(tc);
+    test_compress_type<float32<B/4>>(tc);
+    test_compress_type<uint64<B/8>>(tc);
+    test_compress_type<int64<B/8>>(tc);
+    test_compress_type<float64<B/8>>(tc);
+}
+
+void test_memory_compress(TestResults& res)
+{
+    using namespace simdpp;
+    TestSuite& tc = NEW_TEST_SUITE(res, "memory_compress");
+
+    test_memory_compress_n<16>(tc);
+    test_memory_compress_n<32>(tc);
+    test_memory_compress_n<64>(tc);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,97 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  V is the data vector type, I is the index vector type. The table is four
+    vectors long; the indices are chosen so that they are neither sequential
+    nor unique.
+*/
+template<class V, class I>
+void test_gather_type(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+    const unsigned size = V::length * 4;
+
+    union {
+        SIMDPP_ALIGN(64) E table[size];
+        V vtable[4];
+    };
+    SIMDPP_ALIGN(64) IE idata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+
+    for (unsigned seed = 0; seed < 4; ++seed) {
+        for (unsigned i = 0; i < size; ++i) {
+            table[i] = E(i * 3 + 1);
+        }
+        for (unsigned i = 0; i < V::length; ++i) {
+            idata[i] = (i * 7 + seed * 5) % size;
+            mdata[i] = E((i + seed) % 3 == 0 ? 0 : 1);
+        }
+        I idx = load(idata);
+        V m = load(mdata);
+        V src = splat(E(2));
+
+        V r = gather(table, idx);
+        TEST_PUSH(tc, V, r);
+
+        r = gather_masked(table, idx, cmp_eq(m, V::zero()), src);
+        TEST_PUSH(tc, V, r);
+
+        // the element at the highest position wins for duplicate indices
+        for (unsigned i = 0; i < size; ++i) {
+            table[i] = 0;
+        }
+        scatter(table, idx, r);
+        TEST_ARRAY_PUSH(tc, V, vtable);
+
+        for (unsigned i = 0; i < size; ++i) {
+            table[i] = 0;
+        }
+        scatter_masked(table, idx, r, cmp_eq(m, V::zero()));
+        TEST_ARRAY_PUSH(tc, V, vtable);
+    }
+}
+
+template<unsigned B>
+void test_memory_gather_n(TestSuite& tc)
+{
+    using namespace simdpp;
+
+    test_gather_type<uint32<B/4>, uint32<B/4>>(tc);
+    test_gather_type<int32<B/4>, uint32<B/4>>(tc);
+    test_gather_type<float32<B/4>, uint32<B/4>>(tc);
+    test_gather_type<uint64<B/8>, uint64<B/8>>(tc);
+    test_gather_type<int64<B/8>, uint64<B/8>>(tc);
+    test_gather_type<float64<B/8>, uint64<B/8>>(tc);
+}
+
+void test_memory_gather(TestResults& res)
+{
+    using namespace simdpp;
+    TestSuite& tc = NEW_TEST_SUITE(res, "memory_gather");
+
+    test_memory_gather_n<16>(tc);
+    test_memory_gather_n<32>(tc);
+    test_memory_gather_n<64>(tc);
+
+    // 64-bit elements with 32-bit indices
+    test_gather_type<uint64<4>, uint32<4>>(tc);
+    test_gather_type<int64<4>, uint32<4>>(tc);
+    test_gather_type<float64<4>, uint32<4>>(tc);
+    test_gather_type<uint64<8>, uint32<8>>(tc);
+    test_gather_type<int64<8>, uint32<8>>(tc);
+    test_gather_type<float64<8>, uint32<8>>(tc);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,178 @@
+/*  Copyright (C) 2016  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <cstring>
+#include <limits>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+#define TEST_PUSH_REDUCE(TC, OP, A) TEST_PUSH(TC, decltype(OP(A)), OP(A))
+
+/*  Fills the array with pseudo-random integers. The floating-point values are
+    chosen from a small set so that the sums and products are exact regardless
+    of the order in which the elements are reduced.
+*/
+template<class E>
+void test_reduce_fill(E* data, unsigned n, unsigned seed)
+{
+    uint64_t x = seed * 0x9e3779b97f4a7c15ULL + 1;
+    for (unsigned i = 0; i < n; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint64_t v = x ^ (x >> 29);
+        std::memcpy(data + i, &v, sizeof(E));
+    }
+}
+
+template<class E>
+void test_reduce_fill_fp(E* data, unsigned n, unsigned seed)
+{
+    static const E values[] = { 1, 2, 0.5, -1, -2, -0.5, 0.25, 4 };
+    uint32_t x = seed * 2654435761u + 1;
+    for (unsigned i = 0; i < n; ++i) {
+        x = x * 1103515245u + 12345u;
+        data[i] = values[(x >> 16) % 8];
+    }
+}
+
+void test_reduce_fill(float* data, unsigned n, unsigned seed)
+{
+    test_reduce_fill_fp(data, n, seed);
+}
+
+void test_reduce_fill(double* data, unsigned n, unsigned seed)
+{
+    test_reduce_fill_fp(data, n, seed);
+}
+
+template<class V>
+void test_reduce_int(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        test_reduce_fill(data, V::length, seed);
+        V a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_add, a);
+        TEST_PUSH_REDUCE(tc, reduce_and, a);
+        TEST_PUSH_REDUCE(tc, reduce_or, a);
+
+        // make sure that the and/or reductions are not trivially all ones or
+        // all zeros
+        for (unsigned i = 0; i < V::length; ++i) {
+            data[i] |= E(1) << (i % (sizeof(E) * 8 - 1));
+        }
+        a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_and, a);
+        TEST_PUSH_REDUCE(tc, reduce_or, a);
+    }
+}
+
+template<class V>
+void test_reduce_minmax(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        test_reduce_fill(data, V::length, seed);
+        V a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_min, a);
+        TEST_PUSH_REDUCE(tc, reduce_max, a);
+    }
+
+    // the extreme values at each position
+    for (unsigned i = 0; i < V::length; ++i) {
+        test_reduce_fill(data, V::length, i);
+        data[i] = std::numeric_limits<E>::lowest();
+        V a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_min, a);
+        TEST_PUSH_REDUCE(tc, reduce_max, a);
+
+        data[i] = std::numeric_limits<E>::max();
+        a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_min, a);
+        TEST_PUSH_REDUCE(tc, reduce_max, a);
+    }
+}
+
+template<class V>
+void test_reduce_mul(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        test_reduce_fill(data, V::length, seed);
+        V a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_mul, a);
+    }
+}
+
+template<class V>
+void test_reduce_fp(TestSuite& tc)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    SIMDPP_ALIGN(64) E data[V::length];
+
+    for (unsigned seed = 0; seed < 8; ++seed) {
+        test_reduce_fill(data, V::length, seed);
+        V a = load(data);
+        TEST_PUSH_REDUCE(tc, reduce_add, a);
+    }
+}
+
+template<unsigned B>
+void test_reduce_n(TestSuite& tc)
+{
+    using namespace simdpp;
+
+    test_reduce_int<uint8<B>>(tc);
+    test_reduce_int<int8<B>>(tc);
+    test_reduce_int<uint16<B/2>>(tc);
+    test_reduce_int<int16<B/2>>(tc);
+    test_reduce_int<uint32<B/4>>(tc);
+    test_reduce_int<int32<B/4>>(tc);
+    test_reduce_int<uint64<B/8>>(tc);
+    test_reduce_int<int64<B/8>>(tc);
+
+    test_reduce_minmax<uint8<B>>(tc);
+    test_reduce_minmax<int8<B>>(tc);
+    test_reduce_minmax<uint16<B/2>>(tc);
+    test_reduce_minmax<int16<B/2>>(tc);
+    test_reduce_minmax<uint32<B/4>>(tc);
+    test_reduce_minmax<int32<B/4>>(tc);
+    test_reduce_minmax<float32<B/4>>(tc);
+    test_reduce_minmax<float64<B/8>>(tc);
+
+    test_reduce_mul<uint16<B/2>>(tc);
+    test_reduce_mul<int16<B/2>>(tc);
+    test_reduce_mul<uint32<B/4>>(tc);
+    test_reduce_mul<int32<B/4>>(tc);
+    test_reduce_mul<float32<B/4>>(tc);
+    test_reduce_mul<float64<B/8>>(tc);
+
+    test_reduce_fp<float32<B/4>>(tc);
+    test_reduce_fp<float64<B/8>>(tc);
+}
+
+void test_reduce(TestResults& res)
+{
+    TestSuite& tc = NEW_TEST_SUITE(res, "reduce");
+    test_reduce_n<16>(tc);
+    test_reduce_n<32>(tc);
+    test_reduce_n<64>(tc);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
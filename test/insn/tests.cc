@@ -25,12 +25,16 @@ void main_test_function(TestResults& res)
     test_math_int(res);
     test_compare(res);
     test_math_shift(res);
+    test_math_transcendental(res);
+    test_reduce(res);
     test_permute_generic(res);
     test_shuffle_generic(res);
     test_shuffle(res);
     test_shuffle_bytes(res);
     test_memory_load(res);
     test_memory_store(res);
+    test_memory_gather(res);
+    test_memory_compress(res);
     test_transpose(res);
 }
 
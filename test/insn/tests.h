@@ -25,6 +25,9 @@ void test_construct(TestResults& res);
 void test_math_fp(TestResults& res);
 void test_math_int(TestResults& res);
 void test_math_shift(TestResults& res);
+void test_math_transcendental(TestResults& res);
+void test_memory_compress(TestResults& res);
+void test_memory_gather(TestResults& res);
 void test_memory_load(TestResults& res);
 void test_memory_store(TestResults& res);
 void test_set(TestResults& res);
@@ -32,6 +35,7 @@ void test_shuffle(TestResults& res);
 void test_shuffle_bytes(TestResults& res);
 void test_shuffle_generic(TestResults& res);
 void test_permute_generic(TestResults& res);
+void test_reduce(TestResults& res);
 void test_shuffle_transpose(TestResults& res);
 void test_test_utils(TestResults& res);
 void test_transpose(TestResults& res);
@@ -42,20 +42,44 @@ int main(int argc, char** argv)
     } else if (arch_name == "X86_SSE4_1") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
                            Arch::X86_SSE4_1;
+    } else if (arch_name == "X86_SSE4_2") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                           Arch::X86_SSE4_1 | Arch::X86_SSE4_2;
     } else if (arch_name == "X86_AVX") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX;
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX;
     } else if (arch_name == "X86_AVX2") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2;
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+                Arch::X86_AVX2;
+    } else if (arch_name == "X86_F16C") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_F16C;
     } else if (arch_name == "X86_AVX512F") {
         g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
-                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2 |
-                Arch::X86_AVX512F;
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+                Arch::X86_AVX2 | Arch::X86_FMA3 | Arch::X86_AVX512F;
+    } else if (arch_name == "X86_AVX512BW") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+                Arch::X86_AVX2 | Arch::X86_FMA3 | Arch::X86_AVX512F |
+                Arch::X86_AVX512BW;
+    } else if (arch_name == "X86_AVX512DQ") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+                Arch::X86_AVX2 | Arch::X86_FMA3 | Arch::X86_AVX512F |
+                Arch::X86_AVX512DQ;
+    } else if (arch_name == "X86_AVX512BF16") {
+        g_supported_arch = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+                Arch::X86_AVX2 | Arch::X86_FMA3 | Arch::X86_AVX512F |
+                Arch::X86_AVX512BF16;
     } else if (arch_name == "ARM_NEON") {
         g_supported_arch = Arch::ARM_NEON;
     } else if (arch_name == "ARM_NEON_FLT_SP") {
         g_supported_arch = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
+    } else if (arch_name == "ARM_NEON64") {
+        g_supported_arch = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP |
+                Arch::ARM_NEON64;
     } else {
         std::cerr << "Invalid architecture specified: " << arch_name << "\n";
         return EXIT_FAILURE;
@@ -84,6 +108,12 @@ int main(int argc, char** argv)
     if (test_dispatcher4(1, 2, 3, 4) != 1+2+3+4) {
         err |= 8;
     }
+    if (test_dispatcher_overload(1) != 2) {
+        err |= 16;
+    }
+    if (test_dispatcher_overload(1.5f) != 3.0f) {
+        err |= 32;
+    }
     if (err != 0) {
         std::cout << "ERR: " << err << "\n";
         return EXIT_FAILURE;
@@ -0,0 +1,97 @@
+/*  Copyright (C) 2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "insn/dispatcher.h"
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <simdpp/simd.h>
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+/*  Tests the dispatcher in the IFUNC mode. The versions are selected when the
+    executable is loaded, before main() runs, thus the supported architecture
+    can't be supplied on the command line as in main_dispatcher.cc. Instead,
+    the architecture of the current processor is used and the selected version
+    is compared to the one that select_version_any picks out of the same set of
+    versions.
+*/
+simdpp::Arch get_supported_arch()
+{
+#if __i386__ || __amd64__
+    return simdpp::get_arch_raw_cpuid();
+#else
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+
+using TestFunPtr = simdpp::Arch(*)();
+
+extern "C" {
+extern const char __start_simdpp_dispatch_test_dispatcher[]
+    __attribute__((visibility("hidden")));
+extern const char __stop_simdpp_dispatch_test_dispatcher[]
+    __attribute__((visibility("hidden")));
+}
+
+int main()
+{
+    using simdpp::Arch;
+    using simdpp::detail::FnVersion;
+    using simdpp::detail::VoidFunPtr;
+
+    using Version = simdpp::detail::IfuncVersion<TestFunPtr>;
+    auto first = reinterpret_cast<const Version*>(
+                __start_simdpp_dispatch_test_dispatcher);
+    auto last = reinterpret_cast<const Version*>(
+                __stop_simdpp_dispatch_test_dispatcher);
+
+    std::vector<FnVersion> versions;
+    for (auto it = first; it != last; ++it) {
+        FnVersion version;
+        version.needed_arch = it->needed_arch;
+        version.fun_ptr = reinterpret_cast<VoidFunPtr>(it->fun_ptr);
+        versions.push_back(version);
+    }
+
+    unsigned id = simdpp::detail::select_version_any(versions,
+                                                     get_supported_arch);
+    Arch expected = reinterpret_cast<TestFunPtr>(versions[id].fun_ptr)();
+
+    Arch selected = test_dispatcher();
+    if (selected != expected) {
+        std::cerr << "Wrong architecture selected: \n"
+                  << "  Expected: "
+                  << std::hex << static_cast<unsigned>(expected)
+                  << "\n  Selected: "
+                  << std::hex << static_cast<unsigned>(selected) << "\n";
+        return EXIT_FAILURE;
+    }
+
+    unsigned err = 0;
+    if (test_dispatcher1(1) != 1) {
+        err |= 1;
+    }
+    if (test_dispatcher2(1, 2) != 1+2) {
+        err |= 2;
+    }
+    if (test_dispatcher3(1, 2, 3) != 1+2+3) {
+        err |= 4;
+    }
+    if (test_dispatcher4(1, 2, 3, 4) != 1+2+3+4) {
+        err |= 8;
+    }
+    if (test_dispatcher_overload(1) != 2) {
+        err |= 16;
+    }
+    if (test_dispatcher_overload(1.5f) != 3.0f) {
+        err |= 32;
+    }
+    if (err != 0) {
+        std::cout << "ERR: " << err << "\n";
+        return EXIT_FAILURE;
+    }
+}
@@ -293,6 +293,22 @@ bool test_equal(const TestSuite& a, const char* a_arch,
     }
 
     bool ok = true;
+    // Report the failed checks of both architectures
+    auto fmt_failed_checks = [&](const TestSuite& s, const char* arch)
+    {
+        for (unsigned line : s.failed_checks_) {
+            fmt_separator();
+            err << "  For architecture: " << arch << " :\n";
+            err << "  In file \"" << s.file_ << "\" at line " << line << " : \n";
+            fmt_test_case();
+            err << "ERROR: Check failed\n";
+            fmt_separator();
+            ok = false;
+        }
+    };
+    fmt_failed_checks(a, a_arch);
+    fmt_failed_checks(b, b_arch);
+
     // Compare results
     for (unsigned i = 0; i < a.results_.size(); i++) {
         const auto& ia = a.results_[i];
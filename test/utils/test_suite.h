@@ -81,6 +81,15 @@ public:
     void set_precision(unsigned num_ulp)    { curr_precision_ulp_ = num_ulp; }
     void unset_precision()                  { curr_precision_ulp_ = 0; }
 
+    /// Records the outcome of a check that does not depend on the results of
+    /// other architectures, e.g. a comparison against a precomputed reference.
+    void add_check(bool success, unsigned line)
+    {
+        if (!success) {
+            failed_checks_.push_back(line);
+        }
+    }
+
     /// The name of the test case
     const char* name() const                { return name_; }
 
@@ -106,6 +115,7 @@ private:
     unsigned seq_;
     unsigned curr_precision_ulp_;
     std::vector<Result> results_;
+    std::vector<unsigned> failed_checks_;
 };
 
 class SeqTestSuite {
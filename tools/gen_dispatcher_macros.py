@@ -28,6 +28,8 @@ num_args = 10
     $types_vars$ - same as $types$, just each type is followed with some
         identifier
     $vars$ - a comma-separated list of identifiers referred to by $types_vars$
+    $signature$ - a string literal expression that stringizes $ret_type$ and
+        $types$
     $n$ - identifies the backslash character
 '''
 
@@ -55,7 +57,7 @@ namespace SIMDPP_ARCH_NAMESPACE {                                           $n$
                                                                             $n$
 static ::simdpp::detail::DispatchRegistrator<                               $n$
         simdpp_ ## NAME ## _tag,$ret_type$(*)($types$)                      $n$
-> simdpp_dispatch_registrator_ ## NAME (                                    $n$
+> SIMDPP_DISPATCH_CAT(simdpp_dispatch_registrator_ ## NAME ## _, __LINE__) ( $n$
         ::simdpp::SIMDPP_ARCH_NAMESPACE::this_compile_arch(),               $n$
         static_cast<$ret_type$(*)($types$)>(&NAME));                        $n$
                                                                             $n$
@@ -65,6 +67,51 @@ static ::simdpp::detail::DispatchRegistrator<                               $n$
 template_null = template_head + template_fn + template_registration
 template_not_null = template_head + template_registration
 
+# In IFUNC mode the dispatched function is an indirect function whose resolver
+# walks the records of all versions. The records are put into a section named
+# after the function and are found via the __start_ and __stop_ symbols that
+# the linker defines for such sections.
+
+template_ifunc_fn = '''
+extern "C" {                                                                $n$
+extern const char __start_simdpp_dispatch_ ## NAME []                       $n$
+    __attribute__((visibility("hidden")));                                  $n$
+extern const char __stop_simdpp_dispatch_ ## NAME []                        $n$
+    __attribute__((visibility("hidden")));                                  $n$
+                                                                            $n$
+static $ret_type$(*SIMDPP_DISPATCH_CAT(simdpp_ ## NAME ## _resolve_,        $n$
+                                       __LINE__)())($types$)                $n$
+{                                                                           $n$
+    return ::simdpp::detail::select_version_ifunc<$ret_type$(*)($types$)>(  $n$
+        __start_simdpp_dispatch_ ## NAME,                                   $n$
+        __stop_simdpp_dispatch_ ## NAME,                                    $n$
+        $signature$, SIMDPP_USER_ARCH_INFO);                                $n$
+}                                                                           $n$
+} /* extern "C" */                                                          $n$
+                                                                            $n$
+$ret_type$ NAME($types_vars$)                                               $n$
+    __attribute__((ifunc("simdpp_" #NAME "_resolve_"                        $n$
+                         SIMDPP_DISPATCH_STRINGIFY(__LINE__))));            $n$
+                                                                            $n$'''
+
+template_ifunc_registration = '''
+namespace SIMDPP_ARCH_NAMESPACE {                                           $n$
+                                                                            $n$
+static const ::simdpp::detail::IfuncVersion<$ret_type$(*)($types$)>         $n$
+    SIMDPP_DISPATCH_CAT(simdpp_dispatch_version_ ## NAME ## _, __LINE__)    $n$
+    __attribute__((section("simdpp_dispatch_" #NAME), used)) = {            $n$
+        static_cast< ::simdpp::Arch>(::simdpp::SIMDPP_ARCH_NAMESPACE::      $n$
+                                     detail::this_compile_arch_bits),       $n$
+        static_cast<$ret_type$(*)($types$)>(&NAME),                         $n$
+        $signature$                                                         $n$
+};                                                                          $n$
+                                                                            $n$
+} /* namespace SIMDPP_ARCH_NAMESPACE */
+'''
+
+template_ifunc_null = template_head + template_ifunc_fn + template_ifunc_registration
+template_ifunc_not_null = template_head + template_ifunc_registration
+
 # Prints a template substituting the given variables with given replacements
 def output_template(template, vars):
     text = template
@@ -113,6 +160,15 @@ def get_Tn_an_list(num):
         out += ',T' + str(i+1) + ' ' + 'a' + str(i+1)
     return out
 
+# Returns the stringized signature, e.g. #R "(" #T1 "," #T2 ")"
+def get_signature(ret, num):
+    out = ret + ' "("'
+    for i in range(0, num):
+        if i != 0:
+            out += ' ","'
+        out += ' #T' + str(i+1)
+    return out + ' ")"'
+
 # Prints the macros given a template
 def do_template(template):
     # void, no callback
@@ -130,6 +186,7 @@ def do_template(template):
         vars['types'] = Tn
         vars['types_vars'] = Tn_an
         vars['vars'] = an
+        vars['signature'] = get_signature('"void"', i)
         output_template(template, vars)
 
     # R, no callback
@@ -147,6 +204,7 @@ def do_template(template):
         vars['types'] = Tn
         vars['types_vars'] = Tn_an
         vars['vars'] = an
+        vars['signature'] = get_signature('#R', i)
         output_template(template, vars)
 
 # print the actual file
@@ -158,7 +216,6 @@ print('''/*  Copyright (C) 2013  Povilas Kanapickas <povilas@radix.lt>
             http://www.boost.org/LICENSE_1_0.txt)
 */
 
-
 // This file is generated automatically. See tools/gen_dispatcher_macros.py
 
 #ifndef LIBSIMDPP_DISPATCH_MACROS_H
@@ -185,7 +242,7 @@ print('''/*  Copyright (C) 2013  Povilas Kanapickas <povilas@radix.lt>
     * R: the type of the return value
 
     * T1, T2, ..., T#: the types of the parameters of the function that is
-      dispatcher.
+      dispatched.
 
 
     @c SIMDPP_ARCH_NAMESPACE::NAME must refer to the function to be disptached
@@ -194,14 +251,33 @@ print('''/*  Copyright (C) 2013  Povilas Kanapickas <povilas@radix.lt>
     dispatched function, and that namespace must be @c SIMDPP_ARCH_NAMESPACE
 
     @a R, T1, T2, ..., T# must be exactly the same as those of the function
-    to be dispatched. The dispatched function may be overloaded.
+    to be dispatched. The dispatched function may be overloaded. The macros
+    for different overloads must be used on different lines. In the
+    @c SIMDPP_DISPATCH_USE_IFUNC mode the macros for the same overload must
+    also spell the types identically in all architectures.
 
     The macro defines a function with the same signature as the dispatched
     function in the namespace the macro is used. The body of that function
     implements the dispatch mechanism. The function must not be called before
-    main() starts.
+    main() starts, unless @c SIMDPP_DISPATCH_USE_IFUNC is in effect.
 */
 /// @{
+#define SIMDPP_DISPATCH_CAT2(a, b) a ## b
+#define SIMDPP_DISPATCH_CAT(a, b) SIMDPP_DISPATCH_CAT2(a, b)
+#define SIMDPP_DISPATCH_STRINGIFY2(x) #x
+#define SIMDPP_DISPATCH_STRINGIFY(x) SIMDPP_DISPATCH_STRINGIFY2(x)
+
+#if SIMDPP_DISPATCH_IFUNC
+#ifdef SIMDPP_USE_NULL
+''')
+do_template(template_ifunc_null)
+print('''
+#else
+''')
+do_template(template_ifunc_not_null)
+print('''
+#endif
+#else
 #ifdef SIMDPP_USE_NULL
 ''')
 do_template(template_null)
@@ -211,6 +287,7 @@ print('''
 do_template(template_not_null)
 print('''
 #endif
+#endif
 /// @}
 
 #endif